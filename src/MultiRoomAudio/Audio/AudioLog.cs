@@ -0,0 +1,168 @@
+using Microsoft.Extensions.Logging;
+using MultiRoomAudio.Audio.PulseAudio;
+using Sendspin.SDK.Audio;
+using Sendspin.SDK.Models;
+
+namespace MultiRoomAudio.Audio;
+
+/// <summary>
+/// Source-generated log messages for the audio output path.
+/// </summary>
+/// <remarks>
+/// <para>
+/// These run on PulseAudio's mainloop thread (state, write and underflow callbacks) and on
+/// the sample source's Read() path. The generated methods check <c>IsEnabled</c> before
+/// touching their arguments, so a disabled level costs no params array, no boxing of
+/// value types and no template parsing - unlike the <c>LogDebug(string, params object[])</c>
+/// extension methods, which allocate on every call whether the message is written or not.
+/// </para>
+/// <para>
+/// Event IDs: 1000-1099 <see cref="PulseAudioPlayer"/>,
+/// 1100-1199 <see cref="BufferedAudioSampleSource"/>.
+/// </para>
+/// </remarks>
+internal static partial class AudioLog
+{
+    #region PulseAudioPlayer
+
+    [LoggerMessage(EventId = 1000, Level = LogLevel.Debug,
+        Message = "PulseAudio context state: {State}")]
+    public static partial void ContextStateChanged(this ILogger logger, PulseAudioNative.ContextState state);
+
+    [LoggerMessage(EventId = 1001, Level = LogLevel.Debug,
+        Message = "PulseAudio context disconnected (expected): {State}")]
+    public static partial void ContextDisconnectedExpected(this ILogger logger, PulseAudioNative.ContextState state);
+
+    [LoggerMessage(EventId = 1002, Level = LogLevel.Warning,
+        Message = "PulseAudio context disconnected: {State}")]
+    public static partial void ContextDisconnected(this ILogger logger, PulseAudioNative.ContextState state);
+
+    [LoggerMessage(EventId = 1003, Level = LogLevel.Debug,
+        Message = "PulseAudio stream state: {State}")]
+    public static partial void StreamStateChanged(this ILogger logger, PulseAudioNative.StreamState state);
+
+    [LoggerMessage(EventId = 1004, Level = LogLevel.Debug,
+        Message = "PulseAudio stream disconnected (expected): {State}. Sink: {Sink}")]
+    public static partial void StreamDisconnectedExpected(this ILogger logger, PulseAudioNative.StreamState state, string sink);
+
+    [LoggerMessage(EventId = 1005, Level = LogLevel.Warning,
+        Message = "PulseAudio stream disconnected: {State}. Error: {Error}. Sink: {Sink}")]
+    public static partial void StreamDisconnected(this ILogger logger, PulseAudioNative.StreamState state, string error, string sink);
+
+    [LoggerMessage(EventId = 1010, Level = LogLevel.Information,
+        Message = "Latency seed {Seed}ms rejected (early median {Median}ms), continuing full lock-in")]
+    public static partial void LatencySeedRejected(this ILogger logger, int seed, int median);
+
+    [LoggerMessage(EventId = 1011, Level = LogLevel.Information,
+        Message = "Latency locked early at {Latency}ms (warm start, seed {Seed}ms, {Count} samples)")]
+    public static partial void LatencyLockedEarly(this ILogger logger, int latency, int seed, int count);
+
+    [LoggerMessage(EventId = 1012, Level = LogLevel.Warning,
+        Message = "Latency range {Range}ms too wide (min={Min}ms, max={Max}ms). " +
+                  "Using {Latency}ms instead of median {Median}ms to avoid sync issues")]
+    public static partial void LatencyRangeTooWide(this ILogger logger, int range, int min, int max, int latency, int median);
+
+    [LoggerMessage(EventId = 1013, Level = LogLevel.Warning,
+        Message = "Measured latency {Median}ms exceeds maximum, capping to {Max}ms")]
+    public static partial void LatencyCapped(this ILogger logger, int median, int max);
+
+    [LoggerMessage(EventId = 1014, Level = LogLevel.Information,
+        Message = "Latency locked at {Latency}ms (median of {Count} samples, range: {Min}-{Max}ms)")]
+    public static partial void LatencyLocked(this ILogger logger, int latency, int count, int min, int max);
+
+    [LoggerMessage(EventId = 1020, Level = LogLevel.Debug,
+        Message = "Waiting for sample source: callbacks={Callbacks}, silence={Silence}")]
+    public static partial void WaitingForSampleSource(this ILogger logger, long callbacks, long silence);
+
+    [LoggerMessage(EventId = 1021, Level = LogLevel.Warning,
+        Message = "PA requested {Requested} samples but buffer is {BufferSize}. Capping request.")]
+    public static partial void WriteRequestCapped(this ILogger logger, int requested, int bufferSize);
+
+    [LoggerMessage(EventId = 1022, Level = LogLevel.Debug,
+        Message = "Read returned 0: elapsed={Elapsed:F0}ms, callbacks={Callbacks}, zeroReads={ZeroReads}, latency={Latency}ms")]
+    public static partial void PlayerZeroRead(this ILogger logger, double elapsed, long callbacks, long zeroReads, int latency);
+
+    [LoggerMessage(EventId = 1023, Level = LogLevel.Information,
+        Message = "First audio samples received: elapsed={Elapsed:F0}ms, callbacks={Callbacks}, " +
+                  "silenceWrites={Silence}, zeroReads={ZeroReads}, latency={Latency}ms")]
+    public static partial void FirstAudioReceived(this ILogger logger, double elapsed, long callbacks, long silence, long zeroReads, int latency);
+
+    [LoggerMessage(EventId = 1024, Level = LogLevel.Debug,
+        Message = "PulseAudio stream write failed")]
+    public static partial void StreamWriteFailed(this ILogger logger);
+
+    [LoggerMessage(EventId = 1030, Level = LogLevel.Debug,
+        Message = "First underflow at {Elapsed:F0}ms after play. callbacks={Callbacks}, zeroReads={ZeroReads}")]
+    public static partial void FirstUnderflow(this ILogger logger, double elapsed, long callbacks, long zeroReads);
+
+    [LoggerMessage(EventId = 1031, Level = LogLevel.Warning,
+        Message = "Audio underflow detected ({Count} times at {Elapsed:F0}ms). " +
+                  "callbacks={Callbacks}, zeroReads={ZeroReads}, latency={Latency}ms")]
+    public static partial void UnderflowDetected(this ILogger logger, int count, double elapsed, long callbacks, long zeroReads, int latency);
+
+    [LoggerMessage(EventId = 1032, Level = LogLevel.Debug,
+        Message = "Underflow count: {Count}")]
+    public static partial void UnderflowCount(this ILogger logger, int count);
+
+    [LoggerMessage(EventId = 1040, Level = LogLevel.Debug,
+        Message = "State changed: {OldState} -> {NewState}")]
+    public static partial void PlayerStateChanged(this ILogger logger, AudioPlayerState oldState, AudioPlayerState newState);
+
+    [LoggerMessage(EventId = 1050, Level = LogLevel.Debug,
+        Message = "Stream idle for {Idle:F0}ms, corking (callbacks={Callbacks}, silenceWrites={Silence})")]
+    public static partial void IdleCorked(this ILogger logger, double idle, long callbacks, long silence);
+
+    [LoggerMessage(EventId = 1051, Level = LogLevel.Debug,
+        Message = "Waking idle stream after {Corked:F0}ms corked (~{Saved} callbacks saved)")]
+    public static partial void IdleWoken(this ILogger logger, double corked, long saved);
+
+    [LoggerMessage(EventId = 1052, Level = LogLevel.Debug,
+        Message = "First audio {Elapsed:F0}ms after idle wake")]
+    public static partial void IdleWakeToAudio(this ILogger logger, double elapsed);
+
+    #endregion
+
+    #region BufferedAudioSampleSource
+
+    [LoggerMessage(EventId = 1100, Level = LogLevel.Information,
+        Message = "BufferedAudioSampleSource initialized: channels={Channels}, sampleRate={SampleRate}, " +
+                  "interpolation=3-point weighted with 2-point fallback")]
+    public static partial void SampleSourceInitialized(this ILogger logger, int channels, int sampleRate);
+
+    [LoggerMessage(EventId = 1101, Level = LogLevel.Information,
+        Message = "First samples received from buffer: elapsedMs={ElapsedMs:F1}, " +
+                  "totalReads={TotalReads}, zeroReads={ZeroReads}")]
+    public static partial void FirstSamplesReceived(this ILogger logger, double elapsedMs, long totalReads, long zeroReads);
+
+    [LoggerMessage(EventId = 1102, Level = LogLevel.Warning,
+        Message = "Read returned 0 [{Reason}]: currentTime={CurrentTime}μs, bufferedMs={BufferedMs:F0}, " +
+                  "targetMs={TargetMs:F0}, isPlaybackActive={IsPlaybackActive}, syncError={SyncError:F1}ms, " +
+                  "elapsedMs={ElapsedMs:F0}, sinceLastSuccessMs={SinceLastSuccess:F0}, " +
+                  "zeroReads={ZeroReads}/{TotalReads}, overruns={Overruns}, underruns={Underruns}")]
+    public static partial void SourceZeroRead(
+        this ILogger logger, string reason, long currentTime, double bufferedMs, double targetMs,
+        bool isPlaybackActive, double syncError, double elapsedMs, double sinceLastSuccess,
+        long zeroReads, long totalReads, long overruns, long underruns);
+
+    [LoggerMessage(EventId = 1103, Level = LogLevel.Warning,
+        Message = "Buffer state: samplesWritten={Written}, samplesRead={Read}, " +
+                  "droppedOverflow={DroppedOverflow}, droppedSync={DroppedSync}, insertedSync={InsertedSync}")]
+    public static partial void SourceBufferState(
+        this ILogger logger, long written, long read, long droppedOverflow, long droppedSync, long insertedSync);
+
+    [LoggerMessage(EventId = 1104, Level = LogLevel.Error,
+        Message = "BUFFER OVERFLOW DETECTED: SDK is dropping samples because buffer is full and Read() isn't consuming. " +
+                  "bufferedMs={BufferedMs:F0}, targetMs={TargetMs:F0}, isPlaybackActive={IsPlaybackActive}, " +
+                  "totalDropped={Dropped}, overrunCount={Overruns}. " +
+                  "This indicates scheduled start time was never reached.")]
+    public static partial void BufferOverflowDetected(
+        this ILogger logger, double bufferedMs, double targetMs, bool isPlaybackActive, long dropped, long overruns);
+
+    [LoggerMessage(EventId = 1105, Level = LogLevel.Warning,
+        Message = "Buffer overflow continues: +{NewDrops} samples dropped, total={Dropped}, overruns={Overruns}, " +
+                  "bufferedMs={BufferedMs:F0}, isPlaybackActive={IsPlaybackActive}")]
+    public static partial void BufferOverflowContinues(
+        this ILogger logger, long newDrops, long dropped, long overruns, double bufferedMs, bool isPlaybackActive);
+
+    #endregion
+}
@@ -49,7 +49,10 @@ public class BackendFactory
             _logger.LogInformation("Initializing PulseAudio backend");
             _backend = new PulseAudioBackend(
                 loggerFactory.CreateLogger<PulseAudioBackend>(),
-                volumeRunner);
+                volumeRunner,
+                loggerFactory,
+                customSinksService,
+                environment.IdleCorkMs);
         }
 
         _logger.LogInformation("Audio backend: {Backend}", _backend.Name);
@@ -140,6 +140,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
     private long _firstReadTime;
     private long _lastSuccessfulReadTime;
     private bool _hasEverReceivedSamples;
+    private volatile bool _lastReadWasEmpty;
 
     // Correction tracking for stats
     private long _totalDropped;
@@ -178,6 +179,11 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
     public long LastSuccessfulReadTime => _lastSuccessfulReadTime;
     /// <summary>Whether any samples have ever been received.</summary>
     public bool HasEverReceivedSamples => _hasEverReceivedSamples;
+    /// <summary>
+    /// Whether the most recent read found nothing in the timed buffer and returned only silence.
+    /// Lets the output tell an idle stream from audio (which <see cref="Read"/> cannot, as it always fills).
+    /// </summary>
+    public bool LastReadWasEmpty => _lastReadWasEmpty;
     /// <summary>Function to get current time in microseconds.</summary>
     public long CurrentTimeMicroseconds => _getCurrentTimeMicroseconds();
     /// <summary>Total samples dropped for sync correction.</summary>
@@ -210,17 +216,20 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
             throw new ArgumentException("Audio format must have at least one channel.", nameof(buffer));
         }
 
-        _logger?.LogInformation(
-            "BufferedAudioSampleSource initialized: channels={Channels}, sampleRate={SampleRate}, " +
-            "interpolation=3-point weighted with 2-point fallback",
-            _channels, _sampleRate);
+        _logger?.SampleSourceInitialized(_channels, _sampleRate);
     }
 
     /// <inheritdoc/>
     /// <remarks>
-    /// Uses <see cref="ArrayPool{T}.Shared"/> to avoid allocating temporary buffers on every
-    /// audio callback. Audio threads are real-time sensitive, and GC pauses from frequent
-    /// allocations can cause audible glitches.
+    /// <para>
+    /// When sync is within the deadband (the steady state), samples are read straight into
+    /// the caller's buffer - no staging buffer and no extra copy.
+    /// </para>
+    /// <para>
+    /// When a correction is due, uses <see cref="ArrayPool{T}.Shared"/> for the staging buffer
+    /// to avoid allocating on every audio callback. Audio threads are real-time sensitive,
+    /// and GC pauses from frequent allocations can cause audible glitches.
+    /// </para>
     /// </remarks>
     public int Read(float[] buffer, int offset, int count)
     {
@@ -236,12 +245,20 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
         // Initialize last output frame if needed
         _lastOutputFrame ??= new float[_channels];
 
-        // Rent a buffer from the pool to avoid GC allocations in the audio thread
-        var tempBuffer = ArrayPool<float>.Shared.Rent(count);
+        var output = buffer.AsSpan(offset, count);
+
+        // Fast path: no correction due, so the timed buffer can fill the output directly.
+        // Otherwise rent a staging buffer from the pool (no GC allocations in the audio thread).
+        var direct = IsWithinDeadband(currentTime);
+        var tempBuffer = direct ? null : ArrayPool<float>.Shared.Rent(count);
         try
         {
             // Read raw samples from the timed buffer (no SDK correction)
-            var rawRead = _buffer.ReadRaw(tempBuffer.AsSpan(0, count), currentTime);
+            var rawRead = direct
+                ? _buffer.ReadRaw(output, currentTime)
+                : _buffer.ReadRaw(tempBuffer.AsSpan(0, count), currentTime);
+
+            _lastReadWasEmpty = rawRead == 0;
 
             if (rawRead > 0)
             {
@@ -253,10 +270,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
                 {
                     _hasEverReceivedSamples = true;
                     var elapsedMs = (currentTime - _firstReadTime) / 1000.0;
-                    _logger?.LogInformation(
-                        "First samples received from buffer: elapsedMs={ElapsedMs:F1}, " +
-                        "totalReads={TotalReads}, zeroReads={ZeroReads}",
-                        elapsedMs, _totalReads, _zeroReads);
+                    _logger?.FirstSamplesReceived(elapsedMs, _totalReads, _zeroReads);
                 }
 
                 // Initialize _lastOutputFrame with real audio before any corrections.
@@ -264,13 +278,27 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
                 // without this, insertions would interpolate (0 + audio) / 2 = half volume clicks.
                 if (!_lastOutputFrameInitialized && rawRead >= _channels)
                 {
-                    tempBuffer.AsSpan(0, _channels).CopyTo(_lastOutputFrame);
+                    (direct ? output : tempBuffer.AsSpan()).Slice(0, _channels).CopyTo(_lastOutputFrame);
                     _lastOutputFrameInitialized = true;
                 }
 
-                // Apply correction and copy to output
-                var (outputCount, dropped, inserted) = ApplyCorrectionWithInterpolation(
-                    tempBuffer, rawRead, buffer.AsSpan(offset, count));
+                int outputCount, dropped, inserted;
+                if (direct)
+                {
+                    // Already in place - just remember the last frame for future corrections
+                    outputCount = rawRead;
+                    dropped = inserted = 0;
+                    if (rawRead >= _channels)
+                    {
+                        output.Slice(rawRead - _channels, _channels).CopyTo(_lastOutputFrame);
+                    }
+                }
+                else
+                {
+                    // Apply correction and copy to output
+                    (outputCount, dropped, inserted) = ApplyCorrectionWithInterpolation(
+                        tempBuffer!, rawRead, output);
+                }
 
                 // Notify SDK of corrections for accurate sync tracking
                 if (dropped > 0 || inserted > 0)
@@ -283,7 +311,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
                 // Fill remainder with silence if needed
                 if (outputCount < count)
                 {
-                    buffer.AsSpan(offset + outputCount, count - outputCount).Fill(0f);
+                    output.Slice(outputCount).Fill(0f);
                 }
             }
             else
@@ -292,12 +320,15 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
                 LogZeroRead(currentTime);
 
                 // Fill with silence
-                buffer.AsSpan(offset, count).Fill(0f);
+                output.Fill(0f);
             }
         }
         finally
         {
-            ArrayPool<float>.Shared.Return(tempBuffer, clearArray: false);
+            if (tempBuffer != null)
+            {
+                ArrayPool<float>.Shared.Return(tempBuffer, clearArray: false);
+            }
         }
 
         // Check for overruns (SDK dropping samples due to buffer full)
@@ -329,19 +360,14 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
     }
 
     /// <summary>
-    /// Applies sync correction with interpolation to minimize audible artifacts.
-    /// Uses 3-point weighted interpolation when sufficient lookahead is available in the input buffer,
-    /// falling back to 2-point linear interpolation otherwise.
+    /// Checks whether the smoothed sync error is inside the current deadband (no correction due).
+    /// Resets direction tracking when it is, so the next correction starts fresh.
     /// </summary>
-    /// <returns>Tuple of (output sample count, samples dropped, samples inserted).</returns>
-    private (int OutputCount, int SamplesDropped, int SamplesInserted) ApplyCorrectionWithInterpolation(
-        float[] input, int inputCount, Span<float> output)
+    private bool IsWithinDeadband(long currentTime)
     {
-        var syncError = _buffer.SmoothedSyncErrorMicroseconds;
-        var absError = Math.Abs((long)syncError);
+        var absError = Math.Abs((long)_buffer.SmoothedSyncErrorMicroseconds);
 
         // Track when corrections start being considered for startup deadband
-        var currentTime = _getCurrentTimeMicroseconds();
         if (_correctionStartTime == 0)
         {
             _correctionStartTime = currentTime;
@@ -354,12 +380,31 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
             ? StartupDeadbandMicroseconds
             : CorrectionThresholdMicroseconds;
 
-        // No correction needed if within deadband - reset direction tracking
-        if (absError < deadband)
+        if (absError >= deadband)
         {
-            _currentDirection = CorrectionDirection.None;
-            _directionChangeDebounceCounter = 0;
+            return false;
+        }
+
+        _currentDirection = CorrectionDirection.None;
+        _directionChangeDebounceCounter = 0;
+        return true;
+    }
+
+    /// <summary>
+    /// Applies sync correction with interpolation to minimize audible artifacts.
+    /// Uses 3-point weighted interpolation when sufficient lookahead is available in the input buffer,
+    /// falling back to 2-point linear interpolation otherwise.
+    /// </summary>
+    /// <returns>Tuple of (output sample count, samples dropped, samples inserted).</returns>
+    private (int OutputCount, int SamplesDropped, int SamplesInserted) ApplyCorrectionWithInterpolation(
+        float[] input, int inputCount, Span<float> output)
+    {
+        var syncError = _buffer.SmoothedSyncErrorMicroseconds;
+        var absError = Math.Abs((long)syncError);
 
+        // Error may have settled since Read() checked - re-check (resets direction tracking)
+        if (IsWithinDeadband(_getCurrentTimeMicroseconds()))
+        {
             // Just copy input to output
             var toCopy = Math.Min(inputCount, output.Length);
             input.AsSpan(0, toCopy).CopyTo(output);
@@ -569,11 +614,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
             reason = "Unknown";
         }
 
-        _logger.LogWarning(
-            "Read returned 0 [{Reason}]: currentTime={CurrentTime}μs, bufferedMs={BufferedMs:F0}, " +
-            "targetMs={TargetMs:F0}, isPlaybackActive={IsPlaybackActive}, syncError={SyncError:F1}ms, " +
-            "elapsedMs={ElapsedMs:F0}, sinceLastSuccessMs={SinceLastSuccess:F0}, " +
-            "zeroReads={ZeroReads}/{TotalReads}, overruns={Overruns}, underruns={Underruns}",
+        _logger.SourceZeroRead(
             reason,
             currentTime,
             stats.BufferedMs,
@@ -586,9 +627,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
             stats.OverrunCount,
             stats.UnderrunCount);
 
-        _logger.LogWarning(
-            "Buffer state: samplesWritten={Written}, samplesRead={Read}, " +
-            "droppedOverflow={DroppedOverflow}, droppedSync={DroppedSync}, insertedSync={InsertedSync}",
+        _logger.SourceBufferState(
             stats.TotalSamplesWritten,
             stats.TotalSamplesRead,
             stats.DroppedSamples,
@@ -616,11 +655,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
             if (!_hasLoggedOverrunStart)
             {
                 _hasLoggedOverrunStart = true;
-                _logger.LogError(
-                    "BUFFER OVERFLOW DETECTED: SDK is dropping samples because buffer is full and Read() isn't consuming. " +
-                    "bufferedMs={BufferedMs:F0}, targetMs={TargetMs:F0}, isPlaybackActive={IsPlaybackActive}, " +
-                    "totalDropped={Dropped}, overrunCount={Overruns}. " +
-                    "This indicates scheduled start time was never reached.",
+                _logger.BufferOverflowDetected(
                     stats.BufferedMs,
                     stats.TargetMs,
                     stats.IsPlaybackActive,
@@ -629,9 +664,7 @@ public sealed class BufferedAudioSampleSource : IAudioSampleSource
             }
             else if (newDrops > 10000 || newOverruns > 0)
             {
-                _logger.LogWarning(
-                    "Buffer overflow continues: +{NewDrops} samples dropped, total={Dropped}, overruns={Overruns}, " +
-                    "bufferedMs={BufferedMs:F0}, isPlaybackActive={IsPlaybackActive}",
+                _logger.BufferOverflowContinues(
                     newDrops, currentDropped, currentOverruns, stats.BufferedMs, stats.IsPlaybackActive);
             }
 
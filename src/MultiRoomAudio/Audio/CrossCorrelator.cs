@@ -0,0 +1,165 @@
+using System.Numerics;
+
+namespace MultiRoomAudio.Audio;
+
+/// <summary>
+/// Where a reference signal was found in a recording, from <see cref="CrossCorrelator.FindDelay"/>.
+/// </summary>
+/// <param name="DelayFrames">Offset of the reference in the recording, with sub-sample precision.</param>
+/// <param name="Confidence">
+/// 0-1: one minus the ratio of the strongest secondary peak to the main peak. Near 1 is a clean
+/// single arrival; near 0 means another offset matched about as well (noise, echo, clipping).
+/// </param>
+/// <param name="PeakToSidelobeDb">The same ratio in dB (capped at 120 dB for a noiseless match).</param>
+/// <param name="Inverted">Whether the recording is polarity-inverted relative to the reference.</param>
+internal readonly record struct CorrelationPeak(
+    double DelayFrames,
+    double Confidence,
+    double PeakToSidelobeDb,
+    bool Inverted);
+
+/// <summary>
+/// Finds a known signal in a recording by FFT cross-correlation.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Both signals are zero-padded to a power of two at least as long as both together, so the
+/// circular correlation from the FFT equals the linear one for every non-negative lag. The peak
+/// is located on the absolute correlation (an inverting amplifier still matches) and refined by
+/// fitting a parabola through it and its neighbours.
+/// </para>
+/// <para>
+/// Secondary peaks within <see cref="MainLobeMs"/> of the main one are the main lobe itself or
+/// early reflections off nearby surfaces and are not counted against the confidence.
+/// </para>
+/// </remarks>
+internal static class CrossCorrelator
+{
+    /// <summary>
+    /// Half-width of the region around the peak excluded from the sidelobe search.
+    /// </summary>
+    public const double MainLobeMs = 2.0;
+
+    /// <summary>
+    /// Finds the offset at which <paramref name="reference"/> best matches <paramref name="recording"/>.
+    /// </summary>
+    /// <param name="recording">Captured audio.</param>
+    /// <param name="reference">The signal that was played.</param>
+    /// <param name="sampleRate">Rate of both signals.</param>
+    /// <returns>The best match, or null if either signal is empty or silent.</returns>
+    public static CorrelationPeak? FindDelay(ReadOnlySpan<float> recording, ReadOnlySpan<float> reference, int sampleRate)
+    {
+        if (recording.IsEmpty || reference.IsEmpty)
+            return null;
+
+        var size = (int)BitOperations.RoundUpToPowerOf2((uint)(recording.Length + reference.Length));
+        var rec = new Complex[size];
+        var refSpectrum = new Complex[size];
+        for (var i = 0; i < recording.Length; i++)
+            rec[i] = recording[i];
+        for (var i = 0; i < reference.Length; i++)
+            refSpectrum[i] = reference[i];
+
+        Transform(rec, inverse: false);
+        Transform(refSpectrum, inverse: false);
+
+        // corr[k] = sum(recording[n + k] * reference[n])  <=>  REC(f) * conj(REF(f))
+        for (var i = 0; i < size; i++)
+            rec[i] *= Complex.Conjugate(refSpectrum[i]);
+
+        Transform(rec, inverse: true);
+
+        // Every offset within the recording is a candidate, including ones where the tail of the
+        // reference runs past its end, so a recording cut short still locates the start
+        var lags = recording.Length;
+        var peakLag = -1;
+        var peak = 0.0;
+        for (var k = 0; k < lags; k++)
+        {
+            var magnitude = Math.Abs(rec[k].Real);
+            if (magnitude > peak)
+            {
+                peak = magnitude;
+                peakLag = k;
+            }
+        }
+
+        if (peakLag < 0 || peak <= 0)
+            return null;
+
+        var mainLobe = Math.Max(1, (int)(sampleRate * MainLobeMs / 1000));
+        var sidelobe = 0.0;
+        for (var k = 0; k < lags; k++)
+        {
+            if (Math.Abs(k - peakLag) <= mainLobe)
+                continue;
+
+            sidelobe = Math.Max(sidelobe, Math.Abs(rec[k].Real));
+        }
+
+        // Parabolic interpolation through the peak and its neighbours
+        var delay = (double)peakLag;
+        if (peakLag > 0 && peakLag < lags - 1)
+        {
+            var before = Math.Abs(rec[peakLag - 1].Real);
+            var after = Math.Abs(rec[peakLag + 1].Real);
+            var curvature = before - 2 * peak + after;
+            if (curvature < 0)
+                delay += 0.5 * (before - after) / curvature;
+        }
+
+        var ratio = sidelobe / peak;
+        return new CorrelationPeak(
+            DelayFrames: delay,
+            Confidence: Math.Clamp(1 - ratio, 0, 1),
+            PeakToSidelobeDb: -20 * Math.Log10(Math.Max(ratio, 1e-6)),
+            Inverted: rec[peakLag].Real < 0);
+    }
+
+    /// <summary>
+    /// In-place iterative radix-2 FFT. The inverse is scaled by 1/N.
+    /// </summary>
+    /// <param name="data">Samples; the length must be a power of two.</param>
+    /// <param name="inverse">Compute the inverse transform.</param>
+    private static void Transform(Complex[] data, bool inverse)
+    {
+        var n = data.Length;
+
+        // Bit-reversal permutation
+        for (int i = 1, j = 0; i < n; i++)
+        {
+            var bit = n >> 1;
+            for (; (j & bit) != 0; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+
+            if (i < j)
+                (data[i], data[j]) = (data[j], data[i]);
+        }
+
+        var sign = inverse ? 1.0 : -1.0;
+        for (var length = 2; length <= n; length <<= 1)
+        {
+            var half = length >> 1;
+            var step = Complex.FromPolarCoordinates(1.0, sign * 2 * Math.PI / length);
+            for (var start = 0; start < n; start += length)
+            {
+                var twiddle = Complex.One;
+                for (var k = 0; k < half; k++)
+                {
+                    var even = data[start + k];
+                    var odd = data[start + k + half] * twiddle;
+                    data[start + k] = even + odd;
+                    data[start + k + half] = even - odd;
+                    twiddle *= step;
+                }
+            }
+        }
+
+        if (inverse)
+        {
+            for (var i = 0; i < n; i++)
+                data[i] /= n;
+        }
+    }
+}
@@ -0,0 +1,310 @@
+using System.Diagnostics;
+using MultiRoomAudio.Models;
+using Sendspin.SDK.Models;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// One physical sink of a <see cref="CombinedZonePlayer"/>, mixed into that card's router.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Each output reads the player's shared ring through its own cursor. On every write
+/// callback it works out which frame is audible right now (cursor minus the card's
+/// measured latency). The lead publishes that position; every other output compares
+/// its own with the lead's, extrapolated to the same instant.
+/// </para>
+/// <para>
+/// A large offset (first start, or after an underrun) is removed by moving the cursor.
+/// Small offsets are smoothed and corrected one frame per callback - dropping a frame when
+/// behind, repeating one when ahead - which tracks card clock drift of a few hundred ppm
+/// without audible artefacts.
+/// </para>
+/// </remarks>
+internal sealed class CombineOutput : IRoutedZone
+{
+    private readonly ILogger _logger;
+    private readonly CombinedZonePlayer _owner;
+    private readonly Func<PulseAudioChannelRouter> _acquireRouter;
+    private readonly int _cardChannels;
+
+    // Held from the first Attach until Release (see RoutedZonePlayer)
+    private volatile PulseAudioChannelRouter? _router;
+
+    private volatile int[] _routeSources = Array.Empty<int>();
+    private volatile int[] _routeTargets = Array.Empty<int>();
+    private volatile float _downmixGain = 1f;
+    private volatile float[]? _readBuffer;
+    private volatile GainRamp? _gainRamp;
+    private int _sampleRate;
+
+    // Touched only on this card's PA thread (and by Reset while the output is stopped)
+    private long _cursor;
+    private bool _aligned;
+    private bool _flowing;
+    private double _smoothedErrorFrames;
+
+    // Stats, written on the PA thread and read by Stats for Nerds
+    private double _lastOffsetMs;
+    private long _framesDropped;
+    private long _framesInserted;
+    private int _realignments;
+
+    /// <summary>
+    /// Frames mixed per write. Matches the router's write size.
+    /// </summary>
+    private const int FramesPerWrite = 6144;
+
+    /// <summary>
+    /// Offsets beyond this are removed at once by moving the cursor.
+    /// </summary>
+    private const double RealignThresholdMs = 20;
+
+    /// <summary>
+    /// Smoothed offset at which one frame per callback is dropped or repeated.
+    /// </summary>
+    private const double FineCorrectionThresholdMs = 0.25;
+
+    /// <summary>
+    /// Weight of each new offset measurement in the smoothed offset. Latency reported by
+    /// PA jitters by a fraction of a millisecond between callbacks.
+    /// </summary>
+    private const double SmoothingFactor = 0.05;
+
+    /// <summary>
+    /// A lead position older than this (lead underrun or corked) is not used.
+    /// </summary>
+    private static readonly TimeSpan ReferenceMaxAge = TimeSpan.FromMilliseconds(500);
+
+    /// <summary>
+    /// Physical sink this output plays to.
+    /// </summary>
+    public string Sink { get; }
+
+    public string SinkName => $"{_owner.SinkName} ({Sink})";
+
+    public bool IsPlaying => _owner.IsPlaying;
+
+    public bool IsActive => _owner.IsActive;
+
+    public int? OutputLatencyMs => _router?.OutputLatencyMs;
+
+    public bool IsLatencyLocked => _router?.IsLatencyLocked ?? false;
+
+    public CombineOutput(
+        ILogger logger,
+        CombinedZonePlayer owner,
+        string sink,
+        Func<PulseAudioChannelRouter> acquireRouter,
+        int cardChannels)
+    {
+        _logger = logger;
+        _owner = owner;
+        Sink = sink;
+        _acquireRouter = acquireRouter;
+        _cardChannels = cardChannels;
+    }
+
+    /// <summary>
+    /// Attaches to the card's router for a stream of <paramref name="format"/>.
+    /// </summary>
+    /// <remarks>
+    /// The stream's channels go to the card's first channels in order (front-left and
+    /// front-right on a stereo or surround card); a mono stream feeds both of them.
+    /// </remarks>
+    public void Attach(AudioFormat format)
+    {
+        var targets = Enumerable.Range(0, Math.Min(_cardChannels, Math.Max(format.Channels, 2))).ToArray();
+        var (sources, routeTargets, downmixGain) = PulseAudioChannelRouter.BuildRoutes(format.Channels, targets);
+
+        _routeSources = sources;
+        _routeTargets = routeTargets;
+        _downmixGain = downmixGain;
+        _readBuffer = new float[FramesPerWrite * format.Channels];
+        _gainRamp = new GainRamp(format.Channels, format.SampleRate);
+        _sampleRate = format.SampleRate;
+
+        _router ??= _acquireRouter();
+        _router.Attach(this, format.SampleRate);
+    }
+
+    /// <summary>
+    /// Attaches again if another zone on the card reopened the stream at its own rate while
+    /// this output was stopped.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">The card is now playing at another rate.</exception>
+    public void EnsureAttached()
+    {
+        var router = _router;
+        if (router == null || _sampleRate == 0 || router.IsAttached(this, _sampleRate))
+            return;
+
+        _logger.LogInformation("Combine output '{Output}' re-attaching to {Sink} at {SampleRate}Hz",
+            SinkName, Sink, _sampleRate);
+        router.Attach(this, _sampleRate);
+    }
+
+    /// <summary>
+    /// Returns to the start of the shared stream, unaligned.
+    /// </summary>
+    public void Reset()
+    {
+        _cursor = 0;
+        _aligned = false;
+        _flowing = false;
+        _smoothedErrorFrames = 0;
+        _lastOffsetMs = 0;
+    }
+
+    public void UpdatePlayback()
+    {
+        _router?.UpdatePlayback();
+    }
+
+    public long? GetAudioClockMicroseconds()
+    {
+        return _router?.GetAudioClockMicroseconds();
+    }
+
+    public void Release()
+    {
+        _router?.Release(this);
+        _router = null;
+        _readBuffer = null;
+        _gainRamp = null;
+    }
+
+    public CombineOutputStats GetStats()
+    {
+        var isLead = _owner.IsLead(this);
+        return new CombineOutputStats(
+            Sink: Sink,
+            IsLead: isLead,
+            OutputLatencyMs: OutputLatencyMs,
+            IsLatencyLocked: IsLatencyLocked,
+            OffsetMs: isLead ? 0 : Math.Round(_lastOffsetMs, 2),
+            FramesDropped: Interlocked.Read(ref _framesDropped),
+            FramesInserted: Interlocked.Read(ref _framesInserted),
+            Realignments: Volatile.Read(ref _realignments));
+    }
+
+    public void MixInto(Span<float> output, int outputChannels, int frames)
+    {
+        var router = _router;
+        var buffer = _readBuffer;
+        var gainRamp = _gainRamp;
+        var stride = _owner.Channels;
+        var rate = _owner.SampleRate;
+        if (!IsActive || router == null || buffer == null || gainRamp == null || stride == 0 || rate == 0)
+            return;
+
+        // Frame audible at this instant: everything before the cursor is queued or played
+        var now = Stopwatch.GetTimestamp();
+        var playhead = _cursor - router.CurrentLatencyMicroseconds * rate / 1_000_000.0;
+
+        var isLead = _owner.UpdateLead(this);
+        var drop = false;
+        var repeat = false;
+        if (!isLead && _flowing)
+        {
+            CorrectDrift(playhead, now, rate, out drop, out repeat);
+        }
+
+        if (drop)
+        {
+            _cursor++;
+        }
+
+        var wanted = repeat ? frames - 1 : frames;
+        var framesRead = _owner.ReadShared(this, ref _cursor, buffer.AsSpan(0, wanted * stride), wanted);
+
+        // Only publish or correct against positions where audio is actually flowing
+        _flowing = framesRead == wanted;
+        if (isLead && _flowing)
+        {
+            _owner.PublishReference(this, playhead, now);
+        }
+
+        if (framesRead == 0)
+            return;
+
+        if (drop)
+        {
+            Interlocked.Increment(ref _framesDropped);
+        }
+
+        if (repeat && _flowing)
+        {
+            buffer.AsSpan((framesRead - 1) * stride, stride).CopyTo(buffer.AsSpan(framesRead * stride, stride));
+            framesRead++;
+            Interlocked.Increment(ref _framesInserted);
+        }
+
+        if (isLead)
+        {
+            _owner.OnFirstAudio(router.OutputLatencyMs);
+        }
+
+        // Each output ramps its own copy of the stream; they all see the same volume changes
+        var gain = gainRamp.Process(buffer.AsSpan(0, framesRead * stride), _owner.Gain);
+
+        PulseAudioChannelRouter.ScatterFrames(
+            buffer, stride, output, outputChannels, framesRead,
+            _routeSources, _routeTargets, gain * _downmixGain);
+    }
+
+    /// <summary>
+    /// Compares this output's audible frame with the lead's and decides the correction.
+    /// Positive offset means this output is ahead (playing later audio than the lead).
+    /// </summary>
+    private void CorrectDrift(double playhead, long now, int rate, out bool drop, out bool repeat)
+    {
+        drop = false;
+        repeat = false;
+
+        if (!_owner.TryGetReference(out var referencePlayhead, out var referenceTimestamp))
+            return;
+
+        var age = Stopwatch.GetElapsedTime(referenceTimestamp, now);
+        if (age > ReferenceMaxAge)
+            return;
+
+        var offsetFrames = playhead - (referencePlayhead + age.TotalSeconds * rate);
+        var offsetMs = offsetFrames * 1000.0 / rate;
+        _lastOffsetMs = offsetMs;
+
+        if (!_aligned || Math.Abs(offsetMs) > RealignThresholdMs)
+        {
+            _cursor -= (long)Math.Round(offsetFrames);
+            _smoothedErrorFrames = 0;
+
+            if (_aligned)
+            {
+                Interlocked.Increment(ref _realignments);
+                _logger.LogDebug("Combined output {Sink} realigned by {Offset:F1}ms", Sink, offsetMs);
+            }
+
+            _aligned = true;
+            return;
+        }
+
+        _smoothedErrorFrames += (offsetFrames - _smoothedErrorFrames) * SmoothingFactor;
+
+        var thresholdFrames = FineCorrectionThresholdMs * rate / 1000.0;
+        if (_smoothedErrorFrames > thresholdFrames)
+        {
+            repeat = true;
+            _smoothedErrorFrames -= 1;
+        }
+        else if (_smoothedErrorFrames < -thresholdFrames)
+        {
+            drop = true;
+            _smoothedErrorFrames += 1;
+        }
+    }
+
+    public void OnRouterError(string message)
+    {
+        _owner.OnOutputError(Sink, message);
+    }
+}
@@ -0,0 +1,574 @@
+using MultiRoomAudio.Models;
+using Sendspin.SDK.Audio;
+using Sendspin.SDK.Models;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// IAudioPlayer for an in-process combine-sink: one decoded stream played on several
+/// physical sinks, each through its own <see cref="PulseAudioChannelRouter"/>.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Replaces <c>module-combine-sink</c>, whose adaptive resampler adds buffering and hides
+/// each device's latency. Here the sample source is read once into a shared ring of
+/// decoded frames; every <see cref="CombineOutput"/> keeps its own cursor into that ring,
+/// so the stream is decoded and pulled once however many outputs play it. Each output
+/// copies its frames out of the ring into its own staging buffer (the ring is shared
+/// across PA threads under a lock), then applies gain and scatters them into its card.
+/// </para>
+/// <para>
+/// The output with the highest latency is the lead: it needs each frame first, so it alone
+/// pulls the sample source, and its audio clock and latency are what the SDK syncs against.
+/// The other outputs trail it in the ring by their latency difference, compare their
+/// audible position with the lead's and correct drift by dropping or repeating single
+/// frames. If another output's latency grows past the lead's, it takes over.
+/// </para>
+/// <para>
+/// The ring bounds the latency difference that can be aligned; an output that falls
+/// further behind the lead than that is logged and plays out of step.
+/// </para>
+/// </remarks>
+public class CombinedZonePlayer : IAudioPlayer
+{
+    private readonly ILogger<CombinedZonePlayer> _logger;
+    private readonly object _lock = new();
+    private readonly CombineOutput[] _outputs;
+
+    // Read by the outputs' write callbacks on their PA threads
+    private volatile IAudioSampleSource? _sampleSource;
+    private volatile bool _isPlaying;
+    private volatile bool _isPaused;
+    private volatile bool _disposed;
+    private volatile float _volume = 1.0f;
+    private volatile bool _isMuted;
+
+    // Shared ring of decoded frames. Outputs run on different PA threads, so every
+    // access (and the upstream read that fills it) is under _ringLock.
+    private readonly object _ringLock = new();
+    private float[]? _ring;
+    private float[]? _pullBuffer;
+    private int _ringFrames;
+    private long _writeFrame;
+    private int _hasLoggedRingOverrun;
+
+    // Output that pulls the source; changed only under _ringLock
+    private volatile CombineOutput _lead;
+
+    // Lead output's audible position, published from its write callback
+    private double _referencePlayhead;
+    private long _referenceTimestamp;
+
+    private volatile int _channels;
+    private volatile int _sampleRate;
+
+    private AudioFormat? _currentFormat;
+    private DateTime _playbackStartTime;
+    private int _hasLoggedFirstAudio;
+
+    private const int InitialLatencyEstimateMs = 70;
+
+    /// <summary>
+    /// Largest latency difference between outputs the ring can align, in seconds. The ring
+    /// also holds two pulls on top of this for the writes in flight.
+    /// </summary>
+    private const int RingSeconds = 1;
+
+    /// <summary>
+    /// How much higher than the lead's an output's latency must be before it takes over.
+    /// Keeps outputs with near-equal latency from trading the lead back and forth.
+    /// </summary>
+    private const int LeadSwitchThresholdMs = 5;
+
+    /// <summary>
+    /// Frames read from the sample source per pull. Matches the routers' write size.
+    /// </summary>
+    private const int FramesPerPull = 6144;
+
+    /// <summary>
+    /// Name of the combine-sink this player represents.
+    /// </summary>
+    public string SinkName { get; }
+
+    /// <summary>
+    /// Physical sinks played, in configured order.
+    /// </summary>
+    public IReadOnlyList<string> Slaves => _outputs.Select(o => o.Sink).ToList();
+
+    public AudioPlayerState State { get; private set; } = AudioPlayerState.Uninitialized;
+
+    public float Volume
+    {
+        get => _volume;
+        set => _volume = Math.Clamp(value, 0f, 1f);
+    }
+
+    public bool IsMuted
+    {
+        get => _isMuted;
+        set => _isMuted = value;
+    }
+
+    /// <summary>
+    /// The lead output's latency. The other outputs absorb their own difference.
+    /// </summary>
+    public int OutputLatencyMs => _lead.OutputLatencyMs ?? InitialLatencyEstimateMs;
+
+    /// <summary>
+    /// Whether every output's latency measurement has locked.
+    /// </summary>
+    public bool IsLatencyLocked => _outputs.All(o => o.IsLatencyLocked);
+
+    internal bool IsPlaying => _isPlaying;
+
+    internal bool IsActive => _isPlaying && !_isPaused && !_disposed;
+
+    internal int Channels => _channels;
+
+    internal int SampleRate => _sampleRate;
+
+    /// <summary>
+    /// Software gain applied by every output.
+    /// </summary>
+    internal float Gain => _isMuted ? 0f : _volume;
+
+    public event EventHandler<AudioPlayerState>? StateChanged;
+    public event EventHandler<AudioPlayerError>? ErrorOccurred;
+
+    /// <param name="logger">Logger for diagnostic output.</param>
+    /// <param name="sinkName">Name of the combine-sink.</param>
+    /// <param name="outputs">Each slave sink with a factory returning its card's router (reference taken) and the card's channel count.</param>
+    internal CombinedZonePlayer(
+        ILogger<CombinedZonePlayer> logger,
+        string sinkName,
+        IReadOnlyList<(string Sink, Func<PulseAudioChannelRouter> AcquireRouter, int CardChannels)> outputs)
+    {
+        if (outputs.Count == 0)
+            throw new ArgumentException("A combined player needs at least one output", nameof(outputs));
+
+        _logger = logger;
+        SinkName = sinkName;
+        _outputs = outputs
+            .Select(o => new CombineOutput(logger, this, o.Sink, o.AcquireRouter, o.CardChannels))
+            .ToArray();
+        _lead = _outputs[0];
+    }
+
+    /// <summary>
+    /// Playback time of the lead output's stream, in Unix epoch microseconds.
+    /// </summary>
+    public long? GetAudioClockMicroseconds()
+    {
+        return _isPlaying && !_disposed ? _lead.GetAudioClockMicroseconds() : null;
+    }
+
+    /// <summary>
+    /// Per-output latency and drift correction, for Stats for Nerds.
+    /// </summary>
+    public IReadOnlyList<CombineOutputStats> GetOutputStats()
+    {
+        return _outputs.Select(o => o.GetStats()).ToList();
+    }
+
+    public Task InitializeAsync(AudioFormat format, CancellationToken cancellationToken = default)
+    {
+        if (_isPlaying)
+        {
+            Stop();
+        }
+
+        lock (_lock)
+        {
+            _disposed = false;
+
+            try
+            {
+                _logger.LogInformation(
+                    "Initializing combined zone '{Zone}': {SampleRate}Hz, {Channels}ch -> {Slaves}",
+                    SinkName, format.SampleRate, format.Channels, string.Join(", ", Slaves));
+
+                _channels = format.Channels;
+                _sampleRate = format.SampleRate;
+                _currentFormat = format;
+
+                lock (_ringLock)
+                {
+                    _ringFrames = format.SampleRate * RingSeconds + FramesPerPull * 2;
+                    _ring = new float[_ringFrames * format.Channels];
+                    _pullBuffer = new float[FramesPerPull * format.Channels];
+                }
+
+                ResetStream();
+
+                foreach (var output in _outputs)
+                {
+                    output.Attach(format);
+                }
+
+                SetState(AudioPlayerState.Stopped);
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "Failed to initialize combined zone '{Zone}'", SinkName);
+                SetState(AudioPlayerState.Error);
+                OnError("Initialization failed", ex);
+                throw;
+            }
+        }
+
+        return Task.CompletedTask;
+    }
+
+    public void SetSampleSource(IAudioSampleSource source)
+    {
+        _sampleSource = source;
+        _logger.LogDebug("Sample source set");
+    }
+
+    public void Play()
+    {
+        lock (_lock)
+        {
+            if (_ring == null)
+            {
+                _logger.LogWarning("Cannot play - not initialized");
+                return;
+            }
+
+            if (_isPlaying && !_isPaused)
+                return;
+
+            try
+            {
+                foreach (var output in _outputs)
+                {
+                    output.EnsureAttached();
+                }
+            }
+            catch (InvalidOperationException ex)
+            {
+                _logger.LogError(ex, "Combined zone '{Zone}' cannot play", SinkName);
+                SetState(AudioPlayerState.Error);
+                OnError(ex.Message, ex);
+                return;
+            }
+
+            // A resume keeps the ring and the outputs' alignment; a fresh start does not
+            if (!_isPlaying)
+            {
+                ResetStream();
+            }
+
+            _isPlaying = true;
+            _isPaused = false;
+            _hasLoggedFirstAudio = 0;
+            _playbackStartTime = DateTime.UtcNow;
+        }
+
+        UpdatePlayback();
+        SetState(AudioPlayerState.Playing);
+        _logger.LogInformation("Combined zone '{Zone}' playing on {Slaves}", SinkName, string.Join(", ", Slaves));
+    }
+
+    public void Pause()
+    {
+        lock (_lock)
+        {
+            if (!_isPlaying)
+                return;
+
+            _isPaused = true;
+        }
+
+        UpdatePlayback();
+        SetState(AudioPlayerState.Paused);
+        _logger.LogInformation("Combined zone '{Zone}' paused", SinkName);
+    }
+
+    public void Stop()
+    {
+        lock (_lock)
+        {
+            _isPlaying = false;
+            _isPaused = false;
+        }
+
+        UpdatePlayback();
+        SetState(AudioPlayerState.Stopped);
+        _logger.LogInformation("Combined zone '{Zone}' stopped", SinkName);
+    }
+
+    /// <summary>
+    /// Re-attaches to the same combine-sink (stream recovery). The outputs are bound to
+    /// their cards' routers, so switching to a different sink requires recreating the player.
+    /// </summary>
+    public async Task SwitchDeviceAsync(string? deviceId, CancellationToken cancellationToken = default)
+    {
+        if (!string.Equals(deviceId, SinkName, StringComparison.Ordinal))
+        {
+            throw new InvalidOperationException(
+                $"Combined zone '{SinkName}' cannot hot-switch to '{deviceId ?? "default"}'; restart the player instead");
+        }
+
+        var wasPlaying = State == AudioPlayerState.Playing;
+        var format = _currentFormat;
+
+        Stop();
+
+        if (format != null)
+        {
+            await InitializeAsync(format, cancellationToken);
+            if (wasPlaying)
+            {
+                Play();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Whether <paramref name="output"/> currently pulls the source and sets the clock.
+    /// </summary>
+    internal bool IsLead(CombineOutput output) => output == _lead;
+
+    /// <summary>
+    /// Makes <paramref name="output"/> the lead if its latency has grown past the lead's.
+    /// </summary>
+    /// <returns>Whether <paramref name="output"/> is the lead.</returns>
+    internal bool UpdateLead(CombineOutput output)
+    {
+        CombineOutput previous;
+        lock (_ringLock)
+        {
+            previous = _lead;
+            if (previous == output)
+                return true;
+
+            var latency = output.OutputLatencyMs ?? InitialLatencyEstimateMs;
+            var leadLatency = previous.OutputLatencyMs ?? InitialLatencyEstimateMs;
+            if (latency <= leadLatency + LeadSwitchThresholdMs)
+                return false;
+
+            _lead = output;
+            _referenceTimestamp = 0;
+        }
+
+        _logger.LogInformation(
+            "Combined zone '{Zone}' lead moved from {Previous} to {Output} (latency {Latency}ms)",
+            SinkName, previous.Sink, output.Sink, output.OutputLatencyMs);
+        return true;
+    }
+
+    /// <summary>
+    /// Copies up to <paramref name="frames"/> frames starting at <paramref name="cursor"/>
+    /// from the shared ring. Only the lead reads more from the sample source; the others
+    /// get what the lead has already pulled. Advances the cursor past what was copied.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Pulling from the lead's callback alone also keeps the SDK's clock reads, made from
+    /// inside <c>Read</c>, on the lead's own PA thread.
+    /// </para>
+    /// <para>
+    /// An output that has fallen further behind than the ring holds resumes at the oldest
+    /// frame kept; its drift correction then realigns it if it can.
+    /// </para>
+    /// </remarks>
+    /// <returns>Frames copied; fewer than requested while nothing more has been pulled.</returns>
+    internal int ReadShared(CombineOutput reader, ref long cursor, Span<float> destination, int frames)
+    {
+        var source = _sampleSource;
+        var channels = _channels;
+        if (source == null || channels == 0)
+            return 0;
+
+        lock (_ringLock)
+        {
+            var ring = _ring;
+            var pullBuffer = _pullBuffer;
+            if (ring == null || pullBuffer == null)
+                return 0;
+
+            var oldest = Math.Max(0, _writeFrame - _ringFrames);
+            if (cursor < oldest)
+            {
+                if (reader != _lead && Interlocked.Exchange(ref _hasLoggedRingOverrun, 1) == 0)
+                {
+                    _logger.LogWarning(
+                        "Combined zone '{Zone}': {Output} is {Behind:F0}ms behind {Lead}, more than the {Ring}s ring can align; it will play out of step",
+                        SinkName, reader.Sink, (_writeFrame - cursor) * 1000.0 / _sampleRate, _lead.Sink, RingSeconds);
+                }
+
+                cursor = oldest;
+            }
+
+            var missing = reader == _lead ? cursor + frames - _writeFrame : 0;
+            while (missing > 0)
+            {
+                var chunk = (int)Math.Min(missing, FramesPerPull);
+                var pulled = source.Read(pullBuffer, 0, chunk * channels) / channels;
+                if (pulled == 0)
+                    break;
+
+                CopyRing(pullBuffer.AsSpan(0, pulled * channels), ring, _writeFrame, channels, toRing: true);
+                _writeFrame += pulled;
+                missing -= pulled;
+
+                if (pulled < chunk)
+                    break;
+            }
+
+            var available = (int)Math.Clamp(_writeFrame - cursor, 0, frames);
+            if (available > 0)
+            {
+                CopyRing(destination[..(available * channels)], ring, cursor, channels, toRing: false);
+                cursor += available;
+            }
+
+            return available;
+        }
+    }
+
+    /// <summary>
+    /// Records the frame the lead output is playing at <paramref name="timestamp"/>.
+    /// </summary>
+    internal void PublishReference(CombineOutput from, double playhead, long timestamp)
+    {
+        lock (_ringLock)
+        {
+            if (from != _lead)
+                return;
+
+            _referencePlayhead = playhead;
+            _referenceTimestamp = timestamp;
+        }
+    }
+
+    /// <summary>
+    /// The lead output's most recent audible position, if it has published one.
+    /// </summary>
+    internal bool TryGetReference(out double playhead, out long timestamp)
+    {
+        lock (_ringLock)
+        {
+            playhead = _referencePlayhead;
+            timestamp = _referenceTimestamp;
+            return timestamp != 0;
+        }
+    }
+
+    /// <summary>
+    /// Called by the lead output the first time it plays audio.
+    /// </summary>
+    internal void OnFirstAudio(int latencyMs)
+    {
+        if (Interlocked.Exchange(ref _hasLoggedFirstAudio, 1) == 0)
+        {
+            _logger.FirstAudioReceived((DateTime.UtcNow - _playbackStartTime).TotalMilliseconds, 0, 0, 0, latencyMs);
+        }
+    }
+
+    /// <summary>
+    /// Called (off the PA thread) when one output's stream fails. Losing any output
+    /// fails the player, as module-combine-sink would lose the whole sink.
+    /// </summary>
+    internal void OnOutputError(string sink, string message)
+    {
+        if (_disposed || !_isPlaying)
+            return;
+
+        OnError($"{sink}: {message}");
+    }
+
+    /// <summary>
+    /// Empties the ring, returns every output to the start of the stream and makes the
+    /// output with the highest latency the lead.
+    /// </summary>
+    private void ResetStream()
+    {
+        lock (_ringLock)
+        {
+            _lead = _outputs.MaxBy(o => o.OutputLatencyMs ?? InitialLatencyEstimateMs)!;
+            _writeFrame = 0;
+            _hasLoggedRingOverrun = 0;
+            _referencePlayhead = 0;
+            _referenceTimestamp = 0;
+        }
+
+        foreach (var output in _outputs)
+        {
+            output.Reset();
+        }
+    }
+
+    private void UpdatePlayback()
+    {
+        foreach (var output in _outputs)
+        {
+            output.UpdatePlayback();
+        }
+    }
+
+    /// <summary>
+    /// Copies interleaved frames between a linear buffer and the ring at absolute frame
+    /// <paramref name="frame"/>, wrapping at the end of the ring.
+    /// </summary>
+    private void CopyRing(Span<float> linear, float[] ring, long frame, int channels, bool toRing)
+    {
+        var start = (int)(frame % _ringFrames) * channels;
+        var first = Math.Min(linear.Length, ring.Length - start);
+
+        if (toRing)
+        {
+            linear[..first].CopyTo(ring.AsSpan(start));
+            linear[first..].CopyTo(ring);
+        }
+        else
+        {
+            ring.AsSpan(start, first).CopyTo(linear);
+            ring.AsSpan(0, linear.Length - first).CopyTo(linear[first..]);
+        }
+    }
+
+    private void SetState(AudioPlayerState newState)
+    {
+        if (State != newState)
+        {
+            var oldState = State;
+            State = newState;
+            _logger.PlayerStateChanged(oldState, newState);
+            StateChanged?.Invoke(this, newState);
+        }
+    }
+
+    private void OnError(string message, Exception? ex = null)
+    {
+        ErrorOccurred?.Invoke(this, new AudioPlayerError(message, ex));
+    }
+
+    public ValueTask DisposeAsync()
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+                return ValueTask.CompletedTask;
+
+            _disposed = true;
+            _isPlaying = false;
+            _isPaused = false;
+        }
+
+        foreach (var output in _outputs)
+        {
+            output.Release();
+        }
+
+        lock (_ringLock)
+        {
+            _ring = null;
+            _pullBuffer = null;
+        }
+
+        _logger.LogInformation("Combined zone '{Zone}' disposed", SinkName);
+        return ValueTask.CompletedTask;
+    }
+}
@@ -0,0 +1,186 @@
+using System.Numerics;
+using System.Runtime.InteropServices;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// Applies a player's software volume to interleaved float audio, gliding between gain
+/// levels instead of stepping.
+/// </summary>
+/// <remarks>
+/// <para>
+/// A volume change used to take effect at the next write callback as a flat multiplier,
+/// which is an audible click on sustained material. Here a change starts a ramp of
+/// <see cref="RampMs"/> that moves the gain by an equal number of dB per frame, so a fade
+/// sounds even across its whole length. The ramp is sample-accurate and restarts from the
+/// current gain if the target moves again mid-ramp, so a volume knob sweep (applied every
+/// <c>HidVolumeCoalescer</c> frame) is one continuous glide.
+/// </para>
+/// <para>
+/// Ramps to and from silence run to <see cref="SilenceGain"/> (-60 dB) and snap to zero from
+/// there. Outside a ramp the gain is constant and callers fold it into their own multiply.
+/// </para>
+/// <para>
+/// Not thread-safe: owned by the write callback thread. Callers pass the target gain on each
+/// call, read from their volatile volume and mute fields.
+/// </para>
+/// </remarks>
+internal sealed class GainRamp
+{
+    /// <summary>
+    /// Length of a volume ramp. Matches the HID volume frame, so a knob sweep never steps.
+    /// </summary>
+    public const int RampMs = 50;
+
+    /// <summary>
+    /// Gain used in place of zero at the quiet end of a ramp (-60 dB).
+    /// </summary>
+    private const float SilenceGain = 0.001f;
+
+    private readonly int _channels;
+    private readonly int _rampFrames;
+
+    private bool _primed;
+    private float _current;
+    private float _target;
+    private float _ratio;
+    private int _framesLeft;
+
+    public GainRamp(int channels, int sampleRate)
+    {
+        _channels = Math.Max(channels, 1);
+        _rampFrames = Math.Max(sampleRate * RampMs / 1000, 1);
+    }
+
+    /// <summary>
+    /// Moves towards <paramref name="target"/>, applying any ramp to <paramref name="samples"/>
+    /// in place.
+    /// </summary>
+    /// <param name="samples">Interleaved samples, whole frames.</param>
+    /// <param name="target">Gain the player should be at (0 when muted).</param>
+    /// <returns>
+    /// The constant gain the caller still has to apply to <paramref name="samples"/>: the
+    /// current gain when no ramp is running, 1 when the samples have already been scaled.
+    /// </returns>
+    public float Process(Span<float> samples, float target)
+    {
+        // The first buffer plays at the configured volume rather than fading in from unity
+        if (!_primed)
+        {
+            _primed = true;
+            _current = target;
+            _target = target;
+        }
+
+        if (target != _target)
+        {
+            StartRamp(target);
+        }
+
+        if (_framesLeft == 0)
+            return _current;
+
+        var frames = samples.Length / _channels;
+        var rampFrames = Math.Min(frames, _framesLeft);
+        var rampSamples = rampFrames * _channels;
+
+        var gain = RampSamples(samples[..rampSamples], _channels, _current, _ratio);
+        _framesLeft -= rampFrames;
+        _current = _framesLeft == 0 ? _target : gain;
+
+        Scale(samples[rampSamples..], _current);
+        return 1f;
+    }
+
+    private void StartRamp(float target)
+    {
+        var from = Math.Max(_current, SilenceGain);
+        var to = Math.Max(target, SilenceGain);
+
+        _ratio = MathF.Pow(to / from, 1f / _rampFrames);
+        _current = from;
+        _target = target;
+        _framesLeft = _rampFrames;
+    }
+
+    /// <summary>
+    /// Multiplies each frame by a gain that grows by <paramref name="ratio"/> per frame.
+    /// </summary>
+    /// <returns>The gain for the frame after the last one processed.</returns>
+    /// <remarks>
+    /// When whole frames fit in a <see cref="Vector{T}"/>, each vector carries the gains of
+    /// its frames and steps by <c>ratio^(frames per vector)</c>; otherwise frames are scaled
+    /// one at a time.
+    /// </remarks>
+    private static float RampSamples(Span<float> samples, int channels, float gain, float ratio)
+    {
+        var i = 0;
+        var lanes = Vector<float>.Count;
+        if (Vector.IsHardwareAccelerated && lanes % channels == 0 && samples.Length >= lanes)
+        {
+            Span<float> laneGains = stackalloc float[lanes];
+            for (var lane = 0; lane < lanes; lane++)
+            {
+                laneGains[lane] = gain * MathF.Pow(ratio, lane / channels);
+            }
+
+            var gainVector = new Vector<float>(laneGains);
+            var stepVector = new Vector<float>(MathF.Pow(ratio, lanes / channels));
+            var vectors = MemoryMarshal.Cast<float, Vector<float>>(samples);
+            for (var v = 0; v < vectors.Length; v++)
+            {
+                vectors[v] *= gainVector;
+                gainVector *= stepVector;
+            }
+
+            i = vectors.Length * lanes;
+            gain = gainVector[0];
+        }
+
+        // Remaining frames (the vector loop always stops on a frame boundary)
+        for (; i < samples.Length; i += channels)
+        {
+            for (var c = 0; c < channels; c++)
+            {
+                samples[i + c] *= gain;
+            }
+            gain *= ratio;
+        }
+
+        return gain;
+    }
+
+    /// <summary>
+    /// Multiplies samples by a gain in place using SIMD (<see cref="Vector{T}"/>).
+    /// Unity gain is a no-op and zero gain (muted) is a plain fill.
+    /// </summary>
+    public static void Scale(Span<float> samples, float gain)
+    {
+        if (gain == 1f)
+            return;
+
+        if (gain == 0f)
+        {
+            samples.Clear();
+            return;
+        }
+
+        var i = 0;
+        if (Vector.IsHardwareAccelerated && samples.Length >= Vector<float>.Count)
+        {
+            var vectors = MemoryMarshal.Cast<float, Vector<float>>(samples);
+            var gainVector = new Vector<float>(gain);
+            for (var v = 0; v < vectors.Length; v++)
+            {
+                vectors[v] *= gainVector;
+            }
+            i = vectors.Length * Vector<float>.Count;
+        }
+
+        // Scalar tail
+        for (; i < samples.Length; i++)
+        {
+            samples[i] *= gain;
+        }
+    }
+}
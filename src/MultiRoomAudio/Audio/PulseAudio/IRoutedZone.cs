@@ -0,0 +1,38 @@
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// Something that mixes audio into a <see cref="PulseAudioChannelRouter"/>'s card stream.
+/// </summary>
+/// <remarks>
+/// Implemented by <see cref="RoutedZonePlayer"/> (one zone of a split card) and by
+/// <see cref="CombineOutput"/> (one physical output of an in-process combine-sink).
+/// Members other than <see cref="SinkName"/> are called on the router's PA thread or
+/// under the router's lock, so they must not block.
+/// </remarks>
+internal interface IRoutedZone
+{
+    /// <summary>
+    /// Name used in logs and errors.
+    /// </summary>
+    string SinkName { get; }
+
+    /// <summary>
+    /// Started and not stopped (paused counts as playing).
+    /// </summary>
+    bool IsPlaying { get; }
+
+    /// <summary>
+    /// Playing, not paused and not disposed: the stream must run for this zone.
+    /// </summary>
+    bool IsActive { get; }
+
+    /// <summary>
+    /// Adds the zone's next <paramref name="frames"/> frames into the card frame.
+    /// </summary>
+    void MixInto(Span<float> output, int outputChannels, int frames);
+
+    /// <summary>
+    /// The card's stream failed. Called on a thread-pool thread.
+    /// </summary>
+    void OnRouterError(string message);
+}
@@ -1,4 +1,5 @@
 using MultiRoomAudio.Models;
+using MultiRoomAudio.Services;
 using MultiRoomAudio.Utilities;
 using Sendspin.SDK.Audio;
 
@@ -8,19 +9,38 @@ namespace MultiRoomAudio.Audio.PulseAudio;
 /// PulseAudio audio backend implementation.
 /// Provides device enumeration, player creation, and volume control for PulseAudio sinks.
 /// </summary>
+/// <remarks>
+/// Remap and combine sinks configured with <c>in_process: true</c> have no PulseAudio sink.
+/// They are presented here as devices derived from their master (or first slave) sink.
+/// Players for them are <see cref="RoutedZonePlayer"/>s and <see cref="CombinedZonePlayer"/>s,
+/// sharing one <see cref="PulseAudioChannelRouter"/> per card.
+/// </remarks>
 public class PulseAudioBackend : IBackend
 {
     private readonly ILogger<PulseAudioBackend> _logger;
     private readonly VolumeCommandRunner _volumeRunner;
+    private readonly ILoggerFactory? _loggerFactory;
+    private readonly CustomSinksService? _customSinksService;
+    private readonly TimeSpan _idleCorkDelay;
+
+    // One router per master sink, shared by all routed zones on that card
+    private readonly Dictionary<string, PulseAudioChannelRouter> _routers = new(StringComparer.Ordinal);
+    private readonly object _routersLock = new();
 
     public string Name => "pulse";
 
     public PulseAudioBackend(
         ILogger<PulseAudioBackend> logger,
-        VolumeCommandRunner volumeRunner)
+        VolumeCommandRunner volumeRunner,
+        ILoggerFactory? loggerFactory = null,
+        CustomSinksService? customSinksService = null,
+        int idleCorkMs = 0)
     {
         _logger = logger;
         _volumeRunner = volumeRunner;
+        _loggerFactory = loggerFactory;
+        _customSinksService = customSinksService;
+        _idleCorkDelay = TimeSpan.FromMilliseconds(idleCorkMs);
 
         // Configure the device enumerator with a logger
         PulseAudioDeviceEnumerator.SetLogger(logger);
@@ -28,12 +48,24 @@ public class PulseAudioBackend : IBackend
 
     public IEnumerable<AudioDevice> GetOutputDevices()
     {
-        return PulseAudioDeviceEnumerator.GetOutputDevices();
+        var devices = PulseAudioDeviceEnumerator.GetOutputDevices().ToList();
+
+        foreach (var sink in GetRoutedZones())
+        {
+            var master = devices.FirstOrDefault(d => d.Id.Equals(GetPrimarySink(sink), StringComparison.OrdinalIgnoreCase));
+            if (master != null)
+            {
+                devices.Add(CreateRoutedZoneDevice(sink, master));
+            }
+        }
+
+        return devices;
     }
 
     public AudioDevice? GetDevice(string deviceId)
     {
-        return PulseAudioDeviceEnumerator.GetDevice(deviceId);
+        // Routed zones first: the enumerator also matches partial sink descriptions
+        return GetRoutedZoneDevice(deviceId) ?? PulseAudioDeviceEnumerator.GetDevice(deviceId);
     }
 
     public AudioDevice? GetDefaultDevice()
@@ -43,6 +75,18 @@ public class PulseAudioBackend : IBackend
 
     public bool ValidateDevice(string? deviceId, out string? errorMessage)
     {
+        if (!string.IsNullOrEmpty(deviceId) && GetRoutedZone(deviceId) is { } sink)
+        {
+            if (GetRoutedZoneDevice(deviceId) != null)
+            {
+                errorMessage = null;
+                return true;
+            }
+
+            errorMessage = $"Sink '{GetPrimarySink(sink)}' of routed sink '{deviceId}' not found.";
+            return false;
+        }
+
         return PulseAudioDeviceEnumerator.ValidateDevice(deviceId, out errorMessage);
     }
 
@@ -68,16 +112,178 @@ public class PulseAudioBackend : IBackend
 
     public IAudioPlayer CreatePlayer(string? deviceId, ILoggerFactory loggerFactory)
     {
+        if (!string.IsNullOrEmpty(deviceId) && GetRoutedZone(deviceId) is { } sink)
+        {
+            return sink.Type == CustomSinkType.Combine
+                ? CreateCombinedZonePlayer(sink, loggerFactory)
+                : CreateRoutedZonePlayer(sink, loggerFactory);
+        }
+
         _logger.LogDebug("Creating PulseAudio player for sink: {Sink} (float32 format, PulseAudio handles conversion)",
             deviceId ?? "default");
 
         return new PulseAudioPlayer(
             loggerFactory.CreateLogger<PulseAudioPlayer>(),
-            deviceId);
+            deviceId,
+            _idleCorkDelay);
     }
 
     public async Task<bool> SetVolumeAsync(string? deviceId, int volume, CancellationToken cancellationToken = default)
     {
+        // A routed zone has no sink of its own; its volume is the player's software gain
+        if (!string.IsNullOrEmpty(deviceId) && GetRoutedZone(deviceId) != null)
+        {
+            return false;
+        }
+
         return await _volumeRunner.SetVolumeAsync(deviceId, volume, cancellationToken);
     }
+
+    /// <summary>
+    /// Loaded remap and combine sinks that are routed in-process.
+    /// </summary>
+    private IEnumerable<CustomSinkResponse> GetRoutedZones()
+    {
+        return _customSinksService?.GetAllSinks().Sinks.Where(IsRoutedZone)
+            ?? Enumerable.Empty<CustomSinkResponse>();
+    }
+
+    private CustomSinkResponse? GetRoutedZone(string deviceId)
+    {
+        var sink = _customSinksService?.GetSink(deviceId);
+        return sink != null && IsRoutedZone(sink) ? sink : null;
+    }
+
+    private static bool IsRoutedZone(CustomSinkResponse sink)
+    {
+        return sink.InProcess &&
+               sink.State == CustomSinkState.Loaded &&
+               !string.IsNullOrEmpty(GetPrimarySink(sink));
+    }
+
+    /// <summary>
+    /// The physical sink a routed device is described by: a remap's master, or a combine's
+    /// first slave (the primary output).
+    /// </summary>
+    private static string? GetPrimarySink(CustomSinkResponse sink)
+    {
+        return sink.Type == CustomSinkType.Combine ? sink.Slaves?.FirstOrDefault() : sink.MasterSink;
+    }
+
+    private AudioDevice? GetRoutedZoneDevice(string deviceId)
+    {
+        var sink = GetRoutedZone(deviceId);
+        if (sink == null)
+            return null;
+
+        var master = PulseAudioDeviceEnumerator.GetDevice(GetPrimarySink(sink)!);
+        return master != null ? CreateRoutedZoneDevice(sink, master) : null;
+    }
+
+    /// <summary>
+    /// Describes a routed zone as a device: the master's hardware (rate, format, card) with
+    /// the zone's own name and channels. It has no PulseAudio index or stable identifiers.
+    /// A combine-sink keeps its primary output's channels.
+    /// </summary>
+    private static AudioDevice CreateRoutedZoneDevice(CustomSinkResponse sink, AudioDevice master)
+    {
+        var channels = sink.Type == CustomSinkType.Combine
+            ? master.ChannelMap ?? []
+            : (sink.ChannelMappings ?? []).Select(m => m.OutputChannel).ToArray();
+
+        return master with
+        {
+            Index = -1,
+            Id = sink.Name,
+            Name = sink.Description ?? sink.Name,
+            MaxChannels = channels.Length,
+            ChannelMap = channels,
+            IsDefault = false,
+            Identifiers = null,
+            Alias = null,
+            Hidden = false,
+            SinkType = sink.Type.ToString()
+        };
+    }
+
+    private IAudioPlayer CreateRoutedZonePlayer(CustomSinkResponse sink, ILoggerFactory loggerFactory)
+    {
+        var master = PulseAudioDeviceEnumerator.GetDevice(sink.MasterSink!)
+            ?? throw new InvalidOperationException($"Master sink '{sink.MasterSink}' not found");
+
+        var masterChannels = master.ChannelMap
+            ?? throw new InvalidOperationException($"Channel map of '{master.Id}' is unknown");
+
+        var targets = (sink.ChannelMappings ?? []).Select(m =>
+        {
+            var index = Array.FindIndex(masterChannels,
+                c => c.Equals(m.MasterChannel, StringComparison.OrdinalIgnoreCase));
+            return index >= 0
+                ? index
+                : throw new InvalidOperationException(
+                    $"Channel '{m.MasterChannel}' not found on '{master.Id}'. " +
+                    $"Available channels: {string.Join(", ", masterChannels)}");
+        }).ToArray();
+
+        if (targets.Length == 0)
+            throw new InvalidOperationException($"Routed sink '{sink.Name}' has no channel mappings");
+
+        _logger.LogDebug("Creating routed zone player for {Zone} on {Master} (channels {Targets})",
+            sink.Name, master.Id, string.Join(",", targets));
+
+        return new RoutedZonePlayer(
+            loggerFactory.CreateLogger<RoutedZonePlayer>(),
+            sink.Name,
+            master.Id,
+            () => AcquireRouter(master.Id, masterChannels),
+            targets);
+    }
+
+    private IAudioPlayer CreateCombinedZonePlayer(CustomSinkResponse sink, ILoggerFactory loggerFactory)
+    {
+        var outputs = (sink.Slaves ?? []).Select(slave =>
+        {
+            var device = PulseAudioDeviceEnumerator.GetDevice(slave)
+                ?? throw new InvalidOperationException($"Slave sink '{slave}' not found");
+            var channels = device.ChannelMap
+                ?? throw new InvalidOperationException($"Channel map of '{device.Id}' is unknown");
+
+            return (
+                Sink: device.Id,
+                AcquireRouter: (Func<PulseAudioChannelRouter>)(() => AcquireRouter(device.Id, channels)),
+                CardChannels: channels.Length);
+        }).ToList();
+
+        if (outputs.Count == 0)
+            throw new InvalidOperationException($"Combined sink '{sink.Name}' has no slaves");
+
+        _logger.LogDebug("Creating combined zone player for {Zone} over {Slaves}",
+            sink.Name, string.Join(", ", outputs.Select(o => o.Sink)));
+
+        return new CombinedZonePlayer(
+            loggerFactory.CreateLogger<CombinedZonePlayer>(),
+            sink.Name,
+            outputs);
+    }
+
+    /// <summary>
+    /// Returns the card's router with a reference taken, creating it if none is open.
+    /// </summary>
+    private PulseAudioChannelRouter AcquireRouter(string masterSink, string[] masterChannels)
+    {
+        lock (_routersLock)
+        {
+            if (!_routers.TryGetValue(masterSink, out var router) || !router.TryAddRef())
+            {
+                router = new PulseAudioChannelRouter(
+                    (ILogger?)_loggerFactory?.CreateLogger<PulseAudioChannelRouter>() ?? _logger,
+                    masterSink,
+                    masterChannels);
+                router.TryAddRef();
+                _routers[masterSink] = router;
+            }
+
+            return router;
+        }
+    }
 }
@@ -0,0 +1,383 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using Microsoft.Extensions.Logging;
+using static MultiRoomAudio.Audio.PulseAudio.PulseAudioNative;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// Records mono float audio from a PulseAudio source into memory through its own pa_stream.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Used by latency calibration: the source is a microphone in the room, or a sink's
+/// <c>.monitor</c> source for an electrical loopback. PulseAudio downmixes and resamples the
+/// source to the requested rate. Recording stops when the buffer is full or the capture is
+/// disposed.
+/// </para>
+/// <para>
+/// Each read callback pairs the frames recorded so far with the stream latency (how long ago the
+/// next sample was captured) and the local clock, giving the time the first sample was captured.
+/// For a monitor source PulseAudio reports a negative latency, so the time is when the sink will
+/// play the sample rather than when it was mixed.
+/// </para>
+/// </remarks>
+internal sealed class PulseAudioCapture : IDisposable
+{
+    private const int ConnectionTimeoutMs = 5000;
+
+    /// <summary>
+    /// Fragment size. Small, so the read callbacks give frequent timing estimates.
+    /// </summary>
+    private const int FragmentMs = 20;
+
+    /// <summary>
+    /// Start time estimates kept; the median of these is reported.
+    /// </summary>
+    private const int MaxStartEstimates = 64;
+
+    private readonly ILogger _logger;
+    private readonly string? _sourceName;
+    private readonly int _sampleRate;
+    private readonly float[] _samples;
+    private readonly List<double> _startEstimates = new(MaxStartEstimates);
+    private readonly TaskCompletionSource _firstData = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+    // PulseAudio async API handles
+    private IntPtr _mainloop = IntPtr.Zero;
+    private IntPtr _context = IntPtr.Zero;
+    private IntPtr _stream = IntPtr.Zero;
+
+    // CRITICAL: Store callbacks as fields to prevent GC collection
+    private ContextNotifyCallback? _contextStateCallback;
+    private StreamNotifyCallback? _streamStateCallback;
+    private StreamRequestCallback? _readCallback;
+
+    private volatile bool _contextReady;
+    private volatile bool _streamReady;
+    private volatile bool _closing;
+    private bool _disposed;
+
+    // Written on the PA thread, read under the mainloop lock
+    private int _frames;
+
+    private PulseAudioCapture(ILogger logger, string? sourceName, int sampleRate, int maxFrames)
+    {
+        _logger = logger;
+        _sourceName = sourceName;
+        _sampleRate = sampleRate;
+        _samples = new float[maxFrames];
+    }
+
+    /// <summary>
+    /// Completes when the first recorded data has arrived.
+    /// </summary>
+    public Task FirstData => _firstData.Task;
+
+    /// <summary>
+    /// Starts recording from a source.
+    /// </summary>
+    /// <param name="logger">Logger for diagnostic output.</param>
+    /// <param name="sourceName">PulseAudio source name, or null for the default source.</param>
+    /// <param name="sampleRate">Rate to record at.</param>
+    /// <param name="maxFrames">Frames to keep; later audio is discarded.</param>
+    /// <exception cref="InvalidOperationException">PulseAudio is not reachable or rejected the stream.</exception>
+    public static PulseAudioCapture Start(ILogger logger, string? sourceName, int sampleRate, int maxFrames)
+    {
+        if (maxFrames <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxFrames));
+
+        var capture = new PulseAudioCapture(logger, sourceName, sampleRate, maxFrames);
+        capture.Open();
+        return capture;
+    }
+
+    /// <summary>
+    /// Stops recording and returns what was captured.
+    /// </summary>
+    /// <returns>
+    /// The samples, and when the first of them was captured in <see cref="Stopwatch"/> time
+    /// (microseconds), or null if the stream reported no timing.
+    /// </returns>
+    public (float[] Samples, double? StartTimeUs) Stop()
+    {
+        float[] samples;
+        double? startTimeUs = null;
+
+        ThreadedMainloopLock(_mainloop);
+        try
+        {
+            _closing = true;
+            samples = _samples.AsSpan(0, _frames).ToArray();
+
+            if (_startEstimates.Count > 0)
+            {
+                _startEstimates.Sort();
+                startTimeUs = _startEstimates[_startEstimates.Count / 2];
+            }
+        }
+        finally
+        {
+            ThreadedMainloopUnlock(_mainloop);
+        }
+
+        CleanupResources();
+        return (samples, startTimeUs);
+    }
+
+    /// <summary>
+    /// Connects to PulseAudio and starts the record stream. Reads begin from the PA thread.
+    /// </summary>
+    private void Open()
+    {
+        try
+        {
+            _mainloop = ThreadedMainloopNew();
+            if (_mainloop == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to create PulseAudio mainloop");
+
+            var api = ThreadedMainloopGetApi(_mainloop);
+            _context = ContextNew(api, "MultiRoomAudio-Capture");
+            if (_context == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to create PulseAudio context");
+
+            _contextStateCallback = OnContextStateChanged;
+            ContextSetStateCallback(_context, _contextStateCallback, IntPtr.Zero);
+
+            if (ThreadedMainloopStart(_mainloop) < 0)
+                throw new InvalidOperationException("Failed to start PulseAudio mainloop");
+
+            var sampleSpec = new SampleSpec
+            {
+                Format = SampleFormat.FLOAT32LE,
+                Rate = (uint)_sampleRate,
+                Channels = 1
+            };
+
+            ThreadedMainloopLock(_mainloop);
+            try
+            {
+                if (ContextConnect(_context, null, 0, IntPtr.Zero) < 0)
+                    throw new InvalidOperationException("Failed to connect to PulseAudio server");
+
+                var timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+                while (!_contextReady)
+                {
+                    var state = ContextGetState(_context);
+                    if (state == ContextState.Failed || state == ContextState.Terminated)
+                        throw new InvalidOperationException($"PulseAudio context failed: {GetContextError(_context)}");
+                    if (DateTime.UtcNow > timeout)
+                        throw new TimeoutException("Timeout waiting for PulseAudio context");
+
+                    ThreadedMainloopWait(_mainloop);
+                }
+
+                _stream = StreamNew(_context, "Latency Calibration", ref sampleSpec, IntPtr.Zero);
+                if (_stream == IntPtr.Zero)
+                    throw new InvalidOperationException("Failed to create PulseAudio stream");
+
+                _streamStateCallback = OnStreamStateChanged;
+                _readCallback = OnReadCallback;
+                StreamSetStateCallback(_stream, _streamStateCallback, IntPtr.Zero);
+                StreamSetReadCallback(_stream, _readCallback, IntPtr.Zero);
+
+                var bufferAttr = new BufferAttr
+                {
+                    MaxLength = uint.MaxValue,
+                    TLength = uint.MaxValue,
+                    PreBuf = uint.MaxValue,
+                    MinReq = uint.MaxValue,
+                    FragSize = BytesForMs(ref sampleSpec, FragmentMs)
+                };
+
+                var flags = StreamFlags.AdjustLatency | StreamFlags.InterpolateTiming | StreamFlags.AutoTimingUpdate;
+                if (StreamConnectRecord(_stream, _sourceName, ref bufferAttr, flags) < 0)
+                    throw new InvalidOperationException($"Failed to connect PulseAudio record stream: {GetContextError(_context)}");
+
+                timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+                while (!_streamReady)
+                {
+                    var state = StreamGetState(_stream);
+                    if (state == StreamState.Failed || state == StreamState.Terminated)
+                        throw new InvalidOperationException(
+                            $"PulseAudio record stream failed: {GetContextError(_context)}. Source: {_sourceName ?? "default"}");
+                    if (DateTime.UtcNow > timeout)
+                        throw new TimeoutException("Timeout waiting for PulseAudio record stream");
+
+                    ThreadedMainloopWait(_mainloop);
+                }
+            }
+            finally
+            {
+                ThreadedMainloopUnlock(_mainloop);
+            }
+
+            _logger.LogDebug("Recording from {Source} at {Rate}Hz (up to {Frames} frames)",
+                _sourceName ?? "default source", _sampleRate, _samples.Length);
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "Failed to open record stream on {Source}", _sourceName ?? "default source");
+            CleanupResources();
+            throw;
+        }
+    }
+
+    private void OnContextStateChanged(IntPtr context, IntPtr userdata)
+    {
+        var state = ContextGetState(context);
+        _logger.ContextStateChanged(state);
+
+        if (state == ContextState.Ready)
+        {
+            _contextReady = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == ContextState.Failed || state == ContextState.Terminated)
+        {
+            _contextReady = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+
+            if (!_closing)
+                _firstData.TrySetException(new InvalidOperationException("PulseAudio connection lost"));
+        }
+    }
+
+    private void OnStreamStateChanged(IntPtr stream, IntPtr userdata)
+    {
+        var state = StreamGetState(stream);
+        _logger.StreamStateChanged(state);
+
+        if (state == StreamState.Ready)
+        {
+            _streamReady = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == StreamState.Failed || state == StreamState.Terminated)
+        {
+            _streamReady = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+
+            if (!_closing)
+            {
+                _firstData.TrySetException(new InvalidOperationException(
+                    $"Record stream on '{_sourceName ?? "default"}' failed: {GetContextError(_context)}"));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Copies recorded fragments into the buffer.
+    /// Runs on the PA mainloop thread (lock already held).
+    /// </summary>
+    private void OnReadCallback(IntPtr stream, UIntPtr nbytes, IntPtr userdata)
+    {
+        RecordStartEstimate(stream);
+
+        while (StreamPeek(stream, out var data, out var length) == 0 && (ulong)length > 0)
+        {
+            var frames = (int)((ulong)length / sizeof(float));
+            var space = _samples.Length - _frames;
+            var count = Math.Min(frames, space);
+
+            if (!_closing && count > 0)
+            {
+                var target = _samples.AsSpan(_frames, count);
+                if (data == IntPtr.Zero)
+                {
+                    // A hole: the source dropped data, keep the timeline intact
+                    target.Clear();
+                }
+                else
+                {
+                    Marshal.Copy(data, _samples, _frames, count);
+                }
+                _frames += count;
+            }
+
+            StreamDrop(stream);
+        }
+
+        if (_frames > 0)
+            _firstData.TrySetResult();
+    }
+
+    /// <summary>
+    /// Notes when the first sample was captured, from the capture delay of the next sample to be read.
+    /// </summary>
+    private void RecordStartEstimate(IntPtr stream)
+    {
+        if (_startEstimates.Count >= MaxStartEstimates || _frames >= _samples.Length)
+            return;
+
+        if (StreamGetLatency(stream, out var latencyUs, out var negative) != 0)
+            return;
+
+        var nowUs = Stopwatch.GetTimestamp() * 1_000_000.0 / Stopwatch.Frequency;
+        var capturedUs = negative != 0 ? nowUs + latencyUs : nowUs - latencyUs;
+        _startEstimates.Add(capturedUs - _frames * 1_000_000.0 / _sampleRate);
+    }
+
+    private void CleanupResources()
+    {
+        _closing = true;
+
+        if (_stream != IntPtr.Zero)
+        {
+            if (_mainloop != IntPtr.Zero)
+            {
+                ThreadedMainloopLock(_mainloop);
+                try
+                {
+                    StreamDisconnect(_stream);
+                }
+                finally
+                {
+                    ThreadedMainloopUnlock(_mainloop);
+                }
+            }
+            StreamUnref(_stream);
+            _stream = IntPtr.Zero;
+        }
+
+        if (_context != IntPtr.Zero)
+        {
+            if (_mainloop != IntPtr.Zero)
+            {
+                ThreadedMainloopLock(_mainloop);
+                try
+                {
+                    ContextDisconnect(_context);
+                }
+                finally
+                {
+                    ThreadedMainloopUnlock(_mainloop);
+                }
+            }
+            ContextUnref(_context);
+            _context = IntPtr.Zero;
+        }
+
+        if (_mainloop != IntPtr.Zero)
+        {
+            ThreadedMainloopStop(_mainloop);
+            ThreadedMainloopFree(_mainloop);
+            _mainloop = IntPtr.Zero;
+        }
+
+        _contextStateCallback = null;
+        _streamStateCallback = null;
+        _readCallback = null;
+        _contextReady = false;
+        _streamReady = false;
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+
+        _disposed = true;
+        CleanupResources();
+    }
+}
@@ -321,11 +321,7 @@ public static partial class PulseAudioCardEnumerator
     {
         var sinks = new List<string>();
 
-        // Extract identifier from card name (e.g., "alsa_card.pci-0000_01_00.0" → "pci-0000_01_00.0")
-        // Also handle BlueZ cards (e.g., "bluez_card.6C_5C_3D_3B_15_3F" → "6C_5C_3D_3B_15_3F")
-        var identifier = cardName
-            .Replace("alsa_card.", "")
-            .Replace("bluez_card.", "");
+        var identifier = GetCardSinkIdentifier(cardName);
         if (string.IsNullOrEmpty(identifier))
         {
             _logger?.LogWarning("Could not extract identifier from card name '{CardName}'", cardName);
@@ -401,9 +397,76 @@ public static partial class PulseAudioCardEnumerator
         return muteStates;
     }
 
+    /// <summary>
+    /// Gets mute state, volume and channel count for all sinks from a single pactl call.
+    /// </summary>
+    public static Dictionary<string, SinkControlState> GetSinkControlStates()
+    {
+        var states = new Dictionary<string, SinkControlState>(StringComparer.OrdinalIgnoreCase);
+
+        try
+        {
+            var output = RunPactl("list sinks");
+            if (string.IsNullOrEmpty(output))
+                return states;
+
+            foreach (var block in output.Split(new[] { "Sink #" }, StringSplitOptions.RemoveEmptyEntries))
+            {
+                var nameMatch = Regex.Match(block, @"Name:\s*(.+)$", RegexOptions.Multiline);
+                var muteMatch = Regex.Match(block, @"Mute:\s*(yes|no)", RegexOptions.Multiline | RegexOptions.IgnoreCase);
+                if (!nameMatch.Success || !muteMatch.Success)
+                    continue;
+
+                var volumeMatch = SinkVolumePercentRegex().Match(block);
+                var channelsMatch = SinkChannelsRegex().Match(block);
+
+                var name = nameMatch.Groups[1].Value.Trim();
+                states[name] = new SinkControlState(
+                    name,
+                    muteMatch.Groups[1].Value.Equals("yes", StringComparison.OrdinalIgnoreCase),
+                    volumeMatch.Success ? int.Parse(volumeMatch.Groups[1].Value) : null,
+                    channelsMatch.Success ? int.Parse(channelsMatch.Groups[1].Value) : 2);
+            }
+        }
+        catch (Exception ex)
+        {
+            _logger?.LogError(ex, "Failed to enumerate sink control states");
+        }
+
+        return states;
+    }
+
+    /// <summary>
+    /// Whether a sink belongs to a card (same identifier matching as <see cref="GetSinksByCard"/>).
+    /// </summary>
+    public static bool SinkBelongsToCard(string cardName, string sinkName)
+    {
+        var identifier = GetCardSinkIdentifier(cardName);
+        return !string.IsNullOrEmpty(identifier) &&
+               sinkName.Contains(identifier, StringComparison.OrdinalIgnoreCase);
+    }
+
+    /// <summary>
+    /// Extracts the identifier shared by a card and its sinks
+    /// (e.g., "alsa_card.pci-0000_01_00.0" → "pci-0000_01_00.0",
+    /// "bluez_card.6C_5C_3D_3B_15_3F" → "6C_5C_3D_3B_15_3F").
+    /// </summary>
+    private static string GetCardSinkIdentifier(string cardName)
+    {
+        return cardName
+            .Replace("alsa_card.", "")
+            .Replace("bluez_card.", "");
+    }
+
     private static string? RunPactl(string arguments) => PactlCommandRunner.Run(arguments);
 
     // Regex patterns for parsing pactl output
+    [GeneratedRegex(@"^\s*Volume:\s*[\w-]+:\s*\d+\s*/\s*(\d+)%", RegexOptions.Multiline)]
+    private static partial Regex SinkVolumePercentRegex();
+
+    [GeneratedRegex(@"Sample Specification:\s*\S+\s+(\d+)ch", RegexOptions.Multiline)]
+    private static partial Regex SinkChannelsRegex();
+
 
     [GeneratedRegex(@"^(\d+)", RegexOptions.Multiline)]
     private static partial Regex CardIndexRegex();
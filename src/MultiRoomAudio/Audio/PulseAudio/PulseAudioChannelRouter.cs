@@ -0,0 +1,825 @@
+using System.Numerics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using static MultiRoomAudio.Audio.PulseAudio.PulseAudioNative;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// Plays several zones carved from one multichannel card through a single pa_stream.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Replaces one <c>module-remap-sink</c> plus one player stream per zone. The router opens
+/// one FLOAT32 stream on the master sink using the sink's own channel map, so PulseAudio
+/// neither remaps nor mixes. In the write callback each playing <see cref="IRoutedZone"/>
+/// (a <see cref="RoutedZonePlayer"/>, or a <see cref="CombineOutput"/> of an in-process
+/// combine-sink) reads its audio and the frames are scattered into the card's interleaved layout.
+/// </para>
+/// <para>
+/// All zones on the card share one hardware clock (<see cref="GetAudioClockMicroseconds"/>)
+/// and one latency measurement, so they cannot drift against each other.
+/// The router is reference counted by its zone players and closes its stream when the
+/// last one is disposed.
+/// </para>
+/// </remarks>
+internal sealed class PulseAudioChannelRouter
+{
+    private readonly ILogger _logger;
+    private readonly object _lock = new();
+    private readonly string[] _masterChannels;
+
+    // PulseAudio async API handles
+    private IntPtr _mainloop = IntPtr.Zero;
+    private IntPtr _context = IntPtr.Zero;
+    private IntPtr _stream = IntPtr.Zero;
+
+    // CRITICAL: Store callbacks as fields to prevent GC collection
+    private ContextNotifyCallback? _contextStateCallback;
+    private StreamNotifyCallback? _streamStateCallback;
+    private StreamRequestCallback? _writeCallback;
+    private StreamNotifyCallback? _underflowCallback;
+
+    private volatile bool _contextReady;
+    private volatile bool _streamReady;
+    private volatile bool _uncorked;
+    private volatile bool _closing;
+
+    // Zones attached to the stream. Replaced (never mutated) under _lock so the
+    // write callback can iterate its snapshot without locking.
+    private volatile IRoutedZone[] _zones = Array.Empty<IRoutedZone>();
+
+    private int _refCount;
+    private bool _closed;
+    private int _sampleRate;
+
+    // Interleaved output frames for the whole card, written straight to PA
+    private volatile float[]? _frameBuffer;
+
+    // Pre-allocated silence buffer for callbacks while nothing is ready
+    private byte[] _silenceBuffer = new byte[8192];
+
+    /// <summary>
+    /// Target buffer size in milliseconds. Matches <see cref="PulseAudioPlayer"/>.
+    /// </summary>
+    private const int BufferMs = 50;
+
+    private const int InitialLatencyEstimateMs = 70;
+
+    /// <summary>
+    /// Frames mixed per write. At 48kHz, 6144 frames = ~128ms.
+    /// </summary>
+    private const int FramesPerWrite = 6144;
+
+    private const int ConnectionTimeoutMs = 10000;
+
+    private const int UnderflowWarningThreshold = 5;
+
+    // Latency lock-in, as in PulseAudioPlayer: skip warmup samples, then freeze to the median
+    private volatile bool _latencyLocked;
+    private List<int>? _latencySamples;
+    private const int LatencyLockSampleCount = 100;
+    private const int LatencyLockWarmupSamples = 20;
+    private const int MaxReasonableLatencyMs = 200;
+
+    private long _callbackCount;
+    private int _underflowCount;
+
+    // Raw pa_stream_get_latency of the current write callback, read by zones during MixInto
+    private long _currentLatencyUs;
+    private DateTime _playbackStartTime;
+
+    /// <summary>
+    /// Stream handles and audio clock baseline captured at uncork (see PulseAudioPlayer.Play).
+    /// </summary>
+    private sealed record AudioClock(
+        IntPtr Mainloop,
+        IntPtr Stream,
+        long PlaybackStartUnixMicroseconds,
+        long StreamTimeAtUncorkMicroseconds);
+
+    // Published for GetAudioClockMicroseconds, which must not take _lock (see there); null while corked
+    private volatile AudioClock? _clock;
+
+    /// <summary>
+    /// Master (physical) sink this router plays to.
+    /// </summary>
+    public string MasterSink { get; }
+
+    /// <summary>
+    /// Channel count of the master sink, and of every frame written to it.
+    /// </summary>
+    public int Channels => _masterChannels.Length;
+
+    /// <summary>
+    /// Shared output latency for every zone on this card.
+    /// </summary>
+    public int OutputLatencyMs { get; private set; } = InitialLatencyEstimateMs;
+
+    /// <summary>
+    /// Whether the shared latency measurement has locked.
+    /// </summary>
+    public bool IsLatencyLocked => _latencyLocked;
+
+    /// <summary>
+    /// Rate the stream is open at, or 0 before the first zone attaches.
+    /// </summary>
+    public int SampleRate => _sampleRate;
+
+    /// <summary>
+    /// Unsmoothed output latency measured at the start of the current write callback.
+    /// Only meaningful inside <see cref="IRoutedZone.MixInto"/>, which runs on the same thread.
+    /// </summary>
+    public long CurrentLatencyMicroseconds => _currentLatencyUs;
+
+    /// <summary>
+    /// Creates a router for a master sink.
+    /// </summary>
+    /// <param name="logger">Logger for diagnostic output.</param>
+    /// <param name="masterSink">PulseAudio name of the physical sink.</param>
+    /// <param name="masterChannels">The sink's channel map, in device order.</param>
+    public PulseAudioChannelRouter(ILogger logger, string masterSink, string[] masterChannels)
+    {
+        _logger = logger;
+        MasterSink = masterSink;
+        _masterChannels = masterChannels;
+    }
+
+    /// <summary>
+    /// Takes a reference for a new zone player.
+    /// </summary>
+    /// <returns>False if the router has already closed; the caller must create a new one.</returns>
+    public bool TryAddRef()
+    {
+        lock (_lock)
+        {
+            if (_closed)
+                return false;
+
+            _refCount++;
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Attaches a zone to the stream, opening it at <paramref name="sampleRate"/> if needed.
+    /// </summary>
+    /// <remarks>
+    /// Zones on one card share a stream, so they must share a sample rate. If the stream is
+    /// open at another rate and no other zone is playing, it is reopened at the new rate and
+    /// the stopped zones, set up for the old rate, are detached (they attach again through
+    /// <see cref="IsAttached"/> before they next play); otherwise the zone is rejected.
+    /// </remarks>
+    /// <exception cref="InvalidOperationException">The card is playing at another rate, or PA failed.</exception>
+    public void Attach(IRoutedZone zone, int sampleRate)
+    {
+        lock (_lock)
+        {
+            if (_closed)
+                throw new ObjectDisposedException(nameof(PulseAudioChannelRouter));
+
+            var others = _zones.Where(z => z != zone).ToArray();
+
+            if (_stream != IntPtr.Zero && _streamReady && _sampleRate != sampleRate)
+            {
+                if (others.Any(z => z.IsPlaying))
+                {
+                    throw new InvalidOperationException(
+                        $"Sink '{MasterSink}' is already routing zones at {_sampleRate}Hz; " +
+                        $"zone '{zone.SinkName}' needs {sampleRate}Hz");
+                }
+
+                _logger.LogInformation("Reopening routed stream on {Sink}: {OldRate}Hz -> {NewRate}Hz ({Detached} stopped zones detached)",
+                    MasterSink, _sampleRate, sampleRate, others.Length);
+                CleanupResources();
+                others = Array.Empty<IRoutedZone>();
+            }
+
+            if (_stream == IntPtr.Zero || !_streamReady)
+            {
+                CleanupResources();
+                OpenStream(sampleRate);
+            }
+
+            _zones = others.Append(zone).ToArray();
+        }
+    }
+
+    /// <summary>
+    /// Whether a zone is attached to the stream at <paramref name="sampleRate"/>. False once
+    /// another zone has reopened the stream at a different rate.
+    /// </summary>
+    public bool IsAttached(IRoutedZone zone, int sampleRate)
+    {
+        lock (_lock)
+        {
+            return !_closed && _streamReady && _sampleRate == sampleRate && _zones.Contains(zone);
+        }
+    }
+
+    /// <summary>
+    /// Re-evaluates corking after a zone starts, pauses or stops.
+    /// </summary>
+    /// <remarks>
+    /// The stream runs while any zone is playing. When the last zone pauses the stream is
+    /// corked; when the last zone stops, queued audio is also flushed.
+    /// </remarks>
+    public void UpdatePlayback()
+    {
+        lock (_lock)
+        {
+            if (_stream == IntPtr.Zero || _mainloop == IntPtr.Zero)
+                return;
+
+            var zones = _zones;
+            var anyActive = zones.Any(z => z.IsActive);
+            var anyPlaying = zones.Any(z => z.IsPlaying);
+
+            ThreadedMainloopLock(_mainloop);
+            try
+            {
+                if (anyActive && !_uncorked)
+                {
+                    _callbackCount = 0;
+                    _underflowCount = 0;
+                    _playbackStartTime = DateTime.UtcNow;
+
+                    StreamCork(_stream, 0, IntPtr.Zero, IntPtr.Zero);
+                    _uncorked = true;
+
+                    // Capture the audio clock baseline immediately after uncork
+                    var startUs = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() * 1000;
+                    var streamTimeAtUncork = StreamGetTime(_stream, out var streamTime) == 0 ? (long)streamTime : 0;
+                    _clock = new AudioClock(_mainloop, _stream, startUs, streamTimeAtUncork);
+
+                    _logger.LogInformation("Routed stream on {Sink} started ({Count} zones attached)",
+                        MasterSink, zones.Length);
+                }
+                else if (!anyActive && _uncorked)
+                {
+                    StreamCork(_stream, 1, IntPtr.Zero, IntPtr.Zero);
+                    _uncorked = false;
+                    _clock = null;
+
+                    if (!anyPlaying)
+                    {
+                        StreamFlush(_stream, IntPtr.Zero, IntPtr.Zero);
+                    }
+
+                    _logger.LogInformation("Routed stream on {Sink} idle (corked)", MasterSink);
+                }
+            }
+            finally
+            {
+                ThreadedMainloopUnlock(_mainloop);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Detaches a zone and drops its reference. Closes the stream with the last reference.
+    /// </summary>
+    public void Release(IRoutedZone zone)
+    {
+        lock (_lock)
+        {
+            _zones = _zones.Where(z => z != zone).ToArray();
+
+            if (--_refCount <= 0)
+            {
+                _closed = true;
+                CleanupResources();
+                _logger.LogInformation("Routed stream on {Sink} closed", MasterSink);
+                return;
+            }
+        }
+
+        // Other zones remain: cork if the released zone was the last active one
+        UpdatePlayback();
+    }
+
+    /// <summary>
+    /// Playback time of the shared stream as Unix epoch microseconds, or null if not playing.
+    /// Same clock domain and conversion as <see cref="PulseAudioPlayer.GetAudioClockMicroseconds"/>.
+    /// </summary>
+    public long? GetAudioClockMicroseconds()
+    {
+        // No _lock here: zones call this from MixInto on the PA thread, which holds the
+        // mainloop lock, while UpdatePlayback and Attach hold _lock and wait for the mainloop
+        // lock. Read the baseline published at uncork instead.
+        var clock = _clock;
+        if (clock == null)
+            return null;
+
+        var mainloop = clock.Mainloop;
+        var stream = clock.Stream;
+        var startTimeUs = clock.PlaybackStartUnixMicroseconds;
+        var streamTimeAtUncork = clock.StreamTimeAtUncorkMicroseconds;
+
+        var inCallbackThread = ThreadedMainloopInThread(mainloop) != 0;
+        if (!inCallbackThread)
+        {
+            ThreadedMainloopLock(mainloop);
+        }
+
+        try
+        {
+            return StreamGetTime(stream, out var streamTimeUs) == 0
+                ? startTimeUs + (long)streamTimeUs - streamTimeAtUncork
+                : null;
+        }
+        finally
+        {
+            if (!inCallbackThread)
+            {
+                ThreadedMainloopUnlock(mainloop);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Connects to PulseAudio and opens the corked stream. Caller holds _lock.
+    /// </summary>
+    private void OpenStream(int sampleRate)
+    {
+        _logger.LogInformation("Opening routed stream on {Sink}: {SampleRate}Hz, {Channels}ch ({Map})",
+            MasterSink, sampleRate, Channels, string.Join(",", _masterChannels));
+
+        try
+        {
+            _mainloop = ThreadedMainloopNew();
+            if (_mainloop == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to create PulseAudio mainloop");
+
+            var api = ThreadedMainloopGetApi(_mainloop);
+            if (api == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to get PulseAudio mainloop API");
+
+            _context = ContextNew(api, "MultiRoomAudio");
+            if (_context == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to create PulseAudio context");
+
+            _contextStateCallback = OnContextStateChanged;
+            ContextSetStateCallback(_context, _contextStateCallback, IntPtr.Zero);
+
+            if (ThreadedMainloopStart(_mainloop) < 0)
+                throw new InvalidOperationException("Failed to start PulseAudio mainloop");
+
+            var sampleSpec = new SampleSpec
+            {
+                Format = SampleFormat.FLOAT32LE,
+                Rate = (uint)sampleRate,
+                Channels = (byte)Channels
+            };
+
+            // Use the card's own channel layout so PA passes frames through untouched
+            var channelMap = new ChannelMap { Map = new int[ChannelsMax] };
+            if (ChannelMapParse(ref channelMap, string.Join(",", _masterChannels)) == IntPtr.Zero)
+                throw new InvalidOperationException(
+                    $"Unrecognised channel map for '{MasterSink}': {string.Join(",", _masterChannels)}");
+
+            ThreadedMainloopLock(_mainloop);
+            try
+            {
+                if (ContextConnect(_context, null, 0, IntPtr.Zero) < 0)
+                    throw new InvalidOperationException("Failed to connect to PulseAudio server");
+
+                var timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+                while (!_contextReady)
+                {
+                    var state = ContextGetState(_context);
+                    if (state == ContextState.Failed || state == ContextState.Terminated)
+                        throw new InvalidOperationException($"PulseAudio context failed: {GetContextError(_context)}");
+                    if (DateTime.UtcNow > timeout)
+                        throw new TimeoutException("Timeout waiting for PulseAudio context");
+
+                    ThreadedMainloopWait(_mainloop);
+                }
+
+                _stream = StreamNew(_context, "Sendspin Routed Zones", ref sampleSpec, ref channelMap);
+                if (_stream == IntPtr.Zero)
+                    throw new InvalidOperationException("Failed to create PulseAudio stream");
+
+                _streamStateCallback = OnStreamStateChanged;
+                _writeCallback = OnWriteCallback;
+                _underflowCallback = OnUnderflow;
+                StreamSetStateCallback(_stream, _streamStateCallback, IntPtr.Zero);
+                StreamSetWriteCallback(_stream, _writeCallback, IntPtr.Zero);
+                StreamSetUnderflowCallback(_stream, _underflowCallback, IntPtr.Zero);
+
+                var targetLatencyBytes = BytesForMs(ref sampleSpec, BufferMs);
+                var bufferAttr = new BufferAttr
+                {
+                    MaxLength = uint.MaxValue,
+                    TLength = targetLatencyBytes,
+                    PreBuf = targetLatencyBytes / 2,
+                    MinReq = BytesForMs(ref sampleSpec, 10),
+                    FragSize = uint.MaxValue
+                };
+
+                // Same flags as PulseAudioPlayer: start corked, interpolated timing, and
+                // DontMove so a lost card fails the stream instead of moving every zone.
+                var flags = StreamFlags.StartCorked |
+                            StreamFlags.InterpolateTiming |
+                            StreamFlags.AutoTimingUpdate |
+                            StreamFlags.AdjustLatency |
+                            StreamFlags.DontMove;
+
+                if (StreamConnectPlayback(_stream, MasterSink, ref bufferAttr, flags, IntPtr.Zero, IntPtr.Zero) < 0)
+                    throw new InvalidOperationException("Failed to connect PulseAudio stream");
+
+                timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+                while (!_streamReady)
+                {
+                    var state = StreamGetState(_stream);
+                    if (state == StreamState.Failed || state == StreamState.Terminated)
+                        throw new InvalidOperationException(
+                            $"PulseAudio stream failed: {GetContextError(_context)}. Sink: {MasterSink}");
+                    if (DateTime.UtcNow > timeout)
+                        throw new TimeoutException("Timeout waiting for PulseAudio stream");
+
+                    ThreadedMainloopWait(_mainloop);
+                }
+
+                StreamUpdateTimingInfo(_stream, IntPtr.Zero, IntPtr.Zero);
+            }
+            finally
+            {
+                ThreadedMainloopUnlock(_mainloop);
+            }
+
+            _sampleRate = sampleRate;
+            _frameBuffer = new float[FramesPerWrite * Channels];
+            _latencyLocked = false;
+            _latencySamples = null;
+            OutputLatencyMs = InitialLatencyEstimateMs;
+        }
+        catch (Exception ex)
+        {
+            _logger.LogError(ex, "Failed to open routed stream on {Sink}", MasterSink);
+            CleanupResources();
+            throw;
+        }
+    }
+
+    private void OnContextStateChanged(IntPtr context, IntPtr userdata)
+    {
+        var state = ContextGetState(context);
+        _logger.ContextStateChanged(state);
+
+        if (state == ContextState.Ready)
+        {
+            _contextReady = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == ContextState.Failed || state == ContextState.Terminated)
+        {
+            _contextReady = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+    }
+
+    private void OnStreamStateChanged(IntPtr stream, IntPtr userdata)
+    {
+        var state = StreamGetState(stream);
+        _logger.StreamStateChanged(state);
+
+        if (state == StreamState.Ready)
+        {
+            _streamReady = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == StreamState.Failed || state == StreamState.Terminated)
+        {
+            _streamReady = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+
+            if (_closing)
+            {
+                _logger.StreamDisconnectedExpected(state, MasterSink);
+                return;
+            }
+
+            var errorMsg = _context != IntPtr.Zero ? GetContextError(_context) : "Unknown";
+            _logger.StreamDisconnected(state, errorMsg, MasterSink);
+
+            // Every zone on the card lost its device. Dispatch off the PA thread, which
+            // holds the mainloop lock that the players' error handlers will need.
+            var zones = _zones;
+            var error = $"Audio device lost: {errorMsg}";
+            ThreadPool.QueueUserWorkItem(_ =>
+            {
+                foreach (var zone in zones)
+                {
+                    zone.OnRouterError(error);
+                }
+            });
+        }
+    }
+
+    /// <summary>
+    /// Called by PulseAudio when it needs more audio for the card.
+    /// </summary>
+    /// <remarks>
+    /// Runs on the PA mainloop thread (lock already held). Each playing zone reads from its
+    /// own sample source and is scattered into the card frame; a zone that has nothing yet
+    /// (before its scheduled start) simply leaves its channels silent.
+    /// </remarks>
+    private void OnWriteCallback(IntPtr stream, UIntPtr nbytes, IntPtr userdata)
+    {
+        _callbackCount++;
+
+        var frameBuffer = _frameBuffer;
+        if (!_uncorked || frameBuffer == null)
+        {
+            WriteSilence(stream, nbytes);
+            return;
+        }
+
+        if (StreamGetLatency(stream, out var latencyUs, out var negative) == 0 && negative == 0)
+        {
+            _currentLatencyUs = (long)latencyUs;
+            UpdateLatency((int)(latencyUs / 1000));
+        }
+
+        var channels = Channels;
+        var framesRequested = (int)((ulong)nbytes / (ulong)(sizeof(float) * channels));
+        if (framesRequested > FramesPerWrite)
+        {
+            _logger.WriteRequestCapped(framesRequested * channels, frameBuffer.Length);
+            framesRequested = FramesPerWrite;
+        }
+
+        if (framesRequested == 0)
+            return;
+
+        var output = frameBuffer.AsSpan(0, framesRequested * channels);
+        output.Clear();
+
+        foreach (var zone in _zones)
+        {
+            zone.MixInto(output, channels, framesRequested);
+        }
+
+        unsafe
+        {
+            fixed (float* ptr = frameBuffer)
+            {
+                if (StreamWrite(stream, (IntPtr)ptr, (UIntPtr)(output.Length * sizeof(float)),
+                        IntPtr.Zero, 0, SeekMode.Relative) < 0)
+                {
+                    _logger.StreamWriteFailed();
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Collects latency samples until lock-in, then freezes to the median.
+    /// </summary>
+    private void UpdateLatency(int latencyMs)
+    {
+        if (_latencyLocked || latencyMs < 5)
+            return;
+
+        _latencySamples ??= new List<int>(LatencyLockSampleCount + LatencyLockWarmupSamples);
+        _latencySamples.Add(latencyMs);
+
+        if (_latencySamples.Count < LatencyLockSampleCount + LatencyLockWarmupSamples)
+        {
+            if (Math.Abs(latencyMs - OutputLatencyMs) > 5)
+                OutputLatencyMs = latencyMs;
+            return;
+        }
+
+        var stableSamples = _latencySamples.Skip(LatencyLockWarmupSamples).OrderBy(x => x).ToList();
+        var median = stableSamples[stableSamples.Count / 2];
+
+        if (median > MaxReasonableLatencyMs)
+        {
+            OutputLatencyMs = MaxReasonableLatencyMs;
+            _logger.LatencyCapped(median, MaxReasonableLatencyMs);
+        }
+        else
+        {
+            OutputLatencyMs = median;
+            _logger.LatencyLocked(median, stableSamples.Count, stableSamples[0], stableSamples[^1]);
+        }
+
+        _latencyLocked = true;
+        _latencySamples = null;
+    }
+
+    private void OnUnderflow(IntPtr stream, IntPtr userdata)
+    {
+        _underflowCount++;
+
+        if (_underflowCount == UnderflowWarningThreshold)
+        {
+            var elapsed = (DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
+            _logger.UnderflowDetected(_underflowCount, elapsed, _callbackCount, 0, OutputLatencyMs);
+        }
+        else if (_underflowCount % 100 == 0)
+        {
+            _logger.UnderflowCount(_underflowCount);
+        }
+    }
+
+    private void WriteSilence(IntPtr stream, UIntPtr nbytes)
+    {
+        var bytesRequested = (int)(ulong)nbytes;
+        if (_silenceBuffer.Length < bytesRequested)
+        {
+            _silenceBuffer = new byte[bytesRequested];
+        }
+
+        unsafe
+        {
+            fixed (byte* ptr = _silenceBuffer)
+            {
+                StreamWrite(stream, (IntPtr)ptr, nbytes, IntPtr.Zero, 0, SeekMode.Relative);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Pairs source channels with card channels for a stream of <paramref name="sourceChannels"/>
+    /// feeding the card channels in <paramref name="targetChannels"/>.
+    /// </summary>
+    /// <remarks>
+    /// Target i takes source channel i. A stream with fewer channels than targets (mono)
+    /// feeds every target; a stream with more (stereo into a mono zone) is downmixed at
+    /// equal weight, as module-remap-sink does with remix enabled.
+    /// </remarks>
+    /// <returns>Route arrays for <see cref="ScatterFrames"/> and the downmix gain.</returns>
+    internal static (int[] Sources, int[] Targets, float DownmixGain) BuildRoutes(int sourceChannels, int[] targetChannels)
+    {
+        var outputs = targetChannels.Length;
+        var routes = Math.Max(outputs, sourceChannels);
+
+        return (
+            Enumerable.Range(0, routes).Select(i => i % sourceChannels).ToArray(),
+            Enumerable.Range(0, routes).Select(i => targetChannels[i % outputs]).ToArray(),
+            sourceChannels > outputs ? (float)outputs / sourceChannels : 1f);
+    }
+
+    /// <summary>
+    /// Adds <paramref name="frames"/> frames of a zone's interleaved audio into the card frame,
+    /// routing source channel <c>sourceChannels[i]</c> to card channel <c>targetChannels[i]</c>
+    /// with <paramref name="gain"/> applied.
+    /// </summary>
+    /// <remarks>
+    /// Mixing (rather than overwriting) keeps two zones mapped to the same output audible,
+    /// as PulseAudio would. The common shapes get SIMD paths: a zone covering the whole card
+    /// in order is one <see cref="Vector{T}"/> multiply-add, and a stereo zone on an adjacent
+    /// channel pair is one <see cref="Vector2"/> multiply-add per frame. Anything else uses
+    /// a strided loop per routed channel.
+    /// </remarks>
+    internal static void ScatterFrames(
+        ReadOnlySpan<float> source,
+        int sourceStride,
+        Span<float> output,
+        int outputStride,
+        int frames,
+        int[] sourceChannels,
+        int[] targetChannels,
+        float gain)
+    {
+        if (gain == 0f || frames == 0)
+            return;
+
+        if (IsIdentityRoute(sourceStride, outputStride, sourceChannels, targetChannels))
+        {
+            MultiplyAdd(source[..(frames * sourceStride)], output[..(frames * outputStride)], gain);
+            return;
+        }
+
+        ref var src = ref MemoryMarshal.GetReference(source);
+        ref var dst = ref MemoryMarshal.GetReference(output);
+
+        if (sourceStride == 2 && sourceChannels.Length == 2 &&
+            sourceChannels[0] == 0 && sourceChannels[1] == 1 &&
+            targetChannels[1] == targetChannels[0] + 1)
+        {
+            var gainPair = new Vector2(gain);
+            var offset = targetChannels[0];
+            ref var srcPairs = ref Unsafe.As<float, Vector2>(ref src);
+
+            for (var f = 0; f < frames; f++)
+            {
+                ref var dstPair = ref Unsafe.As<float, Vector2>(ref Unsafe.Add(ref dst, f * outputStride + offset));
+                dstPair += Unsafe.Add(ref srcPairs, f) * gainPair;
+            }
+            return;
+        }
+
+        for (var r = 0; r < sourceChannels.Length; r++)
+        {
+            var s = sourceChannels[r];
+            var t = targetChannels[r];
+            for (var f = 0; f < frames; f++)
+            {
+                Unsafe.Add(ref dst, f * outputStride + t) += Unsafe.Add(ref src, f * sourceStride + s) * gain;
+            }
+        }
+    }
+
+    private static bool IsIdentityRoute(int sourceStride, int outputStride, int[] sourceChannels, int[] targetChannels)
+    {
+        if (sourceStride != outputStride || sourceChannels.Length != outputStride)
+            return false;
+
+        for (var i = 0; i < sourceChannels.Length; i++)
+        {
+            if (sourceChannels[i] != i || targetChannels[i] != i)
+                return false;
+        }
+
+        return true;
+    }
+
+    private static void MultiplyAdd(ReadOnlySpan<float> source, Span<float> output, float gain)
+    {
+        var i = 0;
+        if (Vector.IsHardwareAccelerated && source.Length >= Vector<float>.Count)
+        {
+            var src = MemoryMarshal.Cast<float, Vector<float>>(source);
+            var dst = MemoryMarshal.Cast<float, Vector<float>>(output);
+            var gainVector = new Vector<float>(gain);
+            for (var v = 0; v < src.Length; v++)
+            {
+                dst[v] += src[v] * gainVector;
+            }
+            i = src.Length * Vector<float>.Count;
+        }
+
+        // Scalar tail
+        for (; i < source.Length; i++)
+        {
+            output[i] += source[i] * gain;
+        }
+    }
+
+    /// <summary>
+    /// Releases all PulseAudio resources. Caller holds _lock.
+    /// </summary>
+    private void CleanupResources()
+    {
+        _closing = true;
+        _uncorked = false;
+        _clock = null;
+        _contextReady = false;
+
+        if (_stream != IntPtr.Zero)
+        {
+            if (_mainloop != IntPtr.Zero)
+            {
+                ThreadedMainloopLock(_mainloop);
+                try
+                {
+                    StreamDisconnect(_stream);
+                }
+                finally
+                {
+                    ThreadedMainloopUnlock(_mainloop);
+                }
+            }
+            StreamUnref(_stream);
+            _stream = IntPtr.Zero;
+        }
+
+        if (_context != IntPtr.Zero)
+        {
+            if (_mainloop != IntPtr.Zero)
+            {
+                ThreadedMainloopLock(_mainloop);
+                try
+                {
+                    ContextDisconnect(_context);
+                }
+                finally
+                {
+                    ThreadedMainloopUnlock(_mainloop);
+                }
+            }
+            ContextUnref(_context);
+            _context = IntPtr.Zero;
+        }
+
+        if (_mainloop != IntPtr.Zero)
+        {
+            ThreadedMainloopStop(_mainloop);
+            ThreadedMainloopFree(_mainloop);
+            _mainloop = IntPtr.Zero;
+        }
+
+        _contextStateCallback = null;
+        _streamStateCallback = null;
+        _writeCallback = null;
+        _underflowCallback = null;
+
+        _streamReady = false;
+        _frameBuffer = null;
+        _closing = false;
+    }
+}
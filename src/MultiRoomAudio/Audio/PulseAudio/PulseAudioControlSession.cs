@@ -0,0 +1,236 @@
+using System.Collections.Concurrent;
+using Microsoft.Extensions.Logging;
+using static MultiRoomAudio.Audio.PulseAudio.PulseAudioNative;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// Short-lived native PulseAudio connection for applying many control changes at once.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Each pactl invocation forks a process, connects, authenticates, runs one command and
+/// disconnects. This session connects once and issues every operation without waiting for
+/// the previous one, so N changes cost one connection plus N pipelined requests. Each
+/// method returns a task that completes when PulseAudio acknowledges that operation.
+/// </para>
+/// <para>
+/// Intended for batch work such as startup restore: open, issue operations, await them, dispose.
+/// </para>
+/// </remarks>
+internal sealed class PulseAudioControlSession : IDisposable
+{
+    private const int ConnectionTimeoutMs = 5000;
+
+    private readonly ILogger? _logger;
+    private readonly ConcurrentDictionary<nint, TaskCompletionSource<bool>> _pending = new();
+    private IntPtr _mainloop = IntPtr.Zero;
+    private IntPtr _context = IntPtr.Zero;
+    private long _nextOperationId;
+    private volatile bool _ready;
+    private bool _disposed;
+
+    // CRITICAL: Store callbacks as fields to prevent GC collection
+    private ContextNotifyCallback? _contextStateCallback;
+    private ContextSuccessCallback? _successCallback;
+
+    private PulseAudioControlSession(ILogger? logger)
+    {
+        _logger = logger;
+    }
+
+    /// <summary>
+    /// Connects to PulseAudio.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">PulseAudio is not reachable.</exception>
+    public static PulseAudioControlSession Open(ILogger? logger = null)
+    {
+        var session = new PulseAudioControlSession(logger);
+        try
+        {
+            session.Connect();
+            return session;
+        }
+        catch
+        {
+            session.Dispose();
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Switches a card to a profile.
+    /// </summary>
+    public Task<bool> SetCardProfileAsync(string cardName, string profileName)
+    {
+        return Issue((ctx, cb, id) => ContextSetCardProfileByName(ctx, cardName, profileName, cb, id));
+    }
+
+    /// <summary>
+    /// Mutes or unmutes a sink.
+    /// </summary>
+    public Task<bool> SetSinkMuteAsync(string sinkName, bool muted)
+    {
+        return Issue((ctx, cb, id) => ContextSetSinkMuteByName(ctx, sinkName, muted ? 1 : 0, cb, id));
+    }
+
+    /// <summary>
+    /// Sets all channels of a sink to a volume percentage.
+    /// </summary>
+    /// <param name="sinkName">Sink name.</param>
+    /// <param name="channels">The sink's channel count (PulseAudio rejects a mismatch).</param>
+    /// <param name="percent">Volume 0-100 (pactl scale).</param>
+    public Task<bool> SetSinkVolumeAsync(string sinkName, int channels, int percent)
+    {
+        var volume = CVolume.FromPercent(channels, percent);
+        return Issue((ctx, cb, id) => ContextSetSinkVolumeByName(ctx, sinkName, ref volume, cb, id));
+    }
+
+    private Task<bool> Issue(Func<IntPtr, ContextSuccessCallback, IntPtr, IntPtr> start)
+    {
+        if (_disposed || !_ready)
+            return Task.FromResult(false);
+
+        var id = (nint)Interlocked.Increment(ref _nextOperationId);
+        var tcs = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+        _pending[id] = tcs;
+
+        ThreadedMainloopLock(_mainloop);
+        try
+        {
+            var op = start(_context, _successCallback!, id);
+            if (op == IntPtr.Zero)
+            {
+                _pending.TryRemove(id, out _);
+                _logger?.LogDebug("PulseAudio control operation rejected: {Error}", GetContextError(_context));
+                return Task.FromResult(false);
+            }
+            OperationUnref(op);
+        }
+        finally
+        {
+            ThreadedMainloopUnlock(_mainloop);
+        }
+
+        return tcs.Task;
+    }
+
+    private void Connect()
+    {
+        _mainloop = ThreadedMainloopNew();
+        if (_mainloop == IntPtr.Zero)
+            throw new InvalidOperationException("Failed to create PulseAudio mainloop");
+
+        var api = ThreadedMainloopGetApi(_mainloop);
+        _context = ContextNew(api, "MultiRoomAudio-Control");
+        if (_context == IntPtr.Zero)
+            throw new InvalidOperationException("Failed to create PulseAudio context");
+
+        _contextStateCallback = OnContextStateChanged;
+        _successCallback = OnOperationComplete;
+        ContextSetStateCallback(_context, _contextStateCallback, IntPtr.Zero);
+
+        if (ThreadedMainloopStart(_mainloop) < 0)
+            throw new InvalidOperationException("Failed to start PulseAudio mainloop");
+
+        ThreadedMainloopLock(_mainloop);
+        try
+        {
+            if (ContextConnect(_context, null, 0, IntPtr.Zero) < 0)
+                throw new InvalidOperationException("Failed to connect to PulseAudio");
+
+            var timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+            while (!_ready)
+            {
+                var state = ContextGetState(_context);
+                if (state == ContextState.Failed || state == ContextState.Terminated)
+                    throw new InvalidOperationException($"PulseAudio context failed: {GetContextError(_context)}");
+
+                if (DateTime.UtcNow > timeout)
+                    throw new TimeoutException("Timeout waiting for PulseAudio context");
+
+                ThreadedMainloopWait(_mainloop);
+            }
+        }
+        finally
+        {
+            ThreadedMainloopUnlock(_mainloop);
+        }
+    }
+
+    private void OnContextStateChanged(IntPtr context, IntPtr userdata)
+    {
+        var state = ContextGetState(context);
+        if (state == ContextState.Ready)
+        {
+            _ready = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == ContextState.Failed || state == ContextState.Terminated)
+        {
+            _ready = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+            FailPending();
+        }
+    }
+
+    private void OnOperationComplete(IntPtr context, int success, IntPtr userdata)
+    {
+        // Runs on the mainloop thread; continuations are forced async by the TCS options
+        if (_pending.TryRemove(userdata, out var tcs))
+        {
+            if (success == 0)
+                _logger?.LogDebug("PulseAudio control operation failed: {Error}", GetContextError(context));
+            tcs.TrySetResult(success != 0);
+        }
+    }
+
+    private void FailPending()
+    {
+        foreach (var id in _pending.Keys)
+        {
+            if (_pending.TryRemove(id, out var tcs))
+                tcs.TrySetResult(false);
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+        _disposed = true;
+        _ready = false;
+
+        if (_context != IntPtr.Zero && _mainloop != IntPtr.Zero)
+        {
+            ThreadedMainloopLock(_mainloop);
+            try
+            {
+                ContextDisconnect(_context);
+            }
+            finally
+            {
+                ThreadedMainloopUnlock(_mainloop);
+            }
+        }
+
+        if (_mainloop != IntPtr.Zero)
+            ThreadedMainloopStop(_mainloop);
+
+        if (_context != IntPtr.Zero)
+        {
+            ContextUnref(_context);
+            _context = IntPtr.Zero;
+        }
+
+        if (_mainloop != IntPtr.Zero)
+        {
+            ThreadedMainloopFree(_mainloop);
+            _mainloop = IntPtr.Zero;
+        }
+
+        FailPending();
+        _contextStateCallback = null;
+        _successCallback = null;
+    }
+}
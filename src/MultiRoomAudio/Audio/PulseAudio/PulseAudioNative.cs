@@ -287,6 +287,12 @@ internal static class PulseAudioNative
     [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
     public delegate void StreamRequestCallback(IntPtr stream, UIntPtr nbytes, IntPtr userdata);
 
+    /// <summary>
+    /// Callback for stream operation completion (drain, cork, flush).
+    /// </summary>
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    public delegate void StreamSuccessCallback(IntPtr stream, int success, IntPtr userdata);
+
     #endregion
 
     #region Async API - Threaded Mainloop
@@ -421,6 +427,32 @@ internal static class PulseAudioNative
     [DllImport(LibPulse, EntryPoint = "pa_stream_new")]
     public static extern IntPtr StreamNew(IntPtr context, string name, ref SampleSpec ss, IntPtr channelMap);
 
+    /// <summary>
+    /// Create a new stream with an explicit channel map.
+    /// </summary>
+    [DllImport(LibPulse, EntryPoint = "pa_stream_new")]
+    public static extern IntPtr StreamNew(IntPtr context, string name, ref SampleSpec ss, ref ChannelMap channelMap);
+
+    /// <summary>
+    /// Channel map (pa_channel_map). Positions are pa_channel_position_t values.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ChannelMap
+    {
+        public byte Channels;
+
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = ChannelsMax)]
+        public int[] Map;
+    }
+
+    /// <summary>
+    /// Parse a channel map from a comma-separated list of position names
+    /// (the format pactl prints, e.g. "front-left,front-right,rear-left").
+    /// </summary>
+    /// <returns>Pointer to the map on success, NULL if a name is not recognised.</returns>
+    [DllImport(LibPulse, EntryPoint = "pa_channel_map_parse")]
+    public static extern IntPtr ChannelMapParse(ref ChannelMap map, [MarshalAs(UnmanagedType.LPStr)] string s);
+
     /// <summary>
     /// Free a stream.
     /// </summary>
@@ -457,6 +489,16 @@ internal static class PulseAudioNative
         IntPtr volume,
         IntPtr syncStream);
 
+    /// <summary>
+    /// Connect the stream for recording from a source (or a sink's ".monitor" source).
+    /// </summary>
+    [DllImport(LibPulse, EntryPoint = "pa_stream_connect_record")]
+    public static extern int StreamConnectRecord(
+        IntPtr stream,
+        string? dev,
+        ref BufferAttr attr,
+        StreamFlags flags);
+
     /// <summary>
     /// Disconnect the stream.
     /// </summary>
@@ -469,6 +511,12 @@ internal static class PulseAudioNative
     [DllImport(LibPulse, EntryPoint = "pa_stream_set_write_callback")]
     public static extern void StreamSetWriteCallback(IntPtr stream, StreamRequestCallback cb, IntPtr userdata);
 
+    /// <summary>
+    /// Set the read callback (called when recorded data is available).
+    /// </summary>
+    [DllImport(LibPulse, EntryPoint = "pa_stream_set_read_callback")]
+    public static extern void StreamSetReadCallback(IntPtr stream, StreamRequestCallback cb, IntPtr userdata);
+
     /// <summary>
     /// Set the underflow callback.
     /// </summary>
@@ -499,6 +547,22 @@ internal static class PulseAudioNative
         long offset,
         SeekMode seek);
 
+    /// <summary>
+    /// Get the next fragment of recorded data without copying it.
+    /// </summary>
+    /// <param name="stream">The record stream.</param>
+    /// <param name="data">Output: the fragment, or NULL for a hole in the stream.</param>
+    /// <param name="nbytes">Output: fragment length in bytes (0 when the buffer is empty).</param>
+    /// <returns>0 on success, negative on error.</returns>
+    [DllImport(LibPulse, EntryPoint = "pa_stream_peek")]
+    public static extern int StreamPeek(IntPtr stream, out IntPtr data, out UIntPtr nbytes);
+
+    /// <summary>
+    /// Release the fragment returned by <see cref="StreamPeek"/>.
+    /// </summary>
+    [DllImport(LibPulse, EntryPoint = "pa_stream_drop")]
+    public static extern int StreamDrop(IntPtr stream);
+
     /// <summary>
     /// Get how much can be written to the stream.
     /// </summary>
@@ -548,6 +612,12 @@ internal static class PulseAudioNative
     [DllImport(LibPulse, EntryPoint = "pa_stream_drain")]
     public static extern IntPtr StreamDrain(IntPtr stream, IntPtr callback, IntPtr userdata);
 
+    /// <summary>
+    /// Drain the stream, calling <paramref name="callback"/> once everything written has played.
+    /// </summary>
+    [DllImport(LibPulse, EntryPoint = "pa_stream_drain")]
+    public static extern IntPtr StreamDrain(IntPtr stream, StreamSuccessCallback callback, IntPtr userdata);
+
     /// <summary>
     /// Update the timing info.
     /// </summary>
@@ -664,4 +734,82 @@ internal static class PulseAudioNative
     public static extern void OperationUnref(IntPtr operation);
 
     #endregion
+
+    #region Async API - Introspection (control)
+
+    /// <summary>
+    /// Maximum channels in a pa_cvolume (PA_CHANNELS_MAX).
+    /// </summary>
+    public const int ChannelsMax = 32;
+
+    /// <summary>
+    /// Volume value for 100% (PA_VOLUME_NORM).
+    /// </summary>
+    public const uint VolumeNorm = 0x10000;
+
+    /// <summary>
+    /// Per-channel volume (pa_cvolume).
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CVolume
+    {
+        public byte Channels;
+
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = ChannelsMax)]
+        public uint[] Values;
+
+        /// <summary>
+        /// Creates a volume with every channel at the same percentage (same scale as pactl's "N%").
+        /// </summary>
+        public static CVolume FromPercent(int channels, int percent)
+        {
+            var volume = new CVolume
+            {
+                Channels = (byte)Math.Clamp(channels, 1, ChannelsMax),
+                Values = new uint[ChannelsMax]
+            };
+            var value = (uint)(VolumeNorm * (ulong)Math.Max(percent, 0) / 100);
+            for (var i = 0; i < volume.Channels; i++)
+                volume.Values[i] = value;
+            return volume;
+        }
+    }
+
+    /// <summary>
+    /// Change the profile of a card by name.
+    /// </summary>
+    /// <returns>Operation handle (must be unref'd), or NULL on error.</returns>
+    [DllImport(LibPulse, EntryPoint = "pa_context_set_card_profile_by_name")]
+    public static extern IntPtr ContextSetCardProfileByName(
+        IntPtr context,
+        [MarshalAs(UnmanagedType.LPStr)] string cardName,
+        [MarshalAs(UnmanagedType.LPStr)] string profile,
+        ContextSuccessCallback? callback,
+        IntPtr userdata);
+
+    /// <summary>
+    /// Set the mute switch of a sink by name.
+    /// </summary>
+    /// <returns>Operation handle (must be unref'd), or NULL on error.</returns>
+    [DllImport(LibPulse, EntryPoint = "pa_context_set_sink_mute_by_name")]
+    public static extern IntPtr ContextSetSinkMuteByName(
+        IntPtr context,
+        [MarshalAs(UnmanagedType.LPStr)] string sinkName,
+        int mute,
+        ContextSuccessCallback? callback,
+        IntPtr userdata);
+
+    /// <summary>
+    /// Set the volume of a sink by name. Channel count must match the sink.
+    /// </summary>
+    /// <returns>Operation handle (must be unref'd), or NULL on error.</returns>
+    [DllImport(LibPulse, EntryPoint = "pa_context_set_sink_volume_by_name")]
+    public static extern IntPtr ContextSetSinkVolumeByName(
+        IntPtr context,
+        [MarshalAs(UnmanagedType.LPStr)] string sinkName,
+        ref CVolume volume,
+        ContextSuccessCallback? callback,
+        IntPtr userdata);
+
+    #endregion
 }
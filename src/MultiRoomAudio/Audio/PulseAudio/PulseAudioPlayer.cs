@@ -1,4 +1,4 @@
-using System.Runtime.InteropServices;
+using System.Diagnostics;
 using Sendspin.SDK.Audio;
 using Sendspin.SDK.Models;
 using static MultiRoomAudio.Audio.PulseAudio.PulseAudioNative;
@@ -49,7 +49,7 @@ public class PulseAudioPlayer : IAudioPlayer
     // These are set once during initialization and read from the callback thread.
     // Volatile ensures the callback sees the initialized values.
     private volatile float[]? _sampleBuffer;
-    private volatile byte[]? _byteBuffer;
+    private volatile GainRamp? _gainRamp;
 
     // Pre-allocated silence buffer to avoid GC allocations in the write callback.
     // Resized as needed but typically stays at the initial size.
@@ -100,6 +100,12 @@ public class PulseAudioPlayer : IAudioPlayer
     private const int MaxReasonableLatencyMs = 200;  // Cap unreasonable latency (e.g., Pi 4 reports 1000ms)
     private const int HighVarianceThresholdMs = 200; // If range exceeds this, measurements are unreliable
 
+    // Warm start: latency locked on a previous run for this sink (0 = none).
+    // If the first post-warmup samples agree with it, lock early instead of waiting for the full window.
+    private volatile int _seededLatencyMs;
+    private const int WarmStartLockSampleCount = 20;  // ~200ms of samples after warmup
+    private const int WarmStartToleranceMs = 10;      // Early median must be within this of the seed
+
     // Diagnostic counters for monitoring callback behavior
     private long _callbackCount;
     private long _silenceWriteCount;
@@ -107,6 +113,26 @@ public class PulseAudioPlayer : IAudioPlayer
     private DateTime _playbackStartTime;
     private bool _hasLoggedFirstAudio;
 
+    // Idle corking: after _idleCorkDelay of continuous silence the write callback corks the
+    // stream, so an idle player stops waking every ~10ms (and the DAC can suspend).
+    // Wake() or Play() uncorks it. Only while the pipeline is stopped (_idleCorkAllowed):
+    // a corked stream gets no callbacks, so a stall mid-playback must not cork it.
+    // Timestamps are Stopwatch ticks; 0 = not set.
+    private readonly TimeSpan _idleCorkDelay;
+    private volatile bool _idleCorkAllowed = true;
+    private long _idleSinceTimestamp;
+    private volatile bool _idleCorked;
+    private long _idleCorkedTimestamp;
+    private long _idleCorkedTicksTotal;
+    private long _wakeTimestamp;
+    private int _idleCorkCount;
+
+    /// <summary>
+    /// Write callback period while uncorked (the stream's minimum request), used to
+    /// estimate the callbacks a corked stream saves.
+    /// </summary>
+    private const int CallbackIntervalMs = 10;
+
     // Audio clock: Unix epoch microseconds when playback started (captured at uncork time).
     // Used to convert pa_stream_get_time() (relative) to absolute Unix time.
     private long _playbackStartUnixMicroseconds;
@@ -146,6 +172,86 @@ public class PulseAudioPlayer : IAudioPlayer
     /// </summary>
     public bool IsLatencyLocked => _latencyLocked;
 
+    /// <summary>
+    /// Gets whether the current latency lock was reached early by confirming a seeded value.
+    /// </summary>
+    public bool IsLatencyWarmStarted { get; private set; }
+
+    /// <summary>
+    /// Gets the time from playback start to latency lock in milliseconds, or null if not locked yet.
+    /// </summary>
+    public int? LatencyLockTimeMs { get; private set; }
+
+    /// <summary>
+    /// Gets whether the stream is currently corked because it was idle.
+    /// </summary>
+    public bool IsIdleCorked => _idleCorked;
+
+    /// <summary>
+    /// Gets or sets whether the stream may be corked after <see cref="_idleCorkDelay"/> of silence.
+    /// </summary>
+    /// <remarks>
+    /// Set from the pipeline state: true while it is idle or stopping, false while it is
+    /// buffering or playing. Silence while playing is a stall (network, server), and the pipeline
+    /// sends no new state when data resumes, so nothing would wake a stream corked then.
+    /// </remarks>
+    public bool IdleCorkAllowed
+    {
+        get => _idleCorkAllowed;
+        set => _idleCorkAllowed = value;
+    }
+
+    /// <summary>
+    /// Gets how many times the stream has been corked for idleness.
+    /// </summary>
+    public int IdleCorkCount => _idleCorkCount;
+
+    /// <summary>
+    /// Gets the estimated write callbacks avoided by idle corking (including the current idle period).
+    /// </summary>
+    public long IdleWakeupsSaved
+    {
+        get
+        {
+            var corkedTicks = Interlocked.Read(ref _idleCorkedTicksTotal);
+            var since = Interlocked.Read(ref _idleCorkedTimestamp);
+            if (_idleCorked && since != 0)
+            {
+                corkedTicks += Stopwatch.GetTimestamp() - since;
+            }
+
+            return (long)(corkedTicks * 1000.0 / Stopwatch.Frequency / CallbackIntervalMs);
+        }
+    }
+
+    /// <summary>
+    /// Gets the time from the most recent idle wake to the first audio written, in milliseconds:
+    /// the start-up cost idle corking added. Null if the stream has not been woken yet.
+    /// </summary>
+    public int? LastWakeToAudioMs { get; private set; }
+
+    /// <summary>
+    /// Seeds the latency lock with a value learned on a previous run for this sink.
+    /// </summary>
+    /// <remarks>
+    /// The seed becomes the initial latency estimate. It is only locked in once live
+    /// measurements confirm it (median within ±10ms after warmup); otherwise the normal
+    /// full-window lock-in runs as if no seed was given.
+    /// Must be called before <see cref="InitializeAsync"/>.
+    /// </remarks>
+    /// <param name="latencyMs">Previously locked latency in milliseconds.</param>
+    public void SeedLatency(int latencyMs)
+    {
+        if (latencyMs < 5 || latencyMs > MaxReasonableLatencyMs)
+        {
+            _logger.LogDebug("Ignoring out-of-range latency seed {Latency}ms", latencyMs);
+            return;
+        }
+
+        _seededLatencyMs = latencyMs;
+        _logger.LogDebug("Latency seeded at {Latency}ms from previous run", latencyMs);
+    }
+
     /// <summary>
     /// Gets the current playback time from the PulseAudio stream in microseconds.
     /// </summary>
@@ -234,10 +340,15 @@ public class PulseAudioPlayer : IAudioPlayer
     /// <param name="sinkName">
     /// Optional PulseAudio sink name. If null, uses the default sink.
     /// </param>
-    public PulseAudioPlayer(ILogger<PulseAudioPlayer> logger, string? sinkName = null)
+    /// <param name="idleCorkDelay">
+    /// Continuous silence after which the stream is corked until <see cref="Wake"/> or
+    /// <see cref="Play"/>. Zero (the default) never corks for idleness.
+    /// </param>
+    public PulseAudioPlayer(ILogger<PulseAudioPlayer> logger, string? sinkName = null, TimeSpan idleCorkDelay = default)
     {
         _logger = logger;
         _sinkName = sinkName;
+        _idleCorkDelay = idleCorkDelay;
     }
 
     public Task InitializeAsync(AudioFormat format, CancellationToken cancellationToken = default)
@@ -434,13 +545,15 @@ public class PulseAudioPlayer : IAudioPlayer
 
                 _currentFormat = format;
 
-                // Set initial latency estimate; will be updated by write callback
-                OutputLatencyMs = InitialLatencyEstimateMs;
+                // Set initial latency estimate; will be updated by write callback.
+                // A seed from a previous run is a better starting point than the generic estimate.
+                var seededLatency = _seededLatencyMs;
+                OutputLatencyMs = seededLatency > 0 ? seededLatency : InitialLatencyEstimateMs;
 
                 // Pre-allocate buffers
                 var samplesPerWrite = FramesPerWrite * format.Channels;
                 _sampleBuffer = new float[samplesPerWrite];
-                _byteBuffer = new byte[samplesPerWrite * sizeof(float)];
+                _gainRamp = new GainRamp(format.Channels, format.SampleRate);
 
                 SetState(AudioPlayerState.Stopped);
 
@@ -479,7 +592,7 @@ public class PulseAudioPlayer : IAudioPlayer
                 return;
             }
 
-            if (_isPlaying && !_isPaused)
+            if (_isPlaying && !_isPaused && !_idleCorked)
             {
                 _logger.LogDebug("Already playing");
                 return;
@@ -496,46 +609,102 @@ public class PulseAudioPlayer : IAudioPlayer
             _hasLoggedFirstAudio = false;
             _playbackStartTime = DateTime.UtcNow;
 
-            // Uncork the stream and capture timing baseline IMMEDIATELY after.
-            // CRITICAL: Both Unix time and stream time must be captured right after uncork
-            // to establish an accurate baseline for audio clock synchronization.
-            ThreadedMainloopLock(_mainloop);
-            try
+            UncorkStream();
+
+            SetState(AudioPlayerState.Playing);
+            _logger.LogInformation("Playback started (stream uncorked). Monitoring callbacks...");
+        }
+    }
+
+    /// <summary>
+    /// Uncorks a stream that was corked for idleness, ahead of new audio.
+    /// </summary>
+    /// <remarks>
+    /// Called when the SDK pipeline starts buffering, so the stream is running again (and
+    /// PulseAudio's buffer refilled with silence) before the scheduled start time arrives.
+    /// No-op if the stream is not idle-corked.
+    /// </remarks>
+    public void Wake()
+    {
+        lock (_lock)
+        {
+            if (!_idleCorked || _stream == IntPtr.Zero || _mainloop == IntPtr.Zero || _isPaused)
+                return;
+
+            // An idle-corked stream has no callbacks, but never take the mainloop lock from its own thread
+            if (ThreadedMainloopInThread(_mainloop) != 0)
+                return;
+
+            UncorkStream();
+        }
+    }
+
+    /// <summary>
+    /// Ends an idle cork period: accounts its duration and starts the wake-to-audio timer.
+    /// Caller holds the mainloop lock (so the write callback cannot cork concurrently)
+    /// and uncorks the stream.
+    /// </summary>
+    private void EndIdleCork()
+    {
+        _idleSinceTimestamp = 0;
+
+        if (!_idleCorked)
+            return;
+
+        _idleCorked = false;
+        var now = Stopwatch.GetTimestamp();
+        var corkedTicks = now - Interlocked.Exchange(ref _idleCorkedTimestamp, 0);
+        Interlocked.Add(ref _idleCorkedTicksTotal, corkedTicks);
+        Volatile.Write(ref _wakeTimestamp, now);
+
+        var corkedMs = corkedTicks * 1000.0 / Stopwatch.Frequency;
+        _logger.IdleWoken(corkedMs, (long)(corkedMs / CallbackIntervalMs));
+    }
+
+    /// <summary>
+    /// Uncorks the stream and captures the audio clock baseline. Caller holds _lock.
+    /// </summary>
+    private void UncorkStream()
+    {
+        // Uncork the stream and capture timing baseline IMMEDIATELY after.
+        // CRITICAL: Both Unix time and stream time must be captured right after uncork
+        // to establish an accurate baseline for audio clock synchronization.
+        // Stream time does not advance while corked, so this is redone after every cork.
+        ThreadedMainloopLock(_mainloop);
+        try
+        {
+            EndIdleCork();
+
+            // Uncork the stream to start/resume playback.
+            // Stream is connected with StartCorked flag, so we must uncork to begin.
+            StreamCork(_stream, 0, IntPtr.Zero, IntPtr.Zero);
+
+            // Capture Unix epoch time immediately after uncork.
+            // This is our baseline for converting stream time to absolute time.
+            _playbackStartUnixMicroseconds = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() * 1000;
+
+            // Capture stream time immediately after uncork.
+            // pa_stream_get_time() may or may not reset on uncork depending on PulseAudio version.
+            // By capturing this value now and subtracting it from future readings,
+            // we measure time elapsed since playback actually started.
+            if (StreamGetTime(_stream, out var streamTimeAtUncork) == 0)
             {
-                // Uncork the stream to start/resume playback.
-                // Stream is connected with StartCorked flag, so we must uncork to begin.
-                StreamCork(_stream, 0, IntPtr.Zero, IntPtr.Zero);
-
-                // Capture Unix epoch time immediately after uncork.
-                // This is our baseline for converting stream time to absolute time.
-                _playbackStartUnixMicroseconds = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() * 1000;
-
-                // Capture stream time immediately after uncork.
-                // pa_stream_get_time() may or may not reset on uncork depending on PulseAudio version.
-                // By capturing this value now and subtracting it from future readings,
-                // we measure time elapsed since playback actually started.
-                if (StreamGetTime(_stream, out var streamTimeAtUncork) == 0)
-                {
-                    _streamTimeAtUncorkMicroseconds = (long)streamTimeAtUncork;
-                    _logger.LogDebug("Audio clock baseline captured: Unix={UnixMs}ms, StreamTime={StreamTimeUs}μs ({StreamTimeMs:F1}ms)",
-                        _playbackStartUnixMicroseconds / 1000,
-                        _streamTimeAtUncorkMicroseconds,
-                        _streamTimeAtUncorkMicroseconds / 1000.0);
-                }
-                else
-                {
-                    _streamTimeAtUncorkMicroseconds = 0;
-                    _logger.LogDebug("Audio clock baseline captured: Unix={UnixMs}ms, StreamTime=unavailable",
-                        _playbackStartUnixMicroseconds / 1000);
-                }
+                _streamTimeAtUncorkMicroseconds = (long)streamTimeAtUncork;
+                _logger.LogDebug("Audio clock baseline captured: Unix={UnixMs}ms, StreamTime={StreamTimeUs}μs ({StreamTimeMs:F1}ms)",
+                    _playbackStartUnixMicroseconds / 1000,
+                    _streamTimeAtUncorkMicroseconds,
+                    _streamTimeAtUncorkMicroseconds / 1000.0);
             }
-            finally
+            else
             {
-                ThreadedMainloopUnlock(_mainloop);
+                _streamTimeAtUncorkMicroseconds = 0;
+                _logger.LogDebug("Audio clock baseline captured: Unix={UnixMs}ms, StreamTime=unavailable",
+                    _playbackStartUnixMicroseconds / 1000);
             }
-
-            SetState(AudioPlayerState.Playing);
-            _logger.LogInformation("Playback started (stream uncorked). Monitoring callbacks...");
+        }
+        finally
+        {
+            ThreadedMainloopUnlock(_mainloop);
         }
     }
 
@@ -606,6 +775,9 @@ public class PulseAudioPlayer : IAudioPlayer
         // Different audio devices have different latency characteristics
         _latencyLocked = false;
         _latencySamples = null;
+        _seededLatencyMs = 0;
+        IsLatencyWarmStarted = false;
+        LatencyLockTimeMs = null;
 
         if (savedFormat != null)
         {
@@ -646,7 +818,7 @@ public class PulseAudioPlayer : IAudioPlayer
     private void OnContextStateChanged(IntPtr context, IntPtr userdata)
     {
         var state = ContextGetState(context);
-        _logger.LogDebug("PulseAudio context state: {State}", state);
+        _logger.ContextStateChanged(state);
 
         if (state == ContextState.Ready)
         {
@@ -659,9 +831,9 @@ public class PulseAudioPlayer : IAudioPlayer
             ThreadedMainloopSignal(_mainloop, 0);
 
             if (state == ContextState.Terminated && (_disposed || !_isPlaying))
-                _logger.LogDebug("PulseAudio context disconnected (expected): {State}", state);
+                _logger.ContextDisconnectedExpected(state);
             else
-                _logger.LogWarning("PulseAudio context disconnected: {State}", state);
+                _logger.ContextDisconnected(state);
         }
     }
 
@@ -671,7 +843,7 @@ public class PulseAudioPlayer : IAudioPlayer
     private void OnStreamStateChanged(IntPtr stream, IntPtr userdata)
     {
         var state = StreamGetState(stream);
-        _logger.LogDebug("PulseAudio stream state: {State}", state);
+        _logger.StreamStateChanged(state);
 
         if (state == StreamState.Ready)
         {
@@ -688,13 +860,11 @@ public class PulseAudioPlayer : IAudioPlayer
 
             if (state == StreamState.Terminated && (_disposed || !_isPlaying))
             {
-                _logger.LogDebug("PulseAudio stream disconnected (expected): {State}. Sink: {Sink}",
-                    state, _sinkName ?? "default");
+                _logger.StreamDisconnectedExpected(state, _sinkName ?? "default");
             }
             else
             {
-                _logger.LogWarning("PulseAudio stream disconnected: {State}. Error: {Error}. Sink: {Sink}",
-                    state, errorMsg, _sinkName ?? "default");
+                _logger.StreamDisconnected(state, errorMsg, _sinkName ?? "default");
 
                 // Fire error event so PlayerManagerService can auto-stop the player.
                 // This handles device removal (USB unplug) - with DontMove flag, PA fails the
@@ -708,6 +878,40 @@ public class PulseAudioPlayer : IAudioPlayer
         }
     }
 
+    /// <summary>
+    /// Attempts an early latency lock by confirming the seeded value against live samples.
+    /// Called from the write callback during lock-in collection.
+    /// </summary>
+    /// <returns>True if the latency was locked.</returns>
+    private bool TryLockToSeededLatency()
+    {
+        var seed = _seededLatencyMs;
+        if (seed == 0 || _latencySamples == null ||
+            _latencySamples.Count != LatencyLockWarmupSamples + WarmStartLockSampleCount)
+        {
+            return false;
+        }
+
+        var earlySamples = _latencySamples.Skip(LatencyLockWarmupSamples).OrderBy(x => x).ToList();
+        var earlyMedian = earlySamples[earlySamples.Count / 2];
+
+        if (Math.Abs(earlyMedian - seed) > WarmStartToleranceMs)
+        {
+            // Hardware or PA config changed since the seed was learned - fall back to full lock-in
+            _logger.LatencySeedRejected(seed, earlyMedian);
+            _seededLatencyMs = 0;
+            return false;
+        }
+
+        OutputLatencyMs = earlyMedian;
+        _latencyLocked = true;
+        _latencySamples = null;
+        IsLatencyWarmStarted = true;
+        LatencyLockTimeMs = (int)(DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
+        _logger.LatencyLockedEarly(OutputLatencyMs, seed, earlySamples.Count);
+        return true;
+    }
+
     /// <summary>
     /// Called by PulseAudio when it needs more audio data.
     /// </summary>
@@ -733,6 +937,7 @@ public class PulseAudioPlayer : IAudioPlayer
         {
             WriteSilence(stream, nbytes);
             _silenceWriteCount++;
+            TrackIdle(stream, silent: true);
             return;
         }
 
@@ -777,32 +982,26 @@ public class PulseAudioPlayer : IAudioPlayer
                             // Wide variance indicates unreliable timing from hardware.
                             // Use minimum + small margin instead of median to avoid massive sync errors.
                             OutputLatencyMs = Math.Min(minLatency + 20, MaxReasonableLatencyMs);
-                            _logger.LogWarning(
-                                "Latency range {Range}ms too wide (min={Min}ms, max={Max}ms). " +
-                                "Using {Latency}ms instead of median {Median}ms to avoid sync issues",
-                                range, minLatency, maxLatency, OutputLatencyMs, median);
+                            _logger.LatencyRangeTooWide(range, minLatency, maxLatency, OutputLatencyMs, median);
                         }
                         else if (median > MaxReasonableLatencyMs)
                         {
                             // Even with stable measurements, cap at reasonable maximum
                             OutputLatencyMs = MaxReasonableLatencyMs;
-                            _logger.LogWarning(
-                                "Measured latency {Median}ms exceeds maximum, capping to {Max}ms",
-                                median, MaxReasonableLatencyMs);
+                            _logger.LatencyCapped(median, MaxReasonableLatencyMs);
                         }
                         else
                         {
                             // Normal case: use median
                             OutputLatencyMs = median;
-                            _logger.LogInformation(
-                                "Latency locked at {Latency}ms (median of {Count} samples, range: {Min}-{Max}ms)",
-                                OutputLatencyMs, stableSamples.Count, minLatency, maxLatency);
+                            _logger.LatencyLocked(OutputLatencyMs, stableSamples.Count, minLatency, maxLatency);
                         }
 
                         _latencyLocked = true;
                         _latencySamples = null; // Free memory
+                        LatencyLockTimeMs = (int)(DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
                     }
-                    else
+                    else if (!TryLockToSeededLatency())
                     {
                         // During collection: use current measurement (with hysteresis)
                         if (Math.Abs(newLatencyMs - OutputLatencyMs) > 5)
@@ -819,20 +1018,19 @@ public class PulseAudioPlayer : IAudioPlayer
         // The volatile keyword ensures we see the latest values written by other threads.
         var source = _sampleSource;
         var sampleBuffer = _sampleBuffer;
-        var byteBuffer = _byteBuffer;
+        var gainRamp = _gainRamp;
 
-        if (source == null || sampleBuffer == null || byteBuffer == null)
+        if (source == null || sampleBuffer == null || gainRamp == null)
         {
             // Sample source not set yet - write silence to keep stream happy
             WriteSilence(stream, nbytes);
             _silenceWriteCount++;
+            TrackIdle(stream, silent: true);
 
             // Log periodically during startup when source isn't ready
             if (_callbackCount % DiagnosticLogInterval == 0)
             {
-                _logger.LogDebug(
-                    "Waiting for sample source: callbacks={Callbacks}, silence={Silence}",
-                    _callbackCount, _silenceWriteCount);
+                _logger.WaitingForSampleSource(_callbackCount, _silenceWriteCount);
             }
             return;
         }
@@ -844,9 +1042,7 @@ public class PulseAudioPlayer : IAudioPlayer
         // Warn if PA requests more than our buffer (shouldn't happen with larger buffer)
         if (samplesRequested > sampleBuffer.Length)
         {
-            _logger.LogWarning(
-                "PA requested {Requested} samples but buffer is {BufferSize}. Capping request.",
-                samplesRequested, sampleBuffer.Length);
+            _logger.WriteRequestCapped(samplesRequested, sampleBuffer.Length);
             samplesRequested = sampleBuffer.Length;
         }
 
@@ -860,45 +1056,47 @@ public class PulseAudioPlayer : IAudioPlayer
             WriteSilence(stream, nbytes);
             _silenceWriteCount++;
             _zeroReadCount++;
+            TrackIdle(stream, silent: true);
 
             // Log periodically when Read() returns 0 - indicates SDK hasn't started releasing samples
             if (_callbackCount % DiagnosticLogInterval == 0)
             {
                 var elapsed = (DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
-                _logger.LogDebug(
-                    "Read returned 0: elapsed={Elapsed:F0}ms, callbacks={Callbacks}, zeroReads={ZeroReads}, latency={Latency}ms",
-                    elapsed, _callbackCount, _zeroReadCount, OutputLatencyMs);
+                _logger.PlayerZeroRead(elapsed, _callbackCount, _zeroReadCount, OutputLatencyMs);
             }
             return;
         }
 
+        // The buffered source always fills the request; it flags reads that were only silence
+        var silent = source is BufferedAudioSampleSource { LastReadWasEmpty: true };
+        TrackIdle(stream, silent);
+
+        if (!silent && _wakeTimestamp != 0)
+        {
+            var wakeToAudio = Stopwatch.GetElapsedTime(Interlocked.Exchange(ref _wakeTimestamp, 0));
+            LastWakeToAudioMs = (int)wakeToAudio.TotalMilliseconds;
+            _logger.IdleWakeToAudio(wakeToAudio.TotalMilliseconds);
+        }
+
         // Log first successful audio read - important milestone for debugging startup
         if (!_hasLoggedFirstAudio)
         {
             _hasLoggedFirstAudio = true;
             var elapsed = (DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
-            _logger.LogInformation(
-                "First audio samples received: elapsed={Elapsed:F0}ms, callbacks={Callbacks}, " +
-                "silenceWrites={Silence}, zeroReads={ZeroReads}, latency={Latency}ms",
-                elapsed, _callbackCount, _silenceWriteCount, _zeroReadCount, OutputLatencyMs);
+            _logger.FirstAudioReceived(elapsed, _callbackCount, _silenceWriteCount, _zeroReadCount, OutputLatencyMs);
         }
 
-        // Apply software volume and mute
-        var vol = IsMuted ? 0f : Volume;
-        for (int i = 0; i < samplesRead; i++)
-        {
-            sampleBuffer[i] *= vol;
-        }
+        // Apply software volume and mute, ramping across changes
+        var samples = sampleBuffer.AsSpan(0, samplesRead);
+        GainRamp.Scale(samples, gainRamp.Process(samples, IsMuted ? 0f : Volume));
 
-        // Convert float samples to bytes for pa_stream_write
-        Buffer.BlockCopy(sampleBuffer, 0, byteBuffer, 0, samplesRead * bytesPerSample);
-
-        // Write audio data to PulseAudio stream.
+        // Write audio data to PulseAudio stream straight from the float buffer
+        // (FLOAT32LE is the in-memory layout, so no byte conversion is needed).
         // SeekMode.Relative: append to current write position (normal streaming mode).
-        // freeCallback=null: we manage our own buffer, PA should not free it.
+        // freeCallback=null: PA copies the data before returning, we keep our buffer.
         unsafe
         {
-            fixed (byte* ptr = byteBuffer)
+            fixed (float* ptr = sampleBuffer)
             {
                 var result = StreamWrite(
                     stream,
@@ -910,12 +1108,48 @@ public class PulseAudioPlayer : IAudioPlayer
 
                 if (result < 0)
                 {
-                    _logger.LogDebug("PulseAudio stream write failed");
+                    _logger.StreamWriteFailed();
                 }
             }
         }
     }
 
+    /// <summary>
+    /// Tracks continuous silence in the write callback and corks the stream once it has
+    /// lasted <see cref="_idleCorkDelay"/>, unless <see cref="IdleCorkAllowed"/> is false.
+    /// Runs on the PA thread (mainloop lock held).
+    /// </summary>
+    private void TrackIdle(IntPtr stream, bool silent)
+    {
+        if (!silent || !_idleCorkAllowed)
+        {
+            _idleSinceTimestamp = 0;
+            return;
+        }
+
+        if (_idleCorkDelay <= TimeSpan.Zero || _idleCorked)
+            return;
+
+        var now = Stopwatch.GetTimestamp();
+        if (_idleSinceTimestamp == 0)
+        {
+            _idleSinceTimestamp = now;
+            return;
+        }
+
+        var idle = Stopwatch.GetElapsedTime(_idleSinceTimestamp, now);
+        if (idle < _idleCorkDelay)
+            return;
+
+        // Corking from the callback is safe: it only queues an operation on this mainloop
+        StreamCork(stream, 1, IntPtr.Zero, IntPtr.Zero);
+        _idleCorked = true;
+        Interlocked.Exchange(ref _idleCorkedTimestamp, now);
+        Interlocked.Exchange(ref _wakeTimestamp, 0);
+        Interlocked.Increment(ref _idleCorkCount);
+        _logger.IdleCorked(idle.TotalMilliseconds, _callbackCount, _silenceWriteCount);
+    }
+
     /// <summary>
     /// Called when an underflow occurs (buffer ran out of data).
     /// </summary>
@@ -927,21 +1161,16 @@ public class PulseAudioPlayer : IAudioPlayer
         if (_underflowCount == 1)
         {
             var elapsed = (DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
-            _logger.LogDebug(
-                "First underflow at {Elapsed:F0}ms after play. callbacks={Callbacks}, zeroReads={ZeroReads}",
-                elapsed, _callbackCount, _zeroReadCount);
+            _logger.FirstUnderflow(elapsed, _callbackCount, _zeroReadCount);
         }
         else if (_underflowCount == UnderflowWarningThreshold)
         {
             var elapsed = (DateTime.UtcNow - _playbackStartTime).TotalMilliseconds;
-            _logger.LogWarning(
-                "Audio underflow detected ({Count} times at {Elapsed:F0}ms). " +
-                "callbacks={Callbacks}, zeroReads={ZeroReads}, latency={Latency}ms",
-                _underflowCount, elapsed, _callbackCount, _zeroReadCount, OutputLatencyMs);
+            _logger.UnderflowDetected(_underflowCount, elapsed, _callbackCount, _zeroReadCount, OutputLatencyMs);
         }
         else if (_underflowCount % 100 == 0)
         {
-            _logger.LogDebug("Underflow count: {Count}", _underflowCount);
+            _logger.UnderflowCount(_underflowCount);
         }
     }
 
@@ -977,6 +1206,11 @@ public class PulseAudioPlayer : IAudioPlayer
         _contextReady = false;
         _streamReady = false;
 
+        // A new stream starts corked until Play(); it is not idle-corked
+        _idleCorked = false;
+        _idleSinceTimestamp = 0;
+        Interlocked.Exchange(ref _idleCorkedTimestamp, 0);
+
         if (_stream != IntPtr.Zero)
         {
             if (_mainloop != IntPtr.Zero)
@@ -1027,7 +1261,7 @@ public class PulseAudioPlayer : IAudioPlayer
         _underflowCallback = null;
 
         _sampleBuffer = null;
-        _byteBuffer = null;
+        _gainRamp = null;
     }
 
     private void SetState(AudioPlayerState newState)
@@ -1036,7 +1270,7 @@ public class PulseAudioPlayer : IAudioPlayer
         {
             var oldState = State;
             State = newState;
-            _logger.LogDebug("State changed: {OldState} -> {NewState}", oldState, newState);
+            _logger.PlayerStateChanged(oldState, newState);
             StateChanged?.Invoke(this, newState);
         }
     }
@@ -0,0 +1,438 @@
+using System.Diagnostics;
+using Microsoft.Extensions.Logging;
+using static MultiRoomAudio.Audio.PulseAudio.PulseAudioNative;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// Plays one <see cref="SignalGenerator"/> signal to a sink through its own pa_stream.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Replaces writing a WAV to a temp file and running paplay. The signal is rendered straight
+/// into the write callback's buffer, so a tone costs one PulseAudio connection and no
+/// process or file. Each playback has its own mainloop and stream, so tones on different
+/// sinks play at the same time.
+/// </para>
+/// <para>
+/// The stream's channel map says where the signal goes: a single-channel map with
+/// <c>noRemix</c> (paplay's <c>--no-remix --channel-map=side-left</c>) plays on exactly that
+/// channel of the sink. Channels of the map not marked active are written as silence. Once the
+/// generator is exhausted the stream is drained and playback completes when PulseAudio has
+/// played the last sample.
+/// </para>
+/// <para>
+/// While playing, each write callback pairs the stream time (the position PulseAudio says is
+/// being heard, sink latency included) with the local clock. Their difference is when the first
+/// sample was heard, which latency calibration compares against a recording of the signal.
+/// </para>
+/// </remarks>
+internal sealed class PulseAudioSignalPlayer : IDisposable
+{
+    private const int ConnectionTimeoutMs = 5000;
+
+    /// <summary>
+    /// Target buffer size. Short, so a tone starts almost as soon as it is requested.
+    /// </summary>
+    private const int BufferMs = 50;
+
+    /// <summary>
+    /// Largest write, in frames. PA asks for about <see cref="BufferMs"/> at a time.
+    /// </summary>
+    private const int FramesPerWrite = 8192;
+
+    /// <summary>
+    /// Start time estimates kept; the median of these is reported.
+    /// </summary>
+    private const int MaxStartEstimates = 64;
+
+    private readonly ILogger _logger;
+    private readonly string _sinkName;
+    private readonly string[] _channelMap;
+    private readonly bool[] _activeChannels;
+    private readonly SignalGenerator _generator;
+    private readonly TaskCompletionSource _completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+    // PulseAudio async API handles
+    private IntPtr _mainloop = IntPtr.Zero;
+    private IntPtr _context = IntPtr.Zero;
+    private IntPtr _stream = IntPtr.Zero;
+
+    // CRITICAL: Store callbacks as fields to prevent GC collection
+    private ContextNotifyCallback? _contextStateCallback;
+    private StreamNotifyCallback? _streamStateCallback;
+    private StreamRequestCallback? _writeCallback;
+    private StreamSuccessCallback? _drainCallback;
+
+    private volatile bool _contextReady;
+    private volatile bool _streamReady;
+    private volatile bool _closing;
+    private bool _draining;
+    private bool _disposed;
+
+    // Touched only on the PA thread
+    private readonly float[] _signalBuffer = new float[FramesPerWrite];
+    private readonly float[] _frameBuffer;
+    private readonly List<double> _startEstimates = new(MaxStartEstimates);
+
+    private PulseAudioSignalPlayer(ILogger logger, string sinkName, string[] channelMap, bool[] activeChannels,
+        SignalGenerator generator)
+    {
+        _logger = logger;
+        _sinkName = sinkName;
+        _channelMap = channelMap;
+        _activeChannels = activeChannels;
+        _generator = generator;
+        _frameBuffer = new float[FramesPerWrite * channelMap.Length];
+    }
+
+    /// <summary>
+    /// Plays a signal to a sink and completes when it has finished playing.
+    /// </summary>
+    /// <param name="logger">Logger for diagnostic output.</param>
+    /// <param name="sinkName">PulseAudio sink name.</param>
+    /// <param name="channelMap">Position of each stream channel (e.g. ["front-left", "front-right"]).</param>
+    /// <param name="activeChannels">Which stream channels carry the signal; the rest are silent.</param>
+    /// <param name="generator">Signal to play.</param>
+    /// <param name="sampleRate">Rate the generator was created for.</param>
+    /// <param name="noRemix">Keep PulseAudio from upmixing the stream onto other sink channels.</param>
+    /// <param name="timeout">Longest the playback may take, connection included.</param>
+    /// <param name="ct">Cancels playback immediately.</param>
+    /// <returns>
+    /// When the first sample was heard according to PulseAudio, in <see cref="Stopwatch"/> time
+    /// (microseconds), or null if the stream reported no timing.
+    /// </returns>
+    /// <exception cref="InvalidOperationException">PulseAudio is not reachable or rejected the stream.</exception>
+    /// <exception cref="TimeoutException">Playback did not finish within <paramref name="timeout"/>.</exception>
+    public static async Task<double?> PlayAsync(
+        ILogger logger,
+        string sinkName,
+        string[] channelMap,
+        bool[] activeChannels,
+        SignalGenerator generator,
+        int sampleRate,
+        bool noRemix,
+        TimeSpan timeout,
+        CancellationToken ct)
+    {
+        if (channelMap.Length == 0 || channelMap.Length != activeChannels.Length)
+            throw new ArgumentException("Every stream channel needs a position", nameof(channelMap));
+
+        using var player = new PulseAudioSignalPlayer(logger, sinkName, channelMap, activeChannels, generator);
+        player.Open(sampleRate, noRemix);
+
+        try
+        {
+            await player._completion.Task.WaitAsync(timeout, ct);
+        }
+        catch (TimeoutException)
+        {
+            throw new TimeoutException($"Test tone playback timed out after {timeout.TotalMilliseconds}ms");
+        }
+
+        // No write callback runs once draining has started
+        if (player._startEstimates.Count == 0)
+            return null;
+
+        player._startEstimates.Sort();
+        return player._startEstimates[player._startEstimates.Count / 2];
+    }
+
+    /// <summary>
+    /// Connects to PulseAudio and starts the stream. Writes begin from the PA thread.
+    /// </summary>
+    private void Open(int sampleRate, bool noRemix)
+    {
+        try
+        {
+            _mainloop = ThreadedMainloopNew();
+            if (_mainloop == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to create PulseAudio mainloop");
+
+            var api = ThreadedMainloopGetApi(_mainloop);
+            _context = ContextNew(api, "MultiRoomAudio-Signal");
+            if (_context == IntPtr.Zero)
+                throw new InvalidOperationException("Failed to create PulseAudio context");
+
+            _contextStateCallback = OnContextStateChanged;
+            ContextSetStateCallback(_context, _contextStateCallback, IntPtr.Zero);
+
+            if (ThreadedMainloopStart(_mainloop) < 0)
+                throw new InvalidOperationException("Failed to start PulseAudio mainloop");
+
+            var sampleSpec = new SampleSpec
+            {
+                Format = SampleFormat.FLOAT32LE,
+                Rate = (uint)sampleRate,
+                Channels = (byte)_channelMap.Length
+            };
+
+            var channelMap = new ChannelMap { Map = new int[ChannelsMax] };
+            if (ChannelMapParse(ref channelMap, string.Join(",", _channelMap)) == IntPtr.Zero)
+                throw new InvalidOperationException($"Unrecognised channel map: {string.Join(",", _channelMap)}");
+
+            ThreadedMainloopLock(_mainloop);
+            try
+            {
+                if (ContextConnect(_context, null, 0, IntPtr.Zero) < 0)
+                    throw new InvalidOperationException("Failed to connect to PulseAudio server");
+
+                var timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+                while (!_contextReady)
+                {
+                    var state = ContextGetState(_context);
+                    if (state == ContextState.Failed || state == ContextState.Terminated)
+                        throw new InvalidOperationException($"PulseAudio context failed: {GetContextError(_context)}");
+                    if (DateTime.UtcNow > timeout)
+                        throw new TimeoutException("Timeout waiting for PulseAudio context");
+
+                    ThreadedMainloopWait(_mainloop);
+                }
+
+                _stream = StreamNew(_context, "Test Signal", ref sampleSpec, ref channelMap);
+                if (_stream == IntPtr.Zero)
+                    throw new InvalidOperationException("Failed to create PulseAudio stream");
+
+                _streamStateCallback = OnStreamStateChanged;
+                _writeCallback = OnWriteCallback;
+                _drainCallback = OnDrained;
+                StreamSetStateCallback(_stream, _streamStateCallback, IntPtr.Zero);
+                StreamSetWriteCallback(_stream, _writeCallback, IntPtr.Zero);
+
+                var targetLatencyBytes = BytesForMs(ref sampleSpec, BufferMs);
+                var bufferAttr = new BufferAttr
+                {
+                    MaxLength = uint.MaxValue,
+                    TLength = targetLatencyBytes,
+                    PreBuf = uint.MaxValue,
+                    MinReq = BytesForMs(ref sampleSpec, 10),
+                    FragSize = uint.MaxValue
+                };
+
+                var flags = StreamFlags.AdjustLatency | StreamFlags.InterpolateTiming | StreamFlags.AutoTimingUpdate;
+                if (noRemix)
+                    flags |= StreamFlags.NoRemix;
+
+                if (StreamConnectPlayback(_stream, _sinkName, ref bufferAttr, flags, IntPtr.Zero, IntPtr.Zero) < 0)
+                    throw new InvalidOperationException($"Failed to connect PulseAudio stream: {GetContextError(_context)}");
+
+                timeout = DateTime.UtcNow.AddMilliseconds(ConnectionTimeoutMs);
+                while (!_streamReady)
+                {
+                    var state = StreamGetState(_stream);
+                    if (state == StreamState.Failed || state == StreamState.Terminated)
+                        throw new InvalidOperationException(
+                            $"PulseAudio stream failed: {GetContextError(_context)}. Sink: {_sinkName}");
+                    if (DateTime.UtcNow > timeout)
+                        throw new TimeoutException("Timeout waiting for PulseAudio stream");
+
+                    ThreadedMainloopWait(_mainloop);
+                }
+            }
+            finally
+            {
+                ThreadedMainloopUnlock(_mainloop);
+            }
+
+            _logger.LogDebug("Playing {Frames} frames of test signal on {Sink} ({Map}{NoRemix})",
+                _generator.TotalFrames, _sinkName, string.Join(",", _channelMap), noRemix ? ", no remix" : "");
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "Failed to open test signal stream on {Sink}", _sinkName);
+            CleanupResources();
+            throw;
+        }
+    }
+
+    private void OnContextStateChanged(IntPtr context, IntPtr userdata)
+    {
+        var state = ContextGetState(context);
+        _logger.ContextStateChanged(state);
+
+        if (state == ContextState.Ready)
+        {
+            _contextReady = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == ContextState.Failed || state == ContextState.Terminated)
+        {
+            _contextReady = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+
+            if (!_closing)
+                _completion.TrySetException(new InvalidOperationException("PulseAudio connection lost"));
+        }
+    }
+
+    private void OnStreamStateChanged(IntPtr stream, IntPtr userdata)
+    {
+        var state = StreamGetState(stream);
+        _logger.StreamStateChanged(state);
+
+        if (state == StreamState.Ready)
+        {
+            _streamReady = true;
+            ThreadedMainloopSignal(_mainloop, 0);
+        }
+        else if (state == StreamState.Failed || state == StreamState.Terminated)
+        {
+            _streamReady = false;
+            ThreadedMainloopSignal(_mainloop, 0);
+
+            if (!_closing)
+            {
+                _completion.TrySetException(new InvalidOperationException(
+                    $"Test signal stream on '{_sinkName}' failed: {GetContextError(_context)}"));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Renders the next block of the signal into the stream's channel layout.
+    /// Runs on the PA mainloop thread (lock already held).
+    /// </summary>
+    private void OnWriteCallback(IntPtr stream, UIntPtr nbytes, IntPtr userdata)
+    {
+        if (_draining)
+            return;
+
+        var channels = _channelMap.Length;
+        var frames = (int)Math.Min((ulong)nbytes / (ulong)(sizeof(float) * channels), FramesPerWrite);
+        var framesRead = _generator.Read(_signalBuffer.AsSpan(0, frames));
+
+        if (framesRead > 0)
+        {
+            var output = _frameBuffer.AsSpan(0, framesRead * channels);
+            if (channels == 1)
+            {
+                _signalBuffer.AsSpan(0, framesRead).CopyTo(output);
+            }
+            else
+            {
+                for (var f = 0; f < framesRead; f++)
+                {
+                    var sample = _signalBuffer[f];
+                    for (var c = 0; c < channels; c++)
+                    {
+                        output[f * channels + c] = _activeChannels[c] ? sample : 0f;
+                    }
+                }
+            }
+
+            unsafe
+            {
+                fixed (float* ptr = _frameBuffer)
+                {
+                    if (StreamWrite(stream, (IntPtr)ptr, (UIntPtr)(output.Length * sizeof(float)),
+                            IntPtr.Zero, 0, SeekMode.Relative) < 0)
+                    {
+                        _logger.StreamWriteFailed();
+                    }
+                }
+            }
+        }
+
+        RecordStartEstimate(stream);
+
+        if (_generator.IsFinished)
+        {
+            // Drain also starts playback of a signal shorter than the prebuffer
+            _draining = true;
+            var op = StreamDrain(stream, _drainCallback!, IntPtr.Zero);
+            if (op == IntPtr.Zero)
+            {
+                _completion.TrySetResult();
+                return;
+            }
+            OperationUnref(op);
+        }
+    }
+
+    /// <summary>
+    /// Notes when the first sample was heard, once playback has started.
+    /// </summary>
+    private void RecordStartEstimate(IntPtr stream)
+    {
+        if (_startEstimates.Count >= MaxStartEstimates)
+            return;
+
+        if (StreamGetTime(stream, out var streamTimeUs) != 0 || streamTimeUs == 0)
+            return;
+
+        var nowUs = Stopwatch.GetTimestamp() * 1_000_000.0 / Stopwatch.Frequency;
+        _startEstimates.Add(nowUs - streamTimeUs);
+    }
+
+    private void OnDrained(IntPtr stream, int success, IntPtr userdata)
+    {
+        if (success == 0)
+            _logger.LogDebug("Test signal drain on {Sink} did not complete", _sinkName);
+
+        _completion.TrySetResult();
+    }
+
+    private void CleanupResources()
+    {
+        _closing = true;
+
+        if (_stream != IntPtr.Zero)
+        {
+            if (_mainloop != IntPtr.Zero)
+            {
+                ThreadedMainloopLock(_mainloop);
+                try
+                {
+                    StreamDisconnect(_stream);
+                }
+                finally
+                {
+                    ThreadedMainloopUnlock(_mainloop);
+                }
+            }
+            StreamUnref(_stream);
+            _stream = IntPtr.Zero;
+        }
+
+        if (_context != IntPtr.Zero)
+        {
+            if (_mainloop != IntPtr.Zero)
+            {
+                ThreadedMainloopLock(_mainloop);
+                try
+                {
+                    ContextDisconnect(_context);
+                }
+                finally
+                {
+                    ThreadedMainloopUnlock(_mainloop);
+                }
+            }
+            ContextUnref(_context);
+            _context = IntPtr.Zero;
+        }
+
+        if (_mainloop != IntPtr.Zero)
+        {
+            ThreadedMainloopStop(_mainloop);
+            ThreadedMainloopFree(_mainloop);
+            _mainloop = IntPtr.Zero;
+        }
+
+        _contextStateCallback = null;
+        _streamStateCallback = null;
+        _writeCallback = null;
+        _drainCallback = null;
+        _contextReady = false;
+        _streamReady = false;
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+
+        _disposed = true;
+        CleanupResources();
+    }
+}
@@ -0,0 +1,366 @@
+using Sendspin.SDK.Audio;
+using Sendspin.SDK.Models;
+
+namespace MultiRoomAudio.Audio.PulseAudio;
+
+/// <summary>
+/// IAudioPlayer for one zone of a multichannel card, played through a shared
+/// <see cref="PulseAudioChannelRouter"/> instead of its own pa_stream.
+/// </summary>
+/// <remarks>
+/// Used for remap sinks configured with <c>in_process: true</c>. The zone owns its sample
+/// source, volume and mute; the router owns the stream, so the audio clock and output
+/// latency reported here are the card's and identical for every zone on it.
+/// </remarks>
+public class RoutedZonePlayer : IAudioPlayer, IRoutedZone
+{
+    private readonly ILogger<RoutedZonePlayer> _logger;
+    private readonly Func<PulseAudioChannelRouter> _acquireRouter;
+    private readonly object _lock = new();
+
+    // Held from initialization until disposal. The SDK may re-initialize a disposed
+    // player, which takes a fresh reference (the old router may have closed).
+    private volatile PulseAudioChannelRouter? _router;
+
+    // Card channel for each of the zone's output channels (remap channel mappings, in order)
+    private readonly int[] _targetChannels;
+
+    // Read by the router's write callback on the PA thread - see PulseAudioPlayer for the pattern
+    private volatile IAudioSampleSource? _sampleSource;
+    private volatile float[]? _readBuffer;
+    private volatile GainRamp? _gainRamp;
+    private volatile int[] _routeSources = Array.Empty<int>();
+    private volatile int[] _routeTargets = Array.Empty<int>();
+    private volatile float _downmixGain = 1f;
+    private volatile int _sourceStride;
+    private volatile bool _isPlaying;
+    private volatile bool _isPaused;
+    private volatile bool _disposed;
+    private volatile float _volume = 1.0f;
+    private volatile bool _isMuted;
+
+    private AudioFormat? _currentFormat;
+    private bool _hasLoggedFirstAudio;
+    private DateTime _playbackStartTime;
+
+    /// <summary>
+    /// Frames read from the sample source per write. Matches the router's write size.
+    /// </summary>
+    private const int FramesPerWrite = 6144;
+
+    private const int InitialLatencyEstimateMs = 70;
+
+    /// <summary>
+    /// Name of the routed (virtual) sink this zone represents.
+    /// </summary>
+    public string SinkName { get; }
+
+    /// <summary>
+    /// Physical sink the zone is routed onto.
+    /// </summary>
+    public string MasterSink { get; }
+
+    public AudioPlayerState State { get; private set; } = AudioPlayerState.Uninitialized;
+
+    public float Volume
+    {
+        get => _volume;
+        set => _volume = Math.Clamp(value, 0f, 1f);
+    }
+
+    public bool IsMuted
+    {
+        get => _isMuted;
+        set => _isMuted = value;
+    }
+
+    /// <summary>
+    /// The card's shared output latency.
+    /// </summary>
+    public int OutputLatencyMs => _router?.OutputLatencyMs ?? InitialLatencyEstimateMs;
+
+    /// <summary>
+    /// Whether the card's shared latency measurement has locked.
+    /// </summary>
+    public bool IsLatencyLocked => _router?.IsLatencyLocked ?? false;
+
+    private bool IsActive => _isPlaying && !_isPaused && !_disposed;
+
+    bool IRoutedZone.IsPlaying => _isPlaying;
+
+    bool IRoutedZone.IsActive => IsActive;
+
+    public event EventHandler<AudioPlayerState>? StateChanged;
+    public event EventHandler<AudioPlayerError>? ErrorOccurred;
+
+    internal RoutedZonePlayer(
+        ILogger<RoutedZonePlayer> logger,
+        string sinkName,
+        string masterSink,
+        Func<PulseAudioChannelRouter> acquireRouter,
+        int[] targetChannels)
+    {
+        _logger = logger;
+        SinkName = sinkName;
+        MasterSink = masterSink;
+        _acquireRouter = acquireRouter;
+        _targetChannels = targetChannels;
+    }
+
+    /// <summary>
+    /// Playback time of the card's shared stream, in Unix epoch microseconds.
+    /// </summary>
+    public long? GetAudioClockMicroseconds()
+    {
+        var router = _router;
+        return _isPlaying && !_disposed && router != null ? router.GetAudioClockMicroseconds() : null;
+    }
+
+    public Task InitializeAsync(AudioFormat format, CancellationToken cancellationToken = default)
+    {
+        if (_isPlaying)
+        {
+            Stop();
+        }
+
+        lock (_lock)
+        {
+            _disposed = false;
+
+            try
+            {
+                _logger.LogInformation(
+                    "Initializing routed zone '{Zone}': {SampleRate}Hz, {Channels}ch -> {Sink} channels [{Targets}]",
+                    SinkName, format.SampleRate, format.Channels, MasterSink, string.Join(",", _targetChannels));
+
+                BuildRoutes(format.Channels);
+                _readBuffer = new float[FramesPerWrite * format.Channels];
+                _gainRamp = new GainRamp(format.Channels, format.SampleRate);
+                _currentFormat = format;
+
+                _router ??= _acquireRouter();
+                _router.Attach(this, format.SampleRate);
+
+                SetState(AudioPlayerState.Stopped);
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "Failed to initialize routed zone '{Zone}'", SinkName);
+                SetState(AudioPlayerState.Error);
+                OnError("Initialization failed", ex);
+                throw;
+            }
+        }
+
+        return Task.CompletedTask;
+    }
+
+    public void SetSampleSource(IAudioSampleSource source)
+    {
+        _sampleSource = source;
+        _logger.LogDebug("Sample source set");
+    }
+
+    public void Play()
+    {
+        lock (_lock)
+        {
+            if (_readBuffer == null)
+            {
+                _logger.LogWarning("Cannot play - not initialized");
+                return;
+            }
+
+            if (_isPlaying && !_isPaused)
+                return;
+
+            if (!EnsureAttached())
+                return;
+
+            _isPlaying = true;
+            _isPaused = false;
+            _hasLoggedFirstAudio = false;
+            _playbackStartTime = DateTime.UtcNow;
+        }
+
+        _router?.UpdatePlayback();
+        SetState(AudioPlayerState.Playing);
+        _logger.LogInformation("Routed zone '{Zone}' playing on {Sink}", SinkName, MasterSink);
+    }
+
+    public void Pause()
+    {
+        lock (_lock)
+        {
+            if (!_isPlaying)
+                return;
+
+            _isPaused = true;
+        }
+
+        _router?.UpdatePlayback();
+        SetState(AudioPlayerState.Paused);
+        _logger.LogInformation("Routed zone '{Zone}' paused", SinkName);
+    }
+
+    public void Stop()
+    {
+        lock (_lock)
+        {
+            _isPlaying = false;
+            _isPaused = false;
+        }
+
+        _router?.UpdatePlayback();
+        SetState(AudioPlayerState.Stopped);
+        _logger.LogInformation("Routed zone '{Zone}' stopped", SinkName);
+    }
+
+    /// <summary>
+    /// Re-attaches to the same routed sink (stream recovery). A routed zone is bound to its
+    /// card's router, so switching to a different sink requires recreating the player.
+    /// </summary>
+    public async Task SwitchDeviceAsync(string? deviceId, CancellationToken cancellationToken = default)
+    {
+        if (!string.Equals(deviceId, SinkName, StringComparison.Ordinal))
+        {
+            throw new InvalidOperationException(
+                $"Routed zone '{SinkName}' cannot hot-switch to '{deviceId ?? "default"}'; restart the player instead");
+        }
+
+        var wasPlaying = State == AudioPlayerState.Playing;
+        var format = _currentFormat;
+
+        Stop();
+
+        if (format != null)
+        {
+            await InitializeAsync(format, cancellationToken);
+            if (wasPlaying)
+            {
+                Play();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Attaches again if another zone on the card reopened the stream at its own rate while
+    /// this one was stopped. Caller holds _lock.
+    /// </summary>
+    /// <returns>False if the card is now playing at another rate.</returns>
+    private bool EnsureAttached()
+    {
+        var router = _router;
+        var format = _currentFormat;
+        if (router == null || format == null || router.IsAttached(this, format.SampleRate))
+            return true;
+
+        try
+        {
+            _logger.LogInformation("Routed zone '{Zone}' re-attaching to {Sink} at {SampleRate}Hz",
+                SinkName, MasterSink, format.SampleRate);
+            router.Attach(this, format.SampleRate);
+            return true;
+        }
+        catch (InvalidOperationException ex)
+        {
+            _logger.LogError(ex, "Routed zone '{Zone}' cannot play", SinkName);
+            SetState(AudioPlayerState.Error);
+            OnError(ex.Message, ex);
+            return false;
+        }
+    }
+
+    private void BuildRoutes(int sourceChannels)
+    {
+        var (sources, targets, downmixGain) = PulseAudioChannelRouter.BuildRoutes(sourceChannels, _targetChannels);
+        _routeSources = sources;
+        _routeTargets = targets;
+        _downmixGain = downmixGain;
+        _sourceStride = sourceChannels;
+    }
+
+    /// <summary>
+    /// Reads this zone's next frames and adds them to the card frame.
+    /// Called by the router's write callback on the PA thread.
+    /// </summary>
+    void IRoutedZone.MixInto(Span<float> output, int outputChannels, int frames)
+    {
+        if (!IsActive)
+            return;
+
+        var source = _sampleSource;
+        var buffer = _readBuffer;
+        var gainRamp = _gainRamp;
+        var stride = _sourceStride;
+        if (source == null || buffer == null || gainRamp == null || stride == 0)
+            return;
+
+        var samplesRead = source.Read(buffer, 0, Math.Min(frames * stride, buffer.Length));
+        var framesRead = samplesRead / stride;
+        if (framesRead == 0)
+            return;
+
+        if (!_hasLoggedFirstAudio)
+        {
+            _hasLoggedFirstAudio = true;
+            _logger.FirstAudioReceived(
+                (DateTime.UtcNow - _playbackStartTime).TotalMilliseconds, 0, 0, 0, OutputLatencyMs);
+        }
+
+        // Volume changes ramp in place; the steady gain is folded into the scatter
+        var gain = gainRamp.Process(buffer.AsSpan(0, framesRead * stride), _isMuted ? 0f : _volume);
+
+        PulseAudioChannelRouter.ScatterFrames(
+            buffer, stride, output, outputChannels, framesRead,
+            _routeSources, _routeTargets, gain * _downmixGain);
+    }
+
+    /// <summary>
+    /// Called by the router (off the PA thread) when the card's stream fails.
+    /// </summary>
+    void IRoutedZone.OnRouterError(string message)
+    {
+        if (_disposed || !_isPlaying)
+            return;
+
+        OnError(message);
+    }
+
+    private void SetState(AudioPlayerState newState)
+    {
+        if (State != newState)
+        {
+            var oldState = State;
+            State = newState;
+            _logger.PlayerStateChanged(oldState, newState);
+            StateChanged?.Invoke(this, newState);
+        }
+    }
+
+    private void OnError(string message, Exception? ex = null)
+    {
+        ErrorOccurred?.Invoke(this, new AudioPlayerError(message, ex));
+    }
+
+    public ValueTask DisposeAsync()
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+                return ValueTask.CompletedTask;
+
+            _disposed = true;
+            _isPlaying = false;
+            _isPaused = false;
+        }
+
+        _router?.Release(this);
+        _router = null;
+        _readBuffer = null;
+        _gainRamp = null;
+
+        _logger.LogInformation("Routed zone '{Zone}' disposed", SinkName);
+        return ValueTask.CompletedTask;
+    }
+}
@@ -0,0 +1,216 @@
+namespace MultiRoomAudio.Audio;
+
+/// <summary>
+/// Test and measurement signals produced by <see cref="SignalGenerator"/>.
+/// </summary>
+public enum TestSignal
+{
+    /// <summary>Sine tone at a fixed frequency (device and channel identification).</summary>
+    Sine,
+
+    /// <summary>Pink (1/f) noise, equal energy per octave (level matching).</summary>
+    PinkNoise,
+
+    /// <summary>Exponential sine sweep from 20 Hz to 20 kHz (frequency and impulse response).</summary>
+    LogSweep,
+
+    /// <summary>Maximum length sequence, a periodic pseudo-random ±1 signal (latency by correlation).</summary>
+    Mls
+}
+
+/// <summary>
+/// Streams a mono test signal block by block, so it can be rendered straight into a
+/// playback buffer without building the whole signal first.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Sine, pink noise and sweeps fade in and out (50 ms or 10% of the duration, as the WAV
+/// tones did) so they start and stop without a click. An MLS is not faded: its flat
+/// spectrum and single-peak autocorrelation depend on every period being complete.
+/// </para>
+/// <para>
+/// The noise source is seeded, so two generators with the same settings produce identical
+/// output and a played signal can be regenerated as a reference.
+/// </para>
+/// </remarks>
+internal sealed class SignalGenerator
+{
+    /// <summary>
+    /// Default output level (about -8 dBFS), matching the previous WAV test tones.
+    /// </summary>
+    public const float DefaultAmplitude = 0.4f;
+
+    /// <summary>
+    /// MLS register length. 2^15 - 1 = 32767 samples per period (~0.7 s at 48 kHz), longer
+    /// than any output latency to be measured.
+    /// </summary>
+    public const int MlsOrder = 15;
+
+    private const double SweepStartHz = 20;
+    private const double SweepEndHz = 20000;
+
+    // Galois feedback mask for x^15 + x^14 + 1 (primitive, so the period is 2^15 - 1)
+    private const uint MlsTaps = 0x6000;
+
+    private readonly TestSignal _signal;
+    private readonly int _sampleRate;
+    private readonly float _amplitude;
+    private readonly int _fadeFrames;
+
+    // Sine
+    private readonly double _phaseIncrement;
+    private double _phase;
+
+    // Log sweep (Farina): phase(t) = K * (e^(t/L) - 1)
+    private readonly double _sweepK;
+    private readonly double _sweepL;
+
+    // Pink noise (Paul Kellet's refined filter) over xorshift white noise
+    private uint _noiseState = 0x9E3779B9;
+    private double _b0, _b1, _b2, _b3, _b4, _b5, _b6;
+
+    // MLS shift register
+    private uint _mlsState = 1;
+
+    /// <summary>
+    /// Total length in frames.
+    /// </summary>
+    public int TotalFrames { get; }
+
+    /// <summary>
+    /// Frames produced so far.
+    /// </summary>
+    public int Position { get; private set; }
+
+    /// <summary>
+    /// Whether every frame has been produced.
+    /// </summary>
+    public bool IsFinished => Position >= TotalFrames;
+
+    /// <param name="signal">Signal to generate.</param>
+    /// <param name="sampleRate">Output sample rate in Hz.</param>
+    /// <param name="durationMs">Signal length. An MLS is rounded up to whole periods.</param>
+    /// <param name="frequencyHz">Tone frequency for <see cref="TestSignal.Sine"/>; ignored otherwise.</param>
+    /// <param name="amplitude">Peak level (0-1).</param>
+    public SignalGenerator(TestSignal signal, int sampleRate, int durationMs, double frequencyHz = 1000,
+        float amplitude = DefaultAmplitude)
+    {
+        if (sampleRate <= 0)
+            throw new ArgumentOutOfRangeException(nameof(sampleRate));
+        if (durationMs <= 0)
+            throw new ArgumentOutOfRangeException(nameof(durationMs));
+
+        _signal = signal;
+        _sampleRate = sampleRate;
+        _amplitude = Math.Clamp(amplitude, 0f, 1f);
+
+        var frames = (int)((long)sampleRate * durationMs / 1000);
+        if (signal == TestSignal.Mls)
+        {
+            var period = MlsPeriod;
+            frames = Math.Max(1, (frames + period - 1) / period) * period;
+        }
+
+        TotalFrames = frames;
+        _fadeFrames = signal == TestSignal.Mls ? 0 : Math.Min(frames / 10, sampleRate / 20);
+        _phaseIncrement = 2 * Math.PI * frequencyHz / sampleRate;
+
+        var endHz = Math.Min(SweepEndHz, sampleRate * 0.45);
+        var durationSeconds = (double)frames / sampleRate;
+        _sweepL = durationSeconds / Math.Log(endHz / SweepStartHz);
+        _sweepK = 2 * Math.PI * SweepStartHz * _sweepL;
+    }
+
+    /// <summary>
+    /// Samples in one MLS period.
+    /// </summary>
+    public static int MlsPeriod => (1 << MlsOrder) - 1;
+
+    /// <summary>
+    /// Writes the next frames of the signal.
+    /// </summary>
+    /// <returns>Frames written; fewer than <paramref name="output"/> holds at the end, 0 once finished.</returns>
+    public int Read(Span<float> output)
+    {
+        var count = Math.Min(output.Length, TotalFrames - Position);
+        for (var i = 0; i < count; i++)
+        {
+            var frame = Position + i;
+            output[i] = NextSample(frame) * _amplitude * Envelope(frame);
+        }
+
+        Position += count;
+        return count;
+    }
+
+    private float NextSample(int frame)
+    {
+        switch (_signal)
+        {
+            case TestSignal.Sine:
+            {
+                var sample = Math.Sin(_phase);
+                _phase += _phaseIncrement;
+                if (_phase >= 2 * Math.PI)
+                    _phase -= 2 * Math.PI;
+                return (float)sample;
+            }
+
+            case TestSignal.LogSweep:
+            {
+                var t = (double)frame / _sampleRate;
+                return (float)Math.Sin(_sweepK * (Math.Exp(t / _sweepL) - 1));
+            }
+
+            case TestSignal.PinkNoise:
+                return NextPink();
+
+            case TestSignal.Mls:
+            {
+                var bit = _mlsState & 1;
+                _mlsState >>= 1;
+                if (bit != 0)
+                    _mlsState ^= MlsTaps;
+                return bit != 0 ? 1f : -1f;
+            }
+
+            default:
+                return 0f;
+        }
+    }
+
+    private float NextPink()
+    {
+        // xorshift32 -> uniform white noise in [-1, 1)
+        var x = _noiseState;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        _noiseState = x;
+        var white = x / 2147483648.0 - 1.0;
+
+        _b0 = 0.99886 * _b0 + white * 0.0555179;
+        _b1 = 0.99332 * _b1 + white * 0.0750759;
+        _b2 = 0.96900 * _b2 + white * 0.1538520;
+        _b3 = 0.86650 * _b3 + white * 0.3104856;
+        _b4 = 0.55000 * _b4 + white * 0.5329522;
+        _b5 = -0.7616 * _b5 - white * 0.0168980;
+        var pink = _b0 + _b1 + _b2 + _b3 + _b4 + _b5 + _b6 + white * 0.5362;
+        _b6 = white * 0.115926;
+
+        // Kellet's normalisation to roughly [-1, 1]; clamp the rare peaks beyond it
+        return (float)Math.Clamp(pink * 0.11, -1.0, 1.0);
+    }
+
+    private float Envelope(int frame)
+    {
+        if (_fadeFrames == 0)
+            return 1f;
+
+        if (frame < _fadeFrames)
+            return (float)frame / _fadeFrames;
+
+        var remaining = TotalFrames - frame;
+        return remaining < _fadeFrames ? (float)remaining / _fadeFrames : 1f;
+    }
+}
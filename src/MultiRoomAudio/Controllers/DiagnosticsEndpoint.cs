@@ -1,4 +1,6 @@
 using System.Diagnostics;
+using System.Formats.Tar;
+using System.IO.Compression;
 using System.Reflection;
 using System.Text;
 using System.Text.RegularExpressions;
@@ -29,22 +31,7 @@ public static class DiagnosticsEndpoint
             .WithTags("Diagnostics")
             .WithOpenApi();
 
-        // Phase definitions for progress tracking
-        var phases = new[]
-        {
-            (Id: "summary", Name: "Summary"),
-            (Id: "host", Name: "Host/Environment Info"),
-            (Id: "pulseaudio", Name: "PulseAudio Info"),
-            (Id: "usb", Name: "USB Devices"),
-            (Id: "haos", Name: "Home Assistant Info"),
-            (Id: "state", Name: "Application State"),
-            (Id: "players", Name: "Player States"),
-            (Id: "devices", Name: "Device Info"),
-            (Id: "relays", Name: "Relay Board Info"),
-            (Id: "configs", Name: "Config Files")
-        };
-
-        // GET /api/diagnostics/stream - SSE endpoint for progress + content
+        // GET /api/diagnostics/stream - SSE endpoint for progress, then a link to the bundle
         group.MapGet("/stream", async (
             PlayerManagerService playerManager,
             EnvironmentService environment,
@@ -57,8 +44,6 @@ public static class DiagnosticsEndpoint
             context.Response.Headers.CacheControl = "no-cache";
             context.Response.Headers.Connection = "keep-alive";
 
-            var sb = new StringBuilder();
-
             async Task SendProgressAsync(int current, int total, string phaseName)
             {
                 ct.ThrowIfCancellationRequested();
@@ -67,74 +52,19 @@ public static class DiagnosticsEndpoint
                 await context.Response.Body.FlushAsync(ct);
             }
 
-            async Task SendCompleteAsync(string content)
-            {
-                ct.ThrowIfCancellationRequested();
-                // Send content as base64 to avoid SSE parsing issues
-                var base64 = Convert.ToBase64String(Encoding.UTF8.GetBytes(content));
-                await context.Response.WriteAsync($"event: complete\ndata: {base64}\n\n", ct);
-                await context.Response.Body.FlushAsync(ct);
-            }
-
             try
             {
-                int phaseNum = 0;
-                int totalPhases = phases.Length;
-
-                // Phase 1: Summary
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[0].Name);
-                AppendSummary(sb, playerManager, environment, triggerService, sinksService);
-
-                // Phase 2: Host/Environment
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[1].Name);
-                sb.AppendLine("=== HOST / ENVIRONMENT INFO ===");
-                sb.AppendLine();
-                await AppendHostInfoAsync(sb, ct);
-
-                // Phase 3: PulseAudio
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[2].Name);
-                await AppendPulseAudioInfoAsync(sb, ct);
-
-                // Phase 4: USB
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[3].Name);
-                await AppendUsbInfoAsync(sb, ct);
-
-                // Phase 5: HAOS (conditional)
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[4].Name);
-                await AppendHaosInfoAsync(sb, environment, ct);
-
-                // Phase 6: Application State
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[5].Name);
-                AppendApplicationState(sb, environment);
-
-                // Phase 7: Players
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[6].Name);
-                AppendPlayerStates(sb, playerManager);
-
-                // Phase 8: Devices
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[7].Name);
-                AppendDeviceInfo(sb);
-
-                // Phase 9: Relays
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[8].Name);
-                AppendRelayBoardInfo(sb, triggerService);
-
-                // Phase 10: Configs
-                phaseNum++;
-                await SendProgressAsync(phaseNum, totalPhases, phases[9].Name);
-                await AppendConfigFilesAsync(sb, environment, ct);
-
-                // Send complete with content
-                await SendCompleteAsync(sb.ToString());
+                var phases = CreatePhases(playerManager, environment, triggerService, sinksService);
+                var bundleId = await BuildBundleAsync(phases, SendProgressAsync, ct);
+
+                // The archive stays on disk; the client fetches it from the bundle endpoint
+                var json = System.Text.Json.JsonSerializer.Serialize(new
+                {
+                    url = $"./api/diagnostics/bundle/{bundleId}",
+                    filename = GetBundleFileName()
+                });
+                await context.Response.WriteAsync($"event: complete\ndata: {json}\n\n", ct);
+                await context.Response.Body.FlushAsync(ct);
             }
             catch (OperationCanceledException)
             {
@@ -153,53 +83,275 @@ public static class DiagnosticsEndpoint
         .WithName("StreamDiagnostics")
         .WithDescription("Stream diagnostics generation progress via SSE");
 
-        // GET /api/diagnostics/download - Download comprehensive diagnostics file (direct, no progress)
+        // GET /api/diagnostics/bundle/{id} - Download a bundle generated by /stream (one-shot)
+        group.MapGet("/bundle/{id}", (string id) =>
+        {
+            if (!Guid.TryParseExact(id, "N", out _))
+            {
+                return Results.BadRequest(new ErrorResponse(false, "Invalid bundle id"));
+            }
+
+            var path = Path.Combine(BundleDirectory, id + BundleExtension);
+            if (!File.Exists(path))
+            {
+                return Results.NotFound(new ErrorResponse(false, "Diagnostics bundle not found or expired"));
+            }
+
+            return Results.File(OpenBundleForDownload(path), "application/gzip", GetBundleFileName());
+        })
+        .WithName("DownloadDiagnosticsBundle")
+        .WithDescription("Download a diagnostics bundle generated by the stream endpoint");
+
+        // GET /api/diagnostics/download - Download comprehensive diagnostics bundle (direct, no progress)
         group.MapGet("/download", async (
             PlayerManagerService playerManager,
             EnvironmentService environment,
             TriggerService triggerService,
             CustomSinksService sinksService,
-            HttpContext context) =>
+            CancellationToken ct) =>
+        {
+            var phases = CreatePhases(playerManager, environment, triggerService, sinksService);
+            var bundleId = await BuildBundleAsync(phases, (_, _, _) => Task.CompletedTask, ct);
+            var path = Path.Combine(BundleDirectory, bundleId + BundleExtension);
+
+            return Results.File(OpenBundleForDownload(path), "application/gzip", GetBundleFileName());
+        })
+        .WithName("DownloadDiagnostics")
+        .WithDescription("Download comprehensive system diagnostics bundle (tar.gz) for troubleshooting");
+    }
+
+    #region Bundle Engine
+
+    // Bundles are written here and deleted once downloaded (or when stale)
+    private static readonly string BundleDirectory = Path.Combine(Path.GetTempPath(), "multiroom-diagnostics");
+    private const string BundleExtension = ".tar.gz";
+    private const string BundleRoot = "multiroom-diagnostics";
+    private static readonly TimeSpan BundleMaxAge = TimeSpan.FromMinutes(15);
+
+    /// <summary>
+    /// Writes a phase's output into the work directory.
+    /// </summary>
+    /// <param name="workDirectory">Directory the phase writes its files into.</param>
+    /// <param name="baseName">Ordered file name stem for this phase (e.g. "03-pulseaudio").</param>
+    /// <param name="ct">Cancellation token.</param>
+    /// <returns>Paths of the written files, relative to the work directory.</returns>
+    private delegate Task<IReadOnlyList<string>> PhaseWriter(string workDirectory, string baseName, CancellationToken ct);
+
+    /// <summary>
+    /// One independently collected section of the diagnostics bundle.
+    /// </summary>
+    private sealed record DiagnosticsPhase(string Id, string Name, PhaseWriter WriteAsync);
+
+    private static IReadOnlyList<DiagnosticsPhase> CreatePhases(
+        PlayerManagerService playerManager,
+        EnvironmentService environment,
+        TriggerService triggerService,
+        CustomSinksService sinksService)
+    {
+        return new[]
+        {
+            TextPhase("summary", "Summary",
+                (sb, _) => { AppendSummary(sb, playerManager, environment, triggerService, sinksService); return Task.CompletedTask; }),
+            TextPhase("host", "Host/Environment Info", AppendHostInfoAsync),
+            TextPhase("pulseaudio", "PulseAudio Info", AppendPulseAudioInfoAsync),
+            TextPhase("usb", "USB Devices", AppendUsbInfoAsync),
+            TextPhase("haos", "Home Assistant Info", (sb, ct) => AppendHaosInfoAsync(sb, environment, ct)),
+            TextPhase("state", "Application State",
+                (sb, _) => { AppendApplicationState(sb, environment); return Task.CompletedTask; }),
+            TextPhase("players", "Player States",
+                (sb, _) => { AppendPlayerStates(sb, playerManager); return Task.CompletedTask; }),
+            TextPhase("devices", "Device Info",
+                (sb, _) => { AppendDeviceInfo(sb); return Task.CompletedTask; }),
+            TextPhase("relays", "Relay Board Info",
+                (sb, _) => { AppendRelayBoardInfo(sb, triggerService); return Task.CompletedTask; }),
+            new DiagnosticsPhase("configs", "Config Files",
+                (workDirectory, baseName, ct) => WriteConfigFilesAsync(workDirectory, baseName, environment, ct))
+        };
+    }
+
+    /// <summary>
+    /// A phase rendered as one text file. Each section is small; only the bundle as a whole grows.
+    /// </summary>
+    private static DiagnosticsPhase TextPhase(string id, string name, Func<StringBuilder, CancellationToken, Task> append)
+    {
+        return new DiagnosticsPhase(id, name, async (workDirectory, baseName, ct) =>
         {
             var sb = new StringBuilder();
+            await append(sb, ct);
+            if (sb.Length == 0)
+            {
+                return Array.Empty<string>();   // e.g. HAOS info outside HAOS
+            }
 
-            // === SUMMARY SECTION ===
-            AppendSummary(sb, playerManager, environment, triggerService, sinksService);
+            var fileName = baseName + ".txt";
+            await File.WriteAllTextAsync(Path.Combine(workDirectory, fileName), sb.ToString(), ct);
+            return new[] { fileName };
+        });
+    }
 
-            // === SYSTEM COMMANDS SECTION ===
-            await AppendSystemCommandsAsync(sb);
+    /// <summary>
+    /// Runs all phases concurrently and streams each into a tar.gz as it finishes.
+    /// </summary>
+    /// <remarks>
+    /// Phases write to a per-bundle work directory; completed files are copied into the
+    /// gzip stream from disk and deleted, so memory use is bounded by the largest single
+    /// section rather than the whole report. The shell/pactl/HAOS phases overlap instead
+    /// of running back to back.
+    /// </remarks>
+    /// <param name="phases">Phases to collect.</param>
+    /// <param name="onPhaseComplete">Called with (completed, total, phase name) after each phase is archived.</param>
+    /// <param name="ct">Cancellation token.</param>
+    /// <returns>Bundle id (file name stem in <see cref="BundleDirectory"/>).</returns>
+    private static async Task<string> BuildBundleAsync(
+        IReadOnlyList<DiagnosticsPhase> phases,
+        Func<int, int, string, Task> onPhaseComplete,
+        CancellationToken ct)
+    {
+        Directory.CreateDirectory(BundleDirectory);
+        DeleteStaleBundles();
 
-            // === APPLICATION STATE SECTION ===
-            AppendApplicationState(sb, environment);
+        var bundleId = Guid.NewGuid().ToString("N");
+        var workDirectory = Path.Combine(BundleDirectory, bundleId);
+        var bundlePath = Path.Combine(BundleDirectory, bundleId + BundleExtension);
+        Directory.CreateDirectory(workDirectory);
 
-            // === HAOS INFO SECTION (only in HAOS mode) ===
-            await AppendHaosInfoAsync(sb, environment);
+        var pending = phases
+            .Select((phase, index) => RunPhaseAsync(phase, $"{index + 1:D2}-{phase.Id}", workDirectory, ct))
+            .ToList();
 
-            // === PLAYER STATES SECTION ===
-            AppendPlayerStates(sb, playerManager);
+        try
+        {
+            await using (var file = new FileStream(bundlePath, FileMode.CreateNew, FileAccess.Write,
+                             FileShare.None, 81920, useAsync: true))
+            await using (var gzip = new GZipStream(file, CompressionLevel.Optimal))
+            await using (var tar = new TarWriter(gzip, TarEntryFormat.Pax, leaveOpen: true))
+            {
+                var completed = 0;
+                while (pending.Count > 0)
+                {
+                    var finished = await Task.WhenAny(pending);
+                    pending.Remove(finished);
+                    var (phase, files) = await finished;
+
+                    foreach (var relativePath in files)
+                    {
+                        var fullPath = Path.Combine(workDirectory, relativePath);
+                        var entryName = BundleRoot + "/" + relativePath.Replace(Path.DirectorySeparatorChar, '/');
+                        await tar.WriteEntryAsync(fullPath, entryName, ct);
+                        TryDeleteFile(fullPath);
+                    }
+
+                    completed++;
+                    await onPhaseComplete(completed, phases.Count, phase.Name);
+                }
+            }
+
+            return bundleId;
+        }
+        catch
+        {
+            // Let in-flight phases observe cancellation before removing their directory
+            try { await Task.WhenAll(pending); } catch { /* already failing */ }
+            TryDeleteFile(bundlePath);
+            throw;
+        }
+        finally
+        {
+            TryDeleteDirectory(workDirectory);
+        }
+    }
 
-            // === DEVICE INFO SECTION ===
-            AppendDeviceInfo(sb);
+    private static async Task<(DiagnosticsPhase Phase, IReadOnlyList<string> Files)> RunPhaseAsync(
+        DiagnosticsPhase phase,
+        string baseName,
+        string workDirectory,
+        CancellationToken ct)
+    {
+        try
+        {
+            // Task.Run so synchronous collectors (player/device state) overlap too
+            var files = await Task.Run(() => phase.WriteAsync(workDirectory, baseName, ct), ct);
+            return (phase, files);
+        }
+        catch (OperationCanceledException)
+        {
+            throw;
+        }
+        catch (Exception ex)
+        {
+            // One failing collector shouldn't lose the rest of the bundle
+            var fileName = baseName + ".error.txt";
+            await File.WriteAllTextAsync(Path.Combine(workDirectory, fileName),
+                $"(error collecting {phase.Name}: {ex.Message})\n", CancellationToken.None);
+            return (phase, new[] { fileName });
+        }
+    }
 
-            // === RELAY BOARD INFO SECTION ===
-            AppendRelayBoardInfo(sb, triggerService);
+    /// <summary>
+    /// Opens a bundle for a one-shot download; the file is removed when the response completes.
+    /// </summary>
+    private static FileStream OpenBundleForDownload(string path)
+    {
+        return new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read | FileShare.Delete,
+            81920, FileOptions.Asynchronous | FileOptions.DeleteOnClose);
+    }
 
-            // === CONFIG FILES SECTION ===
-            await AppendConfigFilesAsync(sb, environment);
+    private static string GetBundleFileName()
+    {
+        return $"multiroom-diagnostics-{DateTime.UtcNow:yyyy-MM-dd-HHmmss}{BundleExtension}";
+    }
 
-            // Set response headers for file download
-            var filename = $"multiroom-diagnostics-{DateTime.UtcNow:yyyy-MM-dd-HHmmss}.txt";
-            context.Response.Headers.ContentDisposition = $"attachment; filename=\"{filename}\"";
+    /// <summary>
+    /// Removes bundles that were generated but never downloaded.
+    /// </summary>
+    private static void DeleteStaleBundles()
+    {
+        try
+        {
+            var cutoff = DateTime.UtcNow - BundleMaxAge;
+            foreach (var path in Directory.EnumerateFiles(BundleDirectory, "*" + BundleExtension))
+            {
+                if (File.GetLastWriteTimeUtc(path) < cutoff)
+                    TryDeleteFile(path);
+            }
+        }
+        catch (IOException)
+        {
+            // Best effort - retried on the next bundle
+        }
+    }
 
-            return Results.Text(sb.ToString(), "text/plain");
-        })
-        .WithName("DownloadDiagnostics")
-        .WithDescription("Download comprehensive system diagnostics file for troubleshooting");
+    private static void TryDeleteFile(string path)
+    {
+        try
+        {
+            File.Delete(path);
+        }
+        catch
+        {
+            // Ignore - swept by DeleteStaleBundles
+        }
     }
 
-    // Split out host info for streaming
+    private static void TryDeleteDirectory(string path)
+    {
+        try
+        {
+            Directory.Delete(path, recursive: true);
+        }
+        catch
+        {
+            // Ignore - contains only temporary phase output
+        }
+    }
+
+    #endregion
+
     private static async Task AppendHostInfoAsync(StringBuilder sb, CancellationToken ct = default)
     {
+        sb.AppendLine("=== HOST / ENVIRONMENT INFO ===");
+        sb.AppendLine();
+
         // Kernel info (shared with host)
         sb.AppendLine("--- uname -a ---");
         var uname = await RunCommandAsync("uname", "-a", ct);
@@ -247,25 +399,16 @@ public static class DiagnosticsEndpoint
         sb.AppendLine("=== PULSEAUDIO INFO ===");
         sb.AppendLine();
 
-        sb.AppendLine("--- pactl info ---");
-        var pactlInfo = await RunCommandAsync("pactl", "info", ct);
-        sb.AppendLine(RedactSensitiveData(pactlInfo));
-        sb.AppendLine();
+        // Independent queries - run them together, print in a fixed order
+        var sections = new[] { "info", "list cards", "list sinks", "list modules" };
+        var outputs = await Task.WhenAll(sections.Select(args => RunCommandAsync("pactl", args, ct)));
 
-        sb.AppendLine("--- pactl list cards ---");
-        var pactlCards = await RunCommandAsync("pactl", "list cards", ct);
-        sb.AppendLine(RedactSensitiveData(pactlCards));
-        sb.AppendLine();
-
-        sb.AppendLine("--- pactl list sinks ---");
-        var pactlSinks = await RunCommandAsync("pactl", "list sinks", ct);
-        sb.AppendLine(RedactSensitiveData(pactlSinks));
-        sb.AppendLine();
-
-        sb.AppendLine("--- pactl list modules ---");
-        var pactlModules = await RunCommandAsync("pactl", "list modules", ct);
-        sb.AppendLine(RedactSensitiveData(pactlModules));
-        sb.AppendLine();
+        for (var i = 0; i < sections.Length; i++)
+        {
+            sb.AppendLine($"--- pactl {sections[i]} ---");
+            sb.AppendLine(RedactSensitiveData(outputs[i]));
+            sb.AppendLine();
+        }
     }
 
     private static async Task AppendUsbInfoAsync(StringBuilder sb, CancellationToken ct = default)
@@ -393,90 +536,6 @@ public static class DiagnosticsEndpoint
         sb.AppendLine();
     }
 
-    private static async Task AppendSystemCommandsAsync(StringBuilder sb)
-    {
-        sb.AppendLine("=== HOST / ENVIRONMENT INFO ===");
-        sb.AppendLine();
-
-        // Kernel info (shared with host)
-        sb.AppendLine("--- uname -a ---");
-        var uname = await RunCommandAsync("uname", "-a");
-        sb.AppendLine(uname);
-        sb.AppendLine();
-
-        // CPU info including virtualization detection
-        sb.AppendLine("--- lscpu (summary) ---");
-        var lscpu = await RunCommandAsync("lscpu", "");
-        // Filter to just the interesting lines
-        if (!lscpu.StartsWith("("))
-        {
-            var interestingKeys = new[] { "Architecture", "CPU(s)", "Model name", "Hypervisor", "Virtualization" };
-            var lines = lscpu.Split('\n')
-                .Where(line => interestingKeys.Any(key => line.TrimStart().StartsWith(key, StringComparison.OrdinalIgnoreCase)))
-                .ToList();
-            sb.AppendLine(lines.Count > 0 ? string.Join("\n", lines) : lscpu);
-        }
-        else
-        {
-            sb.AppendLine(lscpu);
-        }
-        sb.AppendLine();
-
-        // Memory info
-        sb.AppendLine("--- Memory ---");
-        var meminfo = await RunCommandAsync("sh", "-c \"grep -E '^(MemTotal|MemFree|MemAvailable):' /proc/meminfo\"");
-        sb.AppendLine(meminfo);
-        sb.AppendLine();
-
-        // Virtualization detection
-        sb.AppendLine("--- Virtualization ---");
-        var virt = await RunCommandAsync("systemd-detect-virt", "");
-        sb.AppendLine($"systemd-detect-virt: {virt}");
-        sb.AppendLine();
-
-        // Container OS
-        sb.AppendLine("--- Container OS ---");
-        var osRelease = await RunCommandAsync("sh", "-c \"grep -E '^(PRETTY_NAME|ID|VERSION_ID)=' /etc/os-release\"");
-        sb.AppendLine(osRelease);
-        sb.AppendLine();
-
-        sb.AppendLine("=== PULSEAUDIO INFO ===");
-        sb.AppendLine();
-
-        // pactl info
-        sb.AppendLine("--- pactl info ---");
-        var pactlInfo = await RunCommandAsync("pactl", "info");
-        sb.AppendLine(RedactSensitiveData(pactlInfo));
-        sb.AppendLine();
-
-        // pactl list cards
-        sb.AppendLine("--- pactl list cards ---");
-        var pactlCards = await RunCommandAsync("pactl", "list cards");
-        sb.AppendLine(RedactSensitiveData(pactlCards));
-        sb.AppendLine();
-
-        // pactl list sinks
-        sb.AppendLine("--- pactl list sinks ---");
-        var pactlSinks = await RunCommandAsync("pactl", "list sinks");
-        sb.AppendLine(RedactSensitiveData(pactlSinks));
-        sb.AppendLine();
-
-        // pactl list modules
-        sb.AppendLine("--- pactl list modules ---");
-        var pactlModules = await RunCommandAsync("pactl", "list modules");
-        sb.AppendLine(RedactSensitiveData(pactlModules));
-        sb.AppendLine();
-
-        sb.AppendLine("=== USB DEVICES ===");
-        sb.AppendLine();
-
-        // lsusb
-        sb.AppendLine("--- lsusb ---");
-        var lsusb = await RunCommandAsync("lsusb", "");
-        sb.AppendLine(RedactSensitiveData(lsusb));
-        sb.AppendLine();
-    }
-
     private static async Task AppendHaosInfoAsync(StringBuilder sb, EnvironmentService environment, CancellationToken ct = default)
     {
         if (!environment.IsHaos)
@@ -725,11 +784,16 @@ public static class DiagnosticsEndpoint
         }
     }
 
-    private static async Task AppendConfigFilesAsync(StringBuilder sb, EnvironmentService environment, CancellationToken ct = default)
+    /// <summary>
+    /// Copies each config file into the bundle with sensitive data redacted, line by line,
+    /// so large configs are never held in memory. Writes a status index alongside them.
+    /// </summary>
+    private static async Task<IReadOnlyList<string>> WriteConfigFilesAsync(
+        string workDirectory,
+        string baseName,
+        EnvironmentService environment,
+        CancellationToken ct)
     {
-        sb.AppendLine("=== CONFIG FILES ===");
-        sb.AppendLine();
-
         var configFiles = new[]
         {
             ("players.yaml", environment.PlayersConfigPath),
@@ -739,34 +803,52 @@ public static class DiagnosticsEndpoint
             ("triggers.yaml", Path.Combine(environment.ConfigPath, "triggers.yaml"))
         };
 
+        Directory.CreateDirectory(Path.Combine(workDirectory, baseName));
+        var written = new List<string>();
+        var index = new StringBuilder();
+        index.AppendLine("=== CONFIG FILES ===");
+        index.AppendLine();
+
         foreach (var (name, path) in configFiles)
         {
             ct.ThrowIfCancellationRequested();
-            sb.AppendLine($"--- {name} ---");
 
-            if (File.Exists(path))
+            if (!File.Exists(path))
             {
-                try
-                {
-                    var content = await File.ReadAllTextAsync(path, ct);
-                    sb.AppendLine(RedactSensitiveData(content));
-                }
-                catch (OperationCanceledException)
-                {
-                    throw;
-                }
-                catch (Exception ex)
+                index.AppendLine($"{name}: (file not found)");
+                continue;
+            }
+
+            var relativePath = Path.Combine(baseName, name);
+            try
+            {
+                using (var reader = new StreamReader(path))
+                await using (var writer = new StreamWriter(Path.Combine(workDirectory, relativePath)))
                 {
-                    sb.AppendLine($"(error reading file: {ex.Message})");
+                    // Redaction patterns never span lines
+                    while (await reader.ReadLineAsync(ct) is { } line)
+                    {
+                        await writer.WriteLineAsync(RedactSensitiveData(line));
+                    }
                 }
+
+                written.Add(relativePath);
+                index.AppendLine($"{name}: included");
             }
-            else
+            catch (OperationCanceledException)
             {
-                sb.AppendLine("(file not found)");
+                throw;
+            }
+            catch (Exception ex)
+            {
+                index.AppendLine($"{name}: (error reading file: {ex.Message})");
             }
-
-            sb.AppendLine();
         }
+
+        var indexPath = baseName + ".txt";
+        await File.WriteAllTextAsync(Path.Combine(workDirectory, indexPath), index.ToString(), ct);
+        written.Insert(0, indexPath);
+        return written;
     }
 
     // Default timeout for shell commands (10 seconds)
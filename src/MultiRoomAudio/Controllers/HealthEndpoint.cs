@@ -90,12 +90,13 @@ public static class HealthEndpoint
 
         // GET /api/status - Detailed service status
         // NOTE: Not called by UI - intended for external monitoring tools and debugging
-        app.MapGet("/api/status", (PlayerManagerService manager) =>
+        app.MapGet("/api/status", (PlayerManagerService manager, ZoneSyncMonitor syncMonitor) =>
         {
             try
             {
                 var devices = PulseAudioDeviceEnumerator.GetOutputDevices().ToList();
                 var players = manager.GetAllPlayers();
+                var sync = syncMonitor.GetMatrix();
 
                 return Results.Ok(new
                 {
@@ -114,6 +115,15 @@ public static class HealthEndpoint
                     {
                         deviceCount = devices.Count,
                         defaultDevice = devices.FirstOrDefault(d => d.IsDefault)?.Name
+                    },
+                    sync = new
+                    {
+                        zones = sync.Zones.Count,
+                        maxGroupOffsetMs = sync.Pairs.Where(p => p.SameGroup)
+                            .Select(p => (double?)Math.Abs(p.MeanOffsetMs)).Max(),
+                        maxJitterMs = sync.Pairs.Select(p => (double?)p.JitterMs).Max(),
+                        alerts = sync.Alerts.Count,
+                        thresholdMs = sync.ThresholdMs
                     }
                 });
             }
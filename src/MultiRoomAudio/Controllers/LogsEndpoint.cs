@@ -14,8 +14,10 @@ public static class LogsEndpoint
     /// <remarks>
     /// Endpoints:
     /// <list type="bullet">
-    /// <item>GET /api/logs - Query logs with filtering (level, category, search, date range)</item>
+    /// <item>GET /api/logs - Query logs with filtering (level, category, search, date range) and cursor paging</item>
     /// <item>GET /api/logs/stats - Get log statistics by level and category</item>
+    /// <item>GET /api/logs/archive - Query the compressed on-disk archive (days of history)</item>
+    /// <item>GET /api/logs/archive/stats - Get archive size and time span</item>
     /// <item>GET /api/logs/download - Download all logs as a text file</item>
     /// <item>DELETE /api/logs - Clear all logs from memory and files</item>
     /// </list>
@@ -34,9 +36,10 @@ public static class LogsEndpoint
             string? search,
             DateTime? start,
             DateTime? end,
-            int skip,
-            int take,
-            bool newestFirst,
+            int? skip,
+            int? take,
+            bool? newestFirst,
+            long? cursor,
             LoggingService loggingService) =>
         {
             // Parse level filter
@@ -60,12 +63,8 @@ public static class LogsEndpoint
             }
 
             // Ensure reasonable defaults
-            if (take <= 0)
-                take = 100;
-            if (take > 500)
-                take = 500;
-            if (skip < 0)
-                skip = 0;
+            var pageSize = take is > 0 ? Math.Min(take.Value, 500) : 100;
+            var offset = Math.Max(0, skip ?? 0);
 
             var options = new LogQueryOptions(
                 MinLevel: minLevel,
@@ -73,25 +72,26 @@ public static class LogsEndpoint
                 SearchText: search,
                 StartTime: start,
                 EndTime: end,
-                Skip: skip,
-                Take: take,
-                NewestFirst: newestFirst
+                Skip: offset,
+                Take: pageSize,
+                NewestFirst: newestFirst ?? true,
+                Cursor: cursor
             );
 
-            var entries = loggingService.GetEntries(options);
-            var totalCount = loggingService.GetTotalCount(options);
+            var result = loggingService.Query(options);
 
             var response = new LogsResponse(
-                Entries: entries.Select(e => e.ToDto()).ToList(),
-                TotalCount: totalCount,
-                Skip: skip,
-                Take: take
+                Entries: result.Entries.Select(e => e.ToDto()).ToList(),
+                TotalCount: result.TotalCount,
+                Skip: offset,
+                Take: pageSize,
+                NextCursor: result.NextCursor
             );
 
             return Results.Ok(response);
         })
         .WithName("GetLogs")
-        .WithDescription("Query application logs with optional filtering by level, category, and search text");
+        .WithDescription("Query application logs with optional filtering by level, category, and search text. Pass nextCursor back as cursor for the next page.");
 
         // GET /api/logs/stats - Get log statistics
         group.MapGet("/stats", (LoggingService loggingService) =>
@@ -102,6 +102,67 @@ public static class LogsEndpoint
         .WithName("GetLogStats")
         .WithDescription("Get log statistics by level and category");
 
+        // GET /api/logs/archive - Query the on-disk archive
+        group.MapGet("/archive", (
+            string? level,
+            string? category,
+            string? search,
+            DateTime? start,
+            DateTime? end,
+            int? take,
+            bool? newestFirst,
+            string? cursor,
+            LoggingService loggingService) =>
+        {
+            LogArchiveCursor? archiveCursor = null;
+            if (!string.IsNullOrEmpty(cursor))
+            {
+                if (!LogArchiveCursor.TryParse(cursor, out var parsedCursor))
+                    return Results.BadRequest(new ErrorResponse(false, "Invalid cursor"));
+                archiveCursor = parsedCursor;
+            }
+
+            LogLevel? minLevel = null;
+            if (!string.IsNullOrEmpty(level) && Enum.TryParse<LogLevel>(level, ignoreCase: true, out var parsedLevel))
+            {
+                minLevel = parsedLevel;
+            }
+
+            LogCategory? logCategory = null;
+            if (!string.IsNullOrEmpty(category) && Enum.TryParse<LogCategory>(category, ignoreCase: true, out var parsedCategory))
+            {
+                logCategory = parsedCategory;
+            }
+
+            var pageSize = take is > 0 ? Math.Min(take.Value, 1000) : 100;
+
+            var result = loggingService.QueryArchive(new LogQueryOptions(
+                MinLevel: minLevel,
+                Category: logCategory,
+                SearchText: search,
+                StartTime: start,
+                EndTime: end,
+                Take: pageSize,
+                NewestFirst: newestFirst ?? true
+            ), archiveCursor);
+
+            return Results.Ok(new LogArchiveResponse(
+                Entries: result.Entries.Select(e => e.ToDto()).ToList(),
+                NextCursor: result.NextCursor?.ToString(),
+                BlocksScanned: result.BlocksScanned,
+                BlocksDecompressed: result.BlocksDecompressed));
+        })
+        .WithName("QueryLogArchive")
+        .WithDescription("Query the compressed on-disk log archive by time range, level, category and text. Only matching blocks are decompressed.");
+
+        // GET /api/logs/archive/stats - Archive size and time span
+        group.MapGet("/archive/stats", (LoggingService loggingService) =>
+        {
+            return Results.Ok(loggingService.GetArchiveStats());
+        })
+        .WithName("GetLogArchiveStats")
+        .WithDescription("Get on-disk log archive size and time span");
+
         // GET /api/logs/download - Download all logs as text file
         group.MapGet("/download", (
             string? level,
@@ -0,0 +1,34 @@
+using MultiRoomAudio.Services;
+
+namespace MultiRoomAudio.Controllers;
+
+/// <summary>
+/// REST API endpoints for buffer memory budget inspection.
+/// </summary>
+public static class MemoryEndpoint
+{
+    /// <summary>
+    /// Registers memory API endpoints with the application.
+    /// </summary>
+    /// <remarks>
+    /// Endpoints:
+    /// <list type="bullet">
+    /// <item>GET /api/memory - Buffer memory budget, per-player allocations, and savings</item>
+    /// </list>
+    /// </remarks>
+    /// <param name="app">The WebApplication to register endpoints on.</param>
+    public static void MapMemoryEndpoints(this WebApplication app)
+    {
+        // GET /api/memory - Buffer memory budget overview
+        app.MapGet("/api/memory", (BufferBudgetService budget, ILoggerFactory loggerFactory) =>
+        {
+            var logger = loggerFactory.CreateLogger("MemoryEndpoint");
+            logger.LogDebug("API: GET /api/memory");
+            return Results.Ok(budget.GetSnapshot());
+        })
+        .WithTags("Memory")
+        .WithName("GetMemoryBudget")
+        .WithDescription("Get the local buffer memory budget, per-player allocations, and memory saved vs fixed 8s buffers")
+        .WithOpenApi();
+    }
+}
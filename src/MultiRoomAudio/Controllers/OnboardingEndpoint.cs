@@ -119,7 +119,7 @@ public static class OnboardingEndpoint
                     return Results.NotFound(new ErrorResponse(false, $"Device '{id}' not found"));
 
                 // For multi-channel devices with a specific channel requested,
-                // use PlayChannelToneAsync with --channel-map for direct routing
+                // use PlayChannelToneAsync, which maps a mono stream straight to that channel
                 if (!string.IsNullOrEmpty(request?.ChannelName) && device.MaxChannels > 2)
                 {
                     // Validate channel exists on device if we have channel map info
@@ -132,7 +132,7 @@ public static class OnboardingEndpoint
                     }
 
                     logger.LogInformation(
-                        "Multi-channel test: Playing to device '{Device}' channel {ChannelName} via --channel-map",
+                        "Multi-channel test: Playing to device '{Device}' channel {ChannelName} via channel map",
                         device.Id, request.ChannelName);
 
                     await toneGenerator.PlayChannelToneAsync(
@@ -30,6 +30,7 @@ public static class PlayersEndpoint
     /// Endpoints:
     /// <list type="bullet">
     /// <item>GET /api/players - List all players</item>
+    /// <item>GET /api/players/sync - Cross-zone sync matrix and alerts</item>
     /// <item>GET /api/players/{name} - Get specific player</item>
     /// <item>GET /api/players/{name}/stats - Get real-time audio diagnostics</item>
     /// <item>POST /api/players - Create new player</item>
@@ -43,6 +44,7 @@ public static class PlayersEndpoint
     /// <item>PUT /api/players/{name}/mute - Set mute state</item>
     /// <item>PUT /api/players/{name}/auto-resume - Enable/disable auto-resume on device reconnect</item>
     /// <item>PUT /api/players/{name}/offset - Set delay offset (-10000 to 10000ms)</item>
+    /// <item>POST /api/players/{name}/calibrate-latency - Measure output latency and set the delay offset</item>
     /// <item>PUT /api/players/{name}/device - Switch audio device</item>
     /// <item>PUT /api/players/{name}/rename - Rename player</item>
     /// <item>POST /api/players/{name}/pause - Pause playback</item>
@@ -69,7 +71,8 @@ public static class PlayersEndpoint
 
                 var formats = new List<AudioFormatOption>
                 {
-                    new("flac-48000", "FLAC 48kHz", "CD quality lossless 48kHz (default, works with all MA builds)"),
+                    new("auto", "Auto", "Lossless FLAC at the output device's native rate (default)"),
+                    new("flac-48000", "FLAC 48kHz", "CD quality lossless 48kHz (works with all MA builds)"),
                     new("all", "All Formats", "Advertise all supported formats"),
                     new("flac-192000", "FLAC 192kHz", "Hi-res lossless 192kHz"),
                     new("flac-96000", "FLAC 96kHz", "Hi-res lossless 96kHz"),
@@ -103,6 +106,27 @@ public static class PlayersEndpoint
         .WithName("ListPlayers")
         .WithDescription("Get all active players");
 
+        // GET /api/players/groups - Local players grouped onto the same stream
+        group.MapGet("/groups", (PlayerManagerService manager, ILoggerFactory loggerFactory) =>
+        {
+            var logger = loggerFactory.CreateLogger("PlayersEndpoint");
+            logger.LogDebug("API: GET /api/players/groups");
+            return Results.Ok(manager.GetLocalStreamGroups());
+        })
+        .WithName("GetLocalStreamGroups")
+        .WithDescription("Get local players grouped onto the same stream and the decode/buffer cost each duplicates (reported only; the stream is not shared)");
+
+        // GET /api/players/sync - Cross-zone sync matrix
+        group.MapGet("/sync", (ZoneSyncMonitor monitor, ILoggerFactory loggerFactory) =>
+        {
+            var logger = loggerFactory.CreateLogger("PlayersEndpoint");
+            logger.LogDebug("API: GET /api/players/sync");
+            return Results.Ok(monitor.GetMatrix());
+        })
+        .WithName("GetSyncMatrix")
+        .WithDescription("Get the pairwise offset and jitter between playing zones on the server timeline, " +
+                         "and alerts for grouped zones that have drifted apart");
+
         // GET /api/players/{name} - Get specific player
         group.MapGet("/{name}", (string name, PlayerManagerService manager, ILoggerFactory loggerFactory) =>
         {
@@ -373,6 +397,28 @@ public static class PlayersEndpoint
         .WithName("SetOffset")
         .WithDescription("Set player delay offset in milliseconds");
 
+        // POST /api/players/{name}/calibrate-latency - Measure output latency
+        group.MapPost("/{name}/calibrate-latency", async (
+            string name,
+            LatencyCalibrationRequest? request,
+            LatencyCalibrationService calibration,
+            ILoggerFactory loggerFactory,
+            CancellationToken ct) =>
+        {
+            var logger = loggerFactory.CreateLogger("PlayersEndpoint");
+            request ??= new LatencyCalibrationRequest();
+            logger.LogDebug("API: POST /api/players/{PlayerName}/calibrate-latency ({Signal} from {Source})",
+                name, request.Signal, request.Source ?? "default source");
+            return await ApiExceptionHandler.ExecuteAsync(async () =>
+            {
+                var result = await calibration.CalibrateAsync(name, request, ct);
+                return Results.Ok(result);
+            }, logger, "calibrate latency", name);
+        })
+        .WithName("CalibrateLatency")
+        .WithDescription("Play a measurement signal, record it from a PulseAudio source (microphone or sink monitor) " +
+                         "and set the delay offset from the measured output latency");
+
         // POST /api/players/{name}/pause - Pause playback
         group.MapPost("/{name}/pause", (
             string name,
@@ -510,7 +556,7 @@ public static class PlayersEndpoint
                         savedConfig.AdvertisedFormat = request.AdvertisedFormat == "" ? null : request.AdvertisedFormat;
                         needsRestart = true;
                         logger.LogInformation("API: Player {PlayerName} advertised format changed to '{Format}'",
-                            currentName, savedConfig.AdvertisedFormat ?? "all");
+                            currentName, savedConfig.AdvertisedFormat ?? "auto");
                     }
 
                     // Handle buffer size change
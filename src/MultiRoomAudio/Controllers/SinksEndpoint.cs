@@ -226,15 +226,19 @@ public static class SinksEndpoint
 
                 // For remap sinks with a specific channel, play directly to master device
                 // This ensures only the target channel on the master device plays the tone,
-                // rather than playing to the remap sink which would broadcast to all channels
+                // rather than playing to the remap sink which would broadcast to all channels.
+                // In-process remap sinks have no PulseAudio sink, so they always go to the master
+                // (first mapped channel when none is given).
                 if (sink.Type == CustomSinkType.Remap &&
-                    !string.IsNullOrEmpty(request?.ChannelName) &&
+                    (!string.IsNullOrEmpty(request?.ChannelName) || sink.InProcess) &&
                     !string.IsNullOrEmpty(sink.MasterSink) &&
                     sink.ChannelMappings != null)
                 {
                     // Find the mapping for this output channel
-                    var mapping = sink.ChannelMappings.FirstOrDefault(m =>
-                        m.OutputChannel.Equals(request.ChannelName, StringComparison.OrdinalIgnoreCase));
+                    var mapping = string.IsNullOrEmpty(request?.ChannelName)
+                        ? sink.ChannelMappings.FirstOrDefault()
+                        : sink.ChannelMappings.FirstOrDefault(m =>
+                            m.OutputChannel.Equals(request.ChannelName, StringComparison.OrdinalIgnoreCase));
 
                     if (mapping != null)
                     {
@@ -242,14 +246,14 @@ public static class SinksEndpoint
                         var masterChannel = mapping.MasterChannel;
 
                         logger.LogInformation(
-                            "Remap sink test: Playing to master '{Master}' channel {ChannelName} via --channel-map",
+                            "Remap sink test: Playing to master '{Master}' channel {ChannelName} via channel map",
                             sink.MasterSink, masterChannel);
 
                         await toneGenerator.PlayChannelToneAsync(
                             sink.MasterSink,
                             masterChannel,
-                            request.FrequencyHz ?? 1000,
-                            request.DurationMs ?? 1500,
+                            request?.FrequencyHz ?? 1000,
+                            request?.DurationMs ?? 1500,
                             ct);
 
                         return Results.Ok(new
@@ -259,12 +263,37 @@ public static class SinksEndpoint
                             sinkName = name,
                             masterSink = sink.MasterSink,
                             masterChannel = masterChannel,
-                            frequencyHz = request.FrequencyHz ?? 1000,
-                            durationMs = request.DurationMs ?? 1500
+                            frequencyHz = request?.FrequencyHz ?? 1000,
+                            durationMs = request?.DurationMs ?? 1500
                         });
                     }
                 }
 
+                // In-process combine sinks have no PulseAudio sink either: sound each slave in turn
+                if (sink.Type == CustomSinkType.Combine && sink.InProcess && sink.Slaves != null)
+                {
+                    foreach (var slave in sink.Slaves)
+                    {
+                        await toneGenerator.PlayTestToneAsync(
+                            slave,
+                            frequencyHz: request?.FrequencyHz ?? 1000,
+                            durationMs: request?.DurationMs ?? 1500,
+                            channelName: request?.ChannelName,
+                            ct: ct);
+                    }
+
+                    return Results.Ok(new
+                    {
+                        success = true,
+                        message = "Test tone played successfully",
+                        sinkName = name,
+                        slaves = sink.Slaves,
+                        frequencyHz = request?.FrequencyHz ?? 1000,
+                        durationMs = request?.DurationMs ?? 1500,
+                        channelName = request?.ChannelName
+                    });
+                }
+
                 // Fall back to original behavior for non-remap sinks or whole-sink tests
                 await toneGenerator.PlayTestToneAsync(
                     sink.PulseAudioSinkName,
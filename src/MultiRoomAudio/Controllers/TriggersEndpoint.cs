@@ -393,6 +393,10 @@ public static class TriggersEndpoint
             {
                 return Results.BadRequest(new ErrorResponse(false, "Off delay must not exceed 3600 seconds (1 hour)"));
             }
+            if (request.AmpWarmupMs is < 0 or > 5000)
+            {
+                return Results.BadRequest(new ErrorResponse(false, "Amplifier warm-up must be between 0 and 5000 ms"));
+            }
 
             try
             {
@@ -401,7 +405,8 @@ public static class TriggersEndpoint
                     channel,
                     request.CustomSinkName,
                     request.OffDelaySeconds,
-                    request.ZoneName);
+                    request.ZoneName,
+                    request.AmpWarmupMs);
 
                 var boardStatus = service.GetBoardStatus(boardId);
                 var trigger = boardStatus?.Triggers.FirstOrDefault(t => t.Channel == channel);
@@ -437,6 +442,10 @@ public static class TriggersEndpoint
             {
                 return Results.BadRequest(new ErrorResponse(false, "Off delay must not exceed 3600 seconds (1 hour)"));
             }
+            if (request.AmpWarmupMs is < 0 or > 5000)
+            {
+                return Results.BadRequest(new ErrorResponse(false, "Amplifier warm-up must be between 0 and 5000 ms"));
+            }
 
             try
             {
@@ -445,7 +454,8 @@ public static class TriggersEndpoint
                     channel,
                     request.CustomSinkName,
                     request.OffDelaySeconds,
-                    request.ZoneName);
+                    request.ZoneName,
+                    request.AmpWarmupMs);
 
                 var boardStatus = service.GetBoardStatus(boardId);
                 var trigger = boardStatus?.Triggers.FirstOrDefault(t => t.Channel == channel);
@@ -681,6 +691,10 @@ public static class TriggersEndpoint
             {
                 return Results.BadRequest(new ErrorResponse(false, "Off delay must not exceed 3600 seconds (1 hour)"));
             }
+            if (request.AmpWarmupMs is < 0 or > 5000)
+            {
+                return Results.BadRequest(new ErrorResponse(false, "Amplifier warm-up must be between 0 and 5000 ms"));
+            }
 
             try
             {
@@ -689,7 +703,8 @@ public static class TriggersEndpoint
                     channel,
                     request.CustomSinkName,
                     request.OffDelaySeconds,
-                    request.ZoneName);
+                    request.ZoneName,
+                    request.AmpWarmupMs);
 
                 var boardStatus = service.GetBoardStatus(firstBoard.BoardId);
                 var trigger = boardStatus?.Triggers.FirstOrDefault(t => t.Channel == channel);
@@ -82,12 +82,12 @@ public class LogStreamHub : Hub
 public static class LogStreamHubExtensions
 {
     /// <summary>
-    /// Broadcasts a log entry to all connected clients in the "all" group.
+    /// Broadcasts a batch of log entries (oldest first) to all connected clients in the "all" group.
     /// </summary>
-    public static async Task BroadcastLogEntryAsync(
+    public static async Task BroadcastLogBatchAsync(
         this IHubContext<LogStreamHub> hubContext,
-        LogEntryDto entry)
+        IReadOnlyList<LogEntryDto> entries)
     {
-        await hubContext.Clients.Group("all").SendAsync("LogEntry", entry);
+        await hubContext.Clients.Group("all").SendAsync("LogBatch", entries);
     }
 }
@@ -0,0 +1,54 @@
+using MultiRoomAudio.Audio;
+
+namespace MultiRoomAudio.Models;
+
+/// <summary>
+/// Request to measure a player's output latency.
+/// </summary>
+/// <param name="Source">
+/// PulseAudio source to record from: a microphone near the speaker, or a sink's ".monitor"
+/// source for an electrical loopback. Null for the default source.
+/// </param>
+/// <param name="Signal">Measurement signal: <see cref="TestSignal.Mls"/> (default) or <see cref="TestSignal.LogSweep"/>.</param>
+/// <param name="Apply">Set the player's delay offset from the result when the measurement is confident enough.</param>
+public record LatencyCalibrationRequest(
+    string? Source = null,
+    TestSignal Signal = TestSignal.Mls,
+    bool Apply = true);
+
+/// <summary>
+/// Result of a latency calibration.
+/// </summary>
+public record LatencyCalibrationResult(
+    /// <summary>Player that was calibrated.</summary>
+    string PlayerName,
+    /// <summary>Sink the signal was played on.</summary>
+    string Sink,
+    /// <summary>Source the signal was recorded from (null for the default source).</summary>
+    string? Source,
+    /// <summary>Signal that was played.</summary>
+    TestSignal Signal,
+    /// <summary>
+    /// How much later the signal was heard than PulseAudio expected (ms). This is the latency
+    /// PulseAudio does not know about: receivers, DSP, wireless links, speaker distance.
+    /// </summary>
+    double OffsetMs,
+    /// <summary>Output latency PulseAudio reports for the player (ms), if it is running.</summary>
+    int? ReportedLatencyMs,
+    /// <summary>Measured output latency: the reported latency plus <see cref="OffsetMs"/>.</summary>
+    double? OutputLatencyMs,
+    /// <summary>0-1: how clearly the signal stood out in the recording.</summary>
+    double Confidence,
+    /// <summary>Correlation peak over the strongest other peak (dB).</summary>
+    double PeakToSidelobeDb,
+    /// <summary>Whether the recording was polarity-inverted (a speaker or cable wired backwards).</summary>
+    bool Inverted,
+    /// <summary>Delay offset that compensates the measured offset (ms).</summary>
+    int SuggestedDelayMs,
+    /// <summary>Delay offset before calibration (ms).</summary>
+    int PreviousDelayMs,
+    /// <summary>Whether <see cref="SuggestedDelayMs"/> was applied and saved.</summary>
+    bool Applied,
+    /// <summary>Human-readable outcome.</summary>
+    string Message
+);
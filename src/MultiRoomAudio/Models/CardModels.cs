@@ -76,6 +76,20 @@ public record PulseAudioCard(
     int? MaxVolume = null
 );
 
+/// <summary>
+/// Current control state of a sink, from one sink enumeration.
+/// </summary>
+public record SinkControlState(
+    /// <summary>Sink name.</summary>
+    string Name,
+    /// <summary>Whether the sink is muted.</summary>
+    bool Muted,
+    /// <summary>Volume of the first channel (0-100+), or null if unknown.</summary>
+    int? VolumePercent,
+    /// <summary>Channel count from the sample specification.</summary>
+    int Channels
+);
+
 /// <summary>
 /// Response containing list of sound cards.
 /// </summary>
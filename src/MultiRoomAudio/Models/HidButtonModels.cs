@@ -35,11 +35,8 @@ public class HidButtonDeviceState
     /// <summary>Name of the player associated with this device (for applying volume/mute changes).</summary>
     public string? PlayerName { get; set; }
 
-    /// <summary>Cancellation token source for the HID event reader task.</summary>
-    public CancellationTokenSource? ReaderCts { get; set; }
-
-    /// <summary>The task that reads HID events.</summary>
-    public Task? ReaderTask { get; set; }
+    /// <summary>Registration of the input device with the shared event loop, while reading.</summary>
+    public long? ReaderId { get; set; }
 
     /// <summary>Last known mute state (for toggle logic).</summary>
     public bool IsMuted { get; set; }
@@ -0,0 +1,35 @@
+namespace MultiRoomAudio.Models;
+
+/// <summary>
+/// Kernel uevent action for a hotplugged device.
+/// </summary>
+public enum HotplugAction
+{
+    /// <summary>Device appeared.</summary>
+    Add,
+
+    /// <summary>Device went away.</summary>
+    Remove
+}
+
+/// <summary>
+/// A device tracked by the hotplug inventory.
+/// </summary>
+public record HotplugDevice(
+    /// <summary>Kernel subsystem (input, tty, hidraw, usb).</summary>
+    string Subsystem,
+    /// <summary>Sysfs path below /sys (e.g., /devices/pci0000:00/.../1-2.3:1.0/ttyUSB0/tty/ttyUSB0).</summary>
+    string DevPath,
+    /// <summary>Device node below /dev (e.g., ttyUSB0, input/event5), if it has one.</summary>
+    string? DevName
+);
+
+/// <summary>
+/// Event arguments for a device added to or removed from the hotplug inventory.
+/// </summary>
+public record HotplugEventArgs(
+    /// <summary>Whether the device appeared or went away.</summary>
+    HotplugAction Action,
+    /// <summary>The device.</summary>
+    HotplugDevice Device
+);
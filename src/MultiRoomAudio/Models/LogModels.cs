@@ -20,7 +20,22 @@ public record LogsResponse(
     List<LogEntryDto> Entries,
     int TotalCount,
     int Skip,
-    int Take
+    int Take,
+    /// <summary>Cursor for the next page (pass as ?cursor=), or null on the last page.</summary>
+    long? NextCursor = null
+);
+
+/// <summary>
+/// Response containing a page of entries from the on-disk log archive.
+/// </summary>
+public record LogArchiveResponse(
+    List<LogEntryDto> Entries,
+    /// <summary>Opaque cursor for the next page (pass as ?cursor=), or null on the last page.</summary>
+    string? NextCursor,
+    /// <summary>Block index records examined.</summary>
+    int BlocksScanned,
+    /// <summary>Blocks decompressed to answer the query.</summary>
+    int BlocksDecompressed
 );
 
 /// <summary>
@@ -31,7 +46,11 @@ public record LogStatsResponse(
     Dictionary<string, int> ByCategory,
     int TotalEntries,
     DateTime? OldestEntry,
-    DateTime? NewestEntry
+    DateTime? NewestEntry,
+    /// <summary>Entries dropped because the log queue was full.</summary>
+    long DroppedEntries,
+    /// <summary>Entries queued but not yet written.</summary>
+    int PendingEntries
 );
 
 /// <summary>
@@ -63,7 +82,9 @@ public static class LogModelExtensions
             stats.ByCategory,
             stats.TotalEntries,
             stats.OldestEntry,
-            stats.NewestEntry
+            stats.NewestEntry,
+            stats.DroppedEntries,
+            stats.PendingEntries
         );
     }
 }
@@ -0,0 +1,44 @@
+namespace MultiRoomAudio.Models;
+
+/// <summary>
+/// Buffer memory budget overview for the /api/memory endpoint.
+/// </summary>
+public record MemoryBudgetResponse(
+    /// <summary>Total memory available to local PCM buffers.</summary>
+    long BudgetBytes,
+    /// <summary>Memory currently allocated to local PCM buffers.</summary>
+    long AllocatedBytes,
+    /// <summary>What the same players would use with the fixed 8-second buffer.</summary>
+    long FixedAllocationBytes,
+    /// <summary>FixedAllocationBytes minus AllocatedBytes.</summary>
+    long SavedBytes,
+    /// <summary>Whether players were scaled down to fit the budget.</summary>
+    bool IsBudgetConstrained,
+    /// <summary>Process resident set size.</summary>
+    long ProcessRssBytes,
+    /// <summary>Managed heap size as reported by the GC.</summary>
+    long ManagedHeapBytes,
+    List<PlayerBufferAllocation> Players
+);
+
+/// <summary>
+/// Local buffer sizing for a single player.
+/// </summary>
+public record PlayerBufferAllocation(
+    string PlayerName,
+    /// <summary>Decoded stream format, or null if no stream has started yet.</summary>
+    string? Format,
+    /// <summary>Capacity of the current TimedAudioBuffer.</summary>
+    int CapacityMs,
+    long CapacityBytes,
+    /// <summary>Capacity the player would get without budget pressure.</summary>
+    int DesiredCapacityMs,
+    /// <summary>Mean absolute deviation of the buffer level while playing.</summary>
+    double JitterMs,
+    /// <summary>Decaying peak of the buffer level while playing (server lead).</summary>
+    double PeakBufferedMs,
+    /// <summary>Number of buffer level observations (sizing uses defaults until enough are collected).</summary>
+    long Observations,
+    /// <summary>Buffer capacity advertised to the server in client/hello.</summary>
+    int AdvertisedCapacityBytes
+);
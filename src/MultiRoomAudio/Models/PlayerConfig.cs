@@ -69,7 +69,7 @@ public class PlayerCreateRequest
     public bool Persist { get; set; } = true;
 
     /// <summary>
-    /// Specific audio format to advertise. If null or empty, defaults to "flac-48000" for maximum MA compatibility.
+    /// Specific audio format to advertise. If null, empty or "auto", FLAC at the output device's native rate is negotiated.
     /// Format string: "codec-samplerate-bitdepth" (e.g., "flac-192000", "pcm-96000-24").
     /// UI selection only available when ENABLE_ADVANCED_FORMATS is enabled.
     /// </summary>
@@ -160,7 +160,7 @@ public class PlayerUpdateRequest
     public int? BufferSizeMs { get; set; }
 
     /// <summary>
-    /// Specific audio format to advertise. If null or empty, defaults to "flac-48000" for maximum MA compatibility.
+    /// Specific audio format to advertise. If null, empty or "auto", FLAC at the output device's native rate is negotiated.
     /// Format string: "codec-samplerate-bitdepth" (e.g., "flac-192000", "pcm-96000-24").
     /// UI selection only available when ENABLE_ADVANCED_FORMATS is enabled.
     /// </summary>
@@ -15,7 +15,15 @@ public record PlayerStatsResponse(
     /// <summary>SDK version for debugging.</summary>
     string SdkVersion = "unknown",
     /// <summary>Server time matching log timestamps.</summary>
-    string ServerTime = ""
+    string ServerTime = "",
+    /// <summary>Warm start state (persisted clock drift and latency lock).</summary>
+    WarmStartStats? WarmStart = null,
+    /// <summary>Format advertised to the server and why it was chosen.</summary>
+    FormatNegotiationStats? FormatNegotiation = null,
+    /// <summary>Per-output latency and drift correction of an in-process combine-sink.</summary>
+    List<CombineOutputStats>? CombineOutputs = null,
+    /// <summary>Idle stream corking (PulseAudio players only).</summary>
+    IdleCorkStats? IdleCork = null
 );
 
 /// <summary>
@@ -36,6 +44,52 @@ public record AudioFormatStats(
     int? HardwareBitDepth = null        // Derived bit depth (16, 24, or 32)
 );
 
+/// <summary>
+/// Advertised format negotiation result.
+/// </summary>
+public record FormatNegotiationStats(
+    /// <summary>"auto" (device-aware), "manual" (user preference) or "all".</summary>
+    string Mode,
+    /// <summary>Advertised format, e.g. "FLAC 48000Hz 2ch", or a count when several are advertised.</summary>
+    string AdvertisedFormat,
+    /// <summary>Why this format was chosen.</summary>
+    string Reason,
+    /// <summary>Whether the stream arrives at the hardware sink rate (no PulseAudio resampling).</summary>
+    bool? MatchesSinkRate
+);
+
+/// <summary>
+/// Idle stream corking: the output stream is paused after a period of silence.
+/// </summary>
+public record IdleCorkStats(
+    /// <summary>Whether the stream is corked right now.</summary>
+    bool IsCorked,
+    /// <summary>Times the stream has been corked for idleness.</summary>
+    int CorkCount,
+    /// <summary>Estimated write callbacks avoided while corked.</summary>
+    long WakeupsSaved,
+    /// <summary>Time from the last wake to the first audio written, in ms; the start-up cost of corking.</summary>
+    int? LastWakeToAudioMs
+);
+
+/// <summary>
+/// One physical output of an in-process combine-sink.
+/// </summary>
+public record CombineOutputStats(
+    string Sink,
+    /// <summary>Whether this output leads: it pulls the stream, the SDK syncs to its clock and the others align to it.</summary>
+    bool IsLead,
+    /// <summary>Measured latency of this output's card, or null before it opens.</summary>
+    int? OutputLatencyMs,
+    bool IsLatencyLocked,
+    /// <summary>Last measured offset from the lead in ms (positive = ahead).</summary>
+    double OffsetMs,
+    long FramesDropped,
+    long FramesInserted,
+    /// <summary>Times the offset exceeded the fine-correction range and was removed at once.</summary>
+    int Realignments
+);
+
 /// <summary>
 /// Sync status information.
 /// </summary>
@@ -71,6 +125,28 @@ public record ClockSyncStats(
     string TimingSource = "unknown"
 );
 
+/// <summary>
+/// Warm start details: whether persisted clock/latency state was used and how fast sync was reached.
+/// </summary>
+public record WarmStartStats(
+    /// <summary>Whether a persisted drift estimate existed for the server at player creation.</summary>
+    bool IsWarmStart,
+    /// <summary>Persisted drift rate in ppm, if any. For comparison only: the SDK clock filter cannot be seeded with it.</summary>
+    double? PersistedDriftPpm,
+    /// <summary>Persisted latency lock for the sink in ms, if any.</summary>
+    int? PersistedLatencyMs,
+    /// <summary>Whether the latency lock was reached early by confirming the persisted value.</summary>
+    bool LatencyWarmStarted,
+    /// <summary>Time from playback start to latency lock in ms, or null if not locked yet.</summary>
+    int? LatencyLockTimeMs,
+    /// <summary>Time from playback request to first in-sync audio in ms, or null if not reached yet.</summary>
+    int? TimeToFirstSyncMs,
+    /// <summary>Most recent cold start time to first sync for this server in ms.</summary>
+    int? LastColdStartSyncMs,
+    /// <summary>Most recent warm start time to first sync for this server in ms.</summary>
+    int? LastWarmStartSyncMs
+);
+
 /// <summary>
 /// Sample throughput counters.
 /// </summary>
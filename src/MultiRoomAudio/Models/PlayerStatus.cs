@@ -83,3 +83,27 @@ public record PlayersListResponse(
     List<PlayerResponse> Players,
     int Count
 );
+
+/// <summary>
+/// Local zones that Music Assistant has grouped onto the same stream.
+/// Each member still receives, decodes and buffers its own identical copy of the audio.
+/// </summary>
+public record LocalStreamGroup(
+    string GroupId,
+    /// <summary>Shared input format, e.g. "FLAC 48000Hz 2ch".</summary>
+    string Format,
+    List<string> Players,
+    /// <summary>Decodes of identical audio beyond the first (members - 1).</summary>
+    int RedundantDecodes,
+    /// <summary>Local PCM buffer memory held for identical audio beyond the first member.</summary>
+    long RedundantBufferBytes
+);
+
+/// <summary>
+/// Response for grouped local stream analysis.
+/// </summary>
+public record LocalStreamGroupsResponse(
+    List<LocalStreamGroup> Groups,
+    int TotalRedundantDecodes,
+    long TotalRedundantBufferBytes
+);
@@ -79,6 +79,14 @@ public class CombineSinkCreateRequest
     [Required(ErrorMessage = "At least 2 slave sinks are required.")]
     [MinLength(2, ErrorMessage = "At least 2 slave sinks are required.")]
     public required List<string> Slaves { get; set; }
+
+    /// <summary>
+    /// Fan out in-process instead of loading module-combine-sink.
+    /// The player writes to every slave through its own stream, with per-slave latency
+    /// measurement and drift correction instead of PA's adaptive resampler.
+    /// Ignored in mock hardware mode.
+    /// </summary>
+    public bool InProcess { get; set; } = false;
 }
 
 /// <summary>
@@ -125,6 +133,14 @@ public class RemapSinkCreateRequest
     /// Whether to remix (false = no mixing, just routing).
     /// </summary>
     public bool Remix { get; set; } = false;
+
+    /// <summary>
+    /// Route in-process instead of loading module-remap-sink.
+    /// Players on this sink share one stream on the master sink with the card's other
+    /// in-process zones (one hardware clock, one latency measurement).
+    /// Ignored in mock hardware mode.
+    /// </summary>
+    public bool InProcess { get; set; } = false;
 }
 
 /// <summary>
@@ -247,6 +263,11 @@ public class CustomSinkConfiguration
     /// Whether to remix (for remap-sink).
     /// </summary>
     public bool Remix { get; set; } = false;
+
+    /// <summary>
+    /// Route in-process instead of loading module-remap-sink or module-combine-sink.
+    /// </summary>
+    public bool InProcess { get; set; } = false;
 }
 
 /// <summary>
@@ -266,7 +287,8 @@ public record CustomSinkResponse(
     // Remap-sink specific
     string? MasterSink = null,
     int? Channels = null,
-    List<ChannelMapping>? ChannelMappings = null
+    List<ChannelMapping>? ChannelMappings = null,
+    bool InProcess = false
 );
 
 /// <summary>
@@ -277,6 +299,20 @@ public record CustomSinksListResponse(
     int Count
 );
 
+/// <summary>
+/// Outcome of loading one custom sink during startup.
+/// </summary>
+/// <param name="Name">Sink name.</param>
+/// <param name="Success">Whether the module loaded.</param>
+/// <param name="DurationMs">Time spent in pactl (excludes waiting for dependencies).</param>
+/// <param name="Error">Failure reason, if any.</param>
+public record SinkLoadResult(
+    string Name,
+    bool Success,
+    long DurationMs,
+    string? Error = null
+);
+
 /// <summary>
 /// Response for import scan results.
 /// </summary>
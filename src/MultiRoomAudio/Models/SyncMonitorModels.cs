@@ -0,0 +1,96 @@
+namespace MultiRoomAudio.Models;
+
+/// <summary>
+/// One playing zone's clocks, read at the same moment.
+/// </summary>
+public record ZoneClockReading(
+    /// <summary>Player name.</summary>
+    string Name,
+    /// <summary>Music Assistant group the player belongs to, if any.</summary>
+    string? GroupId,
+    /// <summary>Audio clock: Unix microseconds paced by the sound card (pa_stream_get_time).</summary>
+    long AudioClockUs,
+    /// <summary>System clock when the audio clock was read (Unix microseconds).</summary>
+    long LocalTimeUs,
+    /// <summary>Server clock minus local clock from the player's clock sync (ms).</summary>
+    double ServerOffsetMs,
+    /// <summary>Uncertainty of <see cref="ServerOffsetMs"/> (ms).</summary>
+    double OffsetUncertaintyMs,
+    /// <summary>How far playback is behind its schedule (ms); negative is ahead.</summary>
+    double SyncErrorMs
+);
+
+/// <summary>
+/// A zone in the sync matrix.
+/// </summary>
+public record ZoneSyncState(
+    /// <summary>Player name.</summary>
+    string Name,
+    /// <summary>Music Assistant group, if any.</summary>
+    string? GroupId,
+    /// <summary>How far the sound card clock has moved from the system clock since playback started (ms).</summary>
+    double AudioClockSkewMs,
+    /// <summary>Uncertainty of the player's server clock estimate (ms).</summary>
+    double ClockUncertaintyMs,
+    /// <summary>The player's own sync error (ms).</summary>
+    double SyncErrorMs
+);
+
+/// <summary>
+/// Offset between two zones on the server timeline.
+/// </summary>
+public record ZoneSyncPair(
+    /// <summary>First zone.</summary>
+    string ZoneA,
+    /// <summary>Second zone.</summary>
+    string ZoneB,
+    /// <summary>Whether both zones are in the same group (and should be in sync).</summary>
+    bool SameGroup,
+    /// <summary>Latest offset (ms): positive when zone A plays ahead of zone B.</summary>
+    double OffsetMs,
+    /// <summary>Mean offset over the window (ms).</summary>
+    double MeanOffsetMs,
+    /// <summary>Standard deviation of the offset over the window (ms).</summary>
+    double JitterMs,
+    /// <summary>Samples in the window.</summary>
+    int Samples,
+    /// <summary>Whether the pair is in alert (same group, diverged past the threshold).</summary>
+    bool Diverged
+);
+
+/// <summary>
+/// Two zones of a group that have drifted apart.
+/// </summary>
+public record SyncAlert(
+    /// <summary>Group both zones belong to.</summary>
+    string GroupId,
+    /// <summary>First zone.</summary>
+    string ZoneA,
+    /// <summary>Second zone.</summary>
+    string ZoneB,
+    /// <summary>Mean offset when the alert was raised (ms).</summary>
+    double OffsetMs,
+    /// <summary>When the alert was raised.</summary>
+    DateTime Since
+);
+
+/// <summary>
+/// Live cross-zone sync matrix.
+/// </summary>
+public record SyncMatrixResponse(
+    /// <summary>When the zones were last sampled.</summary>
+    DateTime Timestamp,
+    /// <summary>Alert threshold for the mean offset of a same-group pair (ms).</summary>
+    double ThresholdMs,
+    /// <summary>Zones sampled, in matrix order.</summary>
+    List<ZoneSyncState> Zones,
+    /// <summary>
+    /// Mean offset of each zone (row) against each other zone (column) in ms; null on the
+    /// diagonal and where a pair has no samples yet.
+    /// </summary>
+    List<List<double?>> OffsetMatrixMs,
+    /// <summary>Every pair of zones.</summary>
+    List<ZoneSyncPair> Pairs,
+    /// <summary>Active alerts.</summary>
+    List<SyncAlert> Alerts
+);
@@ -136,6 +136,14 @@ public class TriggerConfiguration
     [Range(0, 3600)]
     public int OffDelaySeconds { get; set; } = 60;
 
+    /// <summary>
+    /// Time the amplifier on this channel needs after power-on before it passes audio.
+    /// Playback start is held (via the start buffer threshold) for whatever part of this
+    /// has not yet elapsed when a stream starts. 0 = no hold.
+    /// </summary>
+    [Range(0, 5000)]
+    public int AmpWarmupMs { get; set; }
+
     /// <summary>
     /// Optional friendly name for this trigger/zone.
     /// </summary>
@@ -284,6 +292,9 @@ public class TriggerFeatureConfiguration
 
 /// <summary>
 /// Response for a single trigger channel status.
+/// LastTriggerToAudibleMs is the time from the relay switching on to the player's audio
+/// starting, for the last power-on; ClippedStarts counts starts where audio began before
+/// the amplifier warm-up had elapsed.
 /// </summary>
 public record TriggerResponse(
     int Channel,
@@ -294,7 +305,10 @@ public record TriggerResponse(
     RelayState RelayState,
     bool IsActive,
     DateTime? LastActivated,
-    DateTime? ScheduledOffTime
+    DateTime? ScheduledOffTime,
+    int AmpWarmupMs = 0,
+    int? LastTriggerToAudibleMs = null,
+    int ClippedStarts = 0
 );
 
 /// <summary>
@@ -313,7 +327,28 @@ public record TriggerBoardResponse(
     List<TriggerResponse> Triggers,
     int CurrentRelayStates,
     RelayStartupBehavior StartupBehavior,
-    RelayStartupBehavior ShutdownBehavior
+    RelayStartupBehavior ShutdownBehavior,
+    RelayCommandQueueStats? CommandQueue = null
+);
+
+/// <summary>
+/// Relay command queue metrics for a board.
+/// </summary>
+public record RelayCommandQueueStats(
+    /// <summary>Channel changes waiting to be written.</summary>
+    int QueueDepth,
+    /// <summary>Channel changes queued since the board connected.</summary>
+    long CommandsQueued,
+    /// <summary>Frames written to the board (one frame may carry several changes).</summary>
+    long FramesWritten,
+    /// <summary>Frames the board rejected or could not be written.</summary>
+    long FailedFrames,
+    /// <summary>Time from queueing to the board acknowledging, for the last frame.</summary>
+    double LastLatencyMs,
+    /// <summary>Smoothed command latency.</summary>
+    double AverageLatencyMs,
+    /// <summary>Worst command latency.</summary>
+    double MaxLatencyMs
 );
 
 /// <summary>
@@ -420,6 +455,12 @@ public class TriggerConfigureRequest
     [Range(0, 3600, ErrorMessage = "Off delay must be between 0 and 3600 seconds.")]
     public int OffDelaySeconds { get; set; } = 60;
 
+    /// <summary>
+    /// Amplifier warm-up in milliseconds (0-5000). Null leaves the current value unchanged.
+    /// </summary>
+    [Range(0, 5000, ErrorMessage = "Amplifier warm-up must be between 0 and 5000 ms.")]
+    public int? AmpWarmupMs { get; set; }
+
     /// <summary>
     /// Optional friendly name for this zone.
     /// </summary>
@@ -107,10 +107,14 @@ builder.Services.AddSingleton<BackendFactory>();
 builder.Services.AddSingleton<AlsaCapabilityService>();
 builder.Services.AddSingleton<DeviceMatchingService>();
 builder.Services.AddSingleton<VersionService>();
+builder.Services.AddSingleton<ClockStateService>();
+builder.Services.AddSingleton<RelayProbeCacheService>();
+builder.Services.AddSingleton<BufferBudgetService>();
 
 // Onboarding services
 builder.Services.AddSingleton<ToneGeneratorService>();
 builder.Services.AddSingleton<OnboardingService>();
+builder.Services.AddSingleton<LatencyCalibrationService>();
 
 // Add PulseAudio utilities (no startup dependency)
 // Use mock implementations when MOCK_HARDWARE is enabled
@@ -169,9 +173,19 @@ builder.Services.AddSingleton<CustomSinksService>();
 builder.Services.AddSingleton<PlayerManagerService>();
 builder.Services.AddSingleton<TriggerService>();
 
+// Cross-zone sync monitor (samples every playing zone's audio clock)
+builder.Services.AddSingleton<ZoneSyncMonitor>();
+builder.Services.AddHostedService(sp => sp.GetRequiredService<ZoneSyncMonitor>());
+
+// Kernel hotplug events (netlink) for HID button and relay board plug/unplug
+builder.Services.AddSingleton<HotplugMonitor>();
+builder.Services.AddHostedService(sp => sp.GetRequiredService<HotplugMonitor>());
+
 // HID button support for hardware volume/mute controls
 builder.Services.AddSingleton<HidInputDeviceDetector>();
 builder.Services.AddSingleton<PaSinkEventService>();
+builder.Services.AddSingleton<EvdevEventLoop>();
+builder.Services.AddSingleton<HidVolumeCoalescer>();
 builder.Services.AddSingleton<HidButtonService>();
 // PaSinkEventService runs as a background service (pactl subscribe)
 builder.Services.AddHostedService(sp => sp.GetRequiredService<PaSinkEventService>());
@@ -291,6 +305,7 @@ app.MapCardsEndpoints();
 app.MapLogsEndpoints();
 app.MapTriggersEndpoints();
 app.MapDiagnosticsEndpoints();
+app.MapMemoryEndpoints();
 
 // Startup progress endpoint (for web UI to show initialization status)
 app.MapGet("/api/startup", (StartupProgressService startup) => Results.Ok(startup.GetProgress()))
@@ -315,6 +330,7 @@ app.MapGet("/api", () => Results.Ok(new
         cards = "/api/cards",
         logs = "/api/logs",
         triggers = "/api/triggers",
+        memory = "/api/memory",
         swagger = "/docs"
     }
 }))
@@ -329,13 +345,13 @@ var loggingService = app.Services.GetRequiredService<LoggingService>();
 var loggerFactory = app.Services.GetRequiredService<ILoggerFactory>();
 loggerFactory.AddProvider(new WebLoggingProvider(loggingService, logLevel));
 
-// Wire up log streaming via SignalR
+// Wire up log streaming via SignalR (one push per batch from the log consumer)
 var logHubContext = app.Services.GetRequiredService<IHubContext<LogStreamHub>>();
-loggingService.LogEntryAdded += async (sender, entry) =>
+loggingService.LogBatchAdded += async (sender, entries) =>
 {
     try
     {
-        await logHubContext.BroadcastLogEntryAsync(entry.ToDto());
+        await logHubContext.BroadcastLogBatchAsync(entries.Select(e => e.ToDto()).ToList());
     }
     catch
     {
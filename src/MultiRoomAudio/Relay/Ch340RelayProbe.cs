@@ -1,6 +1,8 @@
+using System.Diagnostics;
 using System.IO.Ports;
 using System.Security.Cryptography;
 using System.Text;
+using MultiRoomAudio.Services;
 
 namespace MultiRoomAudio.Relay;
 
@@ -41,11 +43,39 @@ public enum Ch340ProbeResult
 /// Unified probe for CH340-based relay boards.
 /// Tries Modbus ASCII first, then LCUS binary protocol.
 /// </summary>
+/// <remarks>
+/// Candidate ports are probed in parallel, and each probe returns as soon as the board's
+/// response is complete rather than after a fixed wait, so only silent devices cost the full
+/// response timeout. Results are cached (see <see cref="RelayProbeCacheService"/>) and reused
+/// while the device's sysfs identity is unchanged, which skips opening the port at all.
+/// </remarks>
 public static class Ch340RelayProbe
 {
     private const int BaudRate = 9600;
     private const int ProbeTimeoutMs = 500;
 
+    /// <summary>
+    /// Longest wait for the first byte of a response. Only reached by devices that don't answer.
+    /// </summary>
+    internal const int ResponseTimeoutMs = 200;
+
+    /// <summary>
+    /// A response is complete once no byte has arrived for this long. At 9600 baud bytes are
+    /// ~1ms apart; the CH340 forwards them to the host within a few milliseconds.
+    /// </summary>
+    private const int ResponseQuietMs = 20;
+
+    /// <summary>
+    /// Interval at which the receive buffer is checked while waiting for a response.
+    /// </summary>
+    private const int ResponsePollMs = 2;
+
+    /// <summary>
+    /// Persistent probe result cache. Set at startup by the relay device enumerator;
+    /// when null every port is probed.
+    /// </summary>
+    internal static RelayProbeCacheService? Cache { get; set; }
+
     /// <summary>
     /// Probe a serial port to determine if it's a relay board and which protocol it uses.
     /// Tries Modbus first (more reliable detection), then LCUS.
@@ -56,6 +86,16 @@ public static class Ch340RelayProbe
     public static (Ch340ProbeResult Result, Ch340Protocol Protocol, int ChannelCount) ProbeDevice(
         string portName,
         ILogger? logger = null)
+    {
+        return ProbeDeviceAsync(portName, logger).GetAwaiter().GetResult();
+    }
+
+    /// <summary>
+    /// Asynchronous form of <see cref="ProbeDevice"/>; waits for responses without blocking a thread.
+    /// </summary>
+    public static async Task<(Ch340ProbeResult Result, Ch340Protocol Protocol, int ChannelCount)> ProbeDeviceAsync(
+        string portName,
+        ILogger? logger = null)
     {
         SerialPort? port = null;
         try
@@ -81,20 +121,20 @@ public static class Ch340RelayProbe
             port.DiscardOutBuffer();
 
             // Try Modbus first - send "read coils" command
-            var modbusResult = TryModbusProbe(port, logger);
+            var modbusResult = await TryModbusProbeAsync(port, logger);
             if (modbusResult.Success)
             {
                 logger?.LogDebug("CH340 probe: {Port} responds to Modbus protocol", portName);
                 return (Ch340ProbeResult.RelayBoard, Ch340Protocol.Modbus, 16); // Modbus boards are typically 16-channel
             }
 
-            // Small delay between probes
-            Thread.Sleep(100);
+            // Let any late reply to the Modbus probe finish arriving before switching protocol
+            await ReadResponseAsync(port, null, ResponseQuietMs);
             port.DiscardInBuffer();
             port.DiscardOutBuffer();
 
             // Try LCUS protocol - send status query
-            var lcusResult = TryLcusProbe(port, logger);
+            var lcusResult = await TryLcusProbeAsync(port, logger);
             if (lcusResult.Success)
             {
                 logger?.LogDebug("CH340 probe: {Port} responds to LCUS protocol with {Channels} channels",
@@ -131,7 +171,7 @@ public static class Ch340RelayProbe
     /// Try Modbus ASCII "read coils" command.
     /// Modbus boards echo the command back as acknowledgment.
     /// </summary>
-    private static (bool Success, int ChannelCount) TryModbusProbe(SerialPort port, ILogger? logger)
+    private static async Task<(bool Success, int ChannelCount)> TryModbusProbeAsync(SerialPort port, ILogger? logger)
     {
         try
         {
@@ -144,15 +184,12 @@ public static class Ch340RelayProbe
             const string command = ":FE0100000010F1\r\n";
 
             port.Write(command);
-            Thread.Sleep(200);
 
-            var bytesAvailable = port.BytesToRead;
-            if (bytesAvailable == 0)
+            // Modbus ASCII frames end with CR LF
+            var buffer = await ReadResponseAsync(port, r => r.Count > 0 && r[^1] == (byte)'\n', ResponseTimeoutMs);
+            if (buffer.Length == 0)
                 return (false, 0);
 
-            // Read response
-            var buffer = new byte[bytesAvailable];
-            port.Read(buffer, 0, bytesAvailable);
             var response = Encoding.ASCII.GetString(buffer);
 
             // Modbus boards echo the command or send a response starting with ':'
@@ -179,25 +216,22 @@ public static class Ch340RelayProbe
     /// Try LCUS binary status query.
     /// LCUS boards respond with N bytes (one per channel) indicating relay state.
     /// </summary>
-    private static (bool Success, int ChannelCount) TryLcusProbe(SerialPort port, ILogger? logger)
+    private static async Task<(bool Success, int ChannelCount)> TryLcusProbeAsync(SerialPort port, ILogger? logger)
     {
         try
         {
             // LCUS status query: single byte 0xFF
             port.Write(new byte[] { 0xFF }, 0, 1);
-            Thread.Sleep(200);
 
-            var bytesAvailable = port.BytesToRead;
-            if (bytesAvailable == 0)
+            // No length prefix: the reply is complete when the board goes quiet (or at 8 channels)
+            var buffer = await ReadResponseAsync(port, r => r.Count >= 8, ResponseTimeoutMs);
+            if (buffer.Length == 0)
                 return (false, 0);
 
             // LCUS boards return 1-8 bytes (one per channel)
             // Each byte is the channel state (0x00 or 0x01)
-            if (bytesAvailable >= 1 && bytesAvailable <= 8)
+            if (buffer.Length >= 1 && buffer.Length <= 8)
             {
-                var buffer = new byte[bytesAvailable];
-                port.Read(buffer, 0, bytesAvailable);
-
                 // Validate response: each byte should be 0x00 or 0x01
                 bool valid = true;
                 foreach (var b in buffer)
@@ -212,9 +246,9 @@ public static class Ch340RelayProbe
                 if (valid)
                 {
                     logger?.LogDebug("LCUS probe: Got {Count} channel states: {States}",
-                        bytesAvailable,
+                        buffer.Length,
                         string.Join(" ", buffer.Select(b => b.ToString("X2"))));
-                    return (true, bytesAvailable);
+                    return (true, buffer.Length);
                 }
             }
 
@@ -231,8 +265,53 @@ public static class Ch340RelayProbe
         }
     }
 
+    /// <summary>
+    /// Read a response from a serial port, returning as soon as it is complete instead of
+    /// after a fixed wait.
+    /// </summary>
+    /// <param name="port">Open serial port the request was written to.</param>
+    /// <param name="isComplete">
+    /// Returns true once the bytes received so far form a whole response. When null (or never
+    /// true), the response ends when no byte has arrived for a short quiet period.
+    /// </param>
+    /// <param name="timeoutMs">Longest total wait; reached only if the device keeps silent or talking.</param>
+    /// <returns>The bytes received (empty if none).</returns>
+    internal static async Task<byte[]> ReadResponseAsync(SerialPort port, Func<List<byte>, bool>? isComplete, int timeoutMs)
+    {
+        var response = new List<byte>();
+        var started = Stopwatch.GetTimestamp();
+        var lastByteAt = started;
+
+        while (true)
+        {
+            var available = port.BytesToRead;
+            if (available > 0)
+            {
+                var chunk = new byte[available];
+                var read = port.Read(chunk, 0, available);
+                response.AddRange(new ArraySegment<byte>(chunk, 0, read));
+                lastByteAt = Stopwatch.GetTimestamp();
+
+                if (isComplete?.Invoke(response) == true)
+                    break;
+            }
+            else if (response.Count > 0 && Stopwatch.GetElapsedTime(lastByteAt).TotalMilliseconds >= ResponseQuietMs)
+            {
+                break;
+            }
+
+            if (Stopwatch.GetElapsedTime(started).TotalMilliseconds >= timeoutMs)
+                break;
+
+            await Task.Delay(ResponsePollMs);
+        }
+
+        return response.ToArray();
+    }
+
     /// <summary>
     /// Enumerate all CH340 serial ports and detect which ones are relay boards.
+    /// Ports are probed in parallel; devices with a valid cached result are not opened.
     /// </summary>
     public static List<Ch340RelayDeviceInfo> EnumerateDevices(ILogger? logger = null)
     {
@@ -243,10 +322,21 @@ public static class Ch340RelayProbe
             var ports = ModbusRelayBoard.GetAvailableSerialPorts();
             logger?.LogDebug("CH340 probe: Found {Count} serial ports to probe", ports.Count);
 
-            foreach (var port in ports)
+            var started = Stopwatch.GetTimestamp();
+            var probes = ports.Select(port => ProbeCachedAsync(port, logger)).ToArray();
+            var outcomes = Task.WhenAll(probes).GetAwaiter().GetResult();
+
+            var cache = Cache;
+            if (cache != null && outcomes.Any(o => o.Recorded))
             {
-                var (probeResult, protocol, channelCount) = ProbeDevice(port, logger);
+                cache.Save();
+            }
+
+            logger?.LogDebug("CH340 probe: {Count} ports checked in {Elapsed:F0}ms ({Cached} from cache)",
+                ports.Count, Stopwatch.GetElapsedTime(started).TotalMilliseconds, outcomes.Count(o => o.FromCache));
 
+            foreach (var (port, probeResult, protocol, channelCount, _, _) in outcomes)
+            {
                 if (probeResult != Ch340ProbeResult.RelayBoard)
                 {
                     logger?.LogDebug("CH340 probe: Skipping {Port} - {Result}", port, probeResult);
@@ -276,6 +366,100 @@ public static class Ch340RelayProbe
         return result;
     }
 
+    /// <summary>
+    /// Probe one port, using the cached result when the device's identity is unchanged.
+    /// Definite results (relay board or no response) are recorded; busy ports and errors are not.
+    /// </summary>
+    private static async Task<(string Port, Ch340ProbeResult Result, Ch340Protocol Protocol, int ChannelCount, bool FromCache, bool Recorded)>
+        ProbeCachedAsync(string port, ILogger? logger)
+    {
+        var cache = Cache;
+        var identity = cache != null ? GetUsbIdentity(port) : null;
+
+        if (cache != null && identity != null && cache.TryGetValid(identity, out var cached))
+        {
+            logger?.LogDebug("CH340 probe: {Port} unchanged since {ProbedAt:u}, using cached result ({Protocol})",
+                port, cached.ProbedAt, cached.Protocol);
+
+            var cachedResult = cached.Protocol == Ch340Protocol.Unknown
+                ? Ch340ProbeResult.NoResponse
+                : Ch340ProbeResult.RelayBoard;
+            return (port, cachedResult, cached.Protocol, cached.ChannelCount, true, false);
+        }
+
+        var (result, protocol, channelCount) = await ProbeDeviceAsync(port, logger);
+
+        var recorded = false;
+        if (cache != null && identity != null &&
+            result is Ch340ProbeResult.RelayBoard or Ch340ProbeResult.NoResponse)
+        {
+            cache.Record(identity, port, protocol, channelCount);
+            recorded = true;
+        }
+
+        return (port, result, protocol, channelCount, false, recorded);
+    }
+
+    /// <summary>
+    /// Drop the cached probe result for a port, so the next enumeration probes it again.
+    /// Used when a board fails to open as the protocol it was cached as.
+    /// </summary>
+    internal static void InvalidateCache(string portName)
+    {
+        var cache = Cache;
+        var identity = cache != null ? GetUsbIdentity(portName) : null;
+        if (cache != null && identity != null)
+        {
+            cache.Invalidate(identity);
+        }
+    }
+
+    /// <summary>
+    /// Read the sysfs identity of the USB device behind a serial port (Linux only).
+    /// </summary>
+    /// <remarks>
+    /// /sys/class/tty/ttyUSBn links into the device tree (…/1-2.3/1-2.3:1.0/ttyUSBn/tty/ttyUSBn);
+    /// the nearest ancestor with an idVendor file is the USB device, named by its port path.
+    /// A few small file reads, versus opening the port and waiting for a reply.
+    /// </remarks>
+    internal static UsbSerialIdentity? GetUsbIdentity(string portName)
+    {
+        if (!OperatingSystem.IsLinux())
+            return null;
+
+        try
+        {
+            var ttyLink = new DirectoryInfo($"/sys/class/tty/{Path.GetFileName(portName)}");
+            var tty = ttyLink.ResolveLinkTarget(returnFinalTarget: true) as DirectoryInfo ?? ttyLink;
+
+            var usbDevice = tty.Parent;
+            while (usbDevice != null && !File.Exists(Path.Combine(usbDevice.FullName, "idVendor")))
+            {
+                usbDevice = usbDevice.Parent;
+            }
+
+            if (usbDevice == null)
+                return null;
+
+            string? ReadAttribute(string name)
+            {
+                var path = Path.Combine(usbDevice.FullName, name);
+                return File.Exists(path) ? File.ReadAllText(path).Trim() : null;
+            }
+
+            var serial = ReadAttribute("serial");
+            var fingerprint = string.Join(":",
+                ReadAttribute("idVendor"), ReadAttribute("idProduct"), serial,
+                ReadAttribute("busnum"), ReadAttribute("devnum"));
+
+            return new UsbSerialIdentity(usbDevice.Name, serial, fingerprint);
+        }
+        catch
+        {
+            return null;
+        }
+    }
+
     /// <summary>
     /// Get the USB port path for a serial port device (Linux only).
     /// </summary>
@@ -380,3 +564,17 @@ public record Ch340RelayDeviceInfo(
         return $"{hash[0]:X2}{hash[1]:X2}{hash[2]:X2}{hash[3]:X2}";
     }
 }
+
+/// <summary>
+/// Sysfs identity of the USB device behind a serial port, used to validate cached probe results.
+/// </summary>
+/// <param name="PortPath">USB port path of the device (e.g., "1-2.3").</param>
+/// <param name="Serial">USB serial number, if the device reports one (most CH340s don't).</param>
+/// <param name="Fingerprint">Vendor, product, serial, bus and device number; changes whenever the device is re-plugged.</param>
+public record UsbSerialIdentity(string PortPath, string? Serial, string Fingerprint)
+{
+    /// <summary>
+    /// Cache key: USB port path hash and serial number.
+    /// </summary>
+    public string CacheKey => $"{Ch340RelayDeviceInfo.StableHash(PortPath)}:{Serial}";
+}
@@ -795,6 +795,33 @@ public sealed class FtdiRelayBoard : IRelayBoard
         }
     }
 
+    /// <summary>
+    /// Set several relays with a single bitbang write.
+    /// </summary>
+    /// <param name="mask">Channels to change (bit 0 = relay 1).</param>
+    /// <param name="values">New state of each channel in <paramref name="mask"/>.</param>
+    public bool SetRelays(int mask, int values)
+    {
+        lock (_lock)
+        {
+            var newState = _currentState;
+            for (int channel = 1; channel <= _channelCount; channel++)
+            {
+                var channelBit = 1 << (channel - 1);
+                if ((mask & channelBit) == 0)
+                    continue;
+
+                // Pin bits differ from channel bits on 4-channel boards
+                var pinBit = GetBitMaskForChannel(channel);
+                newState = (values & channelBit) != 0
+                    ? (ushort)(newState | pinBit)
+                    : (ushort)(newState & ~pinBit);
+            }
+
+            return SetAllRelays(newState);
+        }
+    }
+
     /// <summary>
     /// Turn off all relays.
     /// </summary>
@@ -20,6 +20,8 @@ public sealed class HidRelayBoard : IRelayBoard
     // HID protocol commands
     private const byte CMD_ON = 0xFF;
     private const byte CMD_OFF = 0xFD;
+    private const byte CMD_ALL_ON = 0xFE;
+    private const byte CMD_ALL_OFF = 0xFC;
 
     private readonly ILogger<HidRelayBoard>? _logger;
     private HidDevice? _device;
@@ -289,6 +291,55 @@ public sealed class HidRelayBoard : IRelayBoard
         }
     }
 
+    /// <summary>
+    /// Set several relays. The protocol only addresses one relay or all of them, so a change
+    /// that leaves every relay on (or off) is sent as one all-on/all-off report and anything
+    /// else as one report per changed relay.
+    /// </summary>
+    public bool SetRelays(int mask, int values)
+    {
+        if (!IsConnected || _stream == null)
+            return false;
+
+        var allMask = (1 << _channelCount) - 1;
+        var newState = (_currentState & ~mask) | (values & mask & allMask);
+        var changed = newState ^ _currentState;
+        if (changed == 0)
+            return true;
+
+        if (System.Numerics.BitOperations.PopCount((uint)changed) > 1 && (newState == allMask || newState == 0))
+        {
+            try
+            {
+                var report = new byte[9];
+                report[0] = 0;  // Report ID
+                report[1] = newState == 0 ? CMD_ALL_OFF : CMD_ALL_ON;
+
+                _stream.SetFeature(report);
+
+                var oldState = _currentState;
+                _currentState = newState;
+                _logger?.LogDebug("HID SetRelays(mask 0x{Mask:X2}): local state 0x{Old:X2}->0x{New:X2}",
+                    mask, oldState, _currentState);
+                return true;
+            }
+            catch (Exception ex)
+            {
+                _logger?.LogError(ex, "Failed to set relays (mask 0x{Mask:X2})", mask);
+                return false;
+            }
+        }
+
+        bool success = true;
+        for (int channel = 1; channel <= _channelCount; channel++)
+        {
+            var bit = 1 << (channel - 1);
+            if ((changed & bit) != 0 && !SetRelay(channel, (newState & bit) != 0))
+                success = false;
+        }
+        return success;
+    }
+
     public RelayState GetRelay(int channel)
     {
         if (!IsConnected || channel < 1 || channel > _channelCount)
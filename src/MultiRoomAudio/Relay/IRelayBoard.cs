@@ -43,6 +43,34 @@ public interface IRelayBoard : IDisposable
     /// </summary>
     bool SetRelay(int channel, bool on);
 
+    /// <summary>
+    /// Set several relay channels at once.
+    /// </summary>
+    /// <param name="mask">Channels to change (bit 0 = relay 1).</param>
+    /// <param name="values">New state of each channel in <paramref name="mask"/>; other bits are ignored.</param>
+    /// <remarks>
+    /// Boards whose protocol can write several channels in one frame override this; the
+    /// default sends one command per changed channel.
+    /// </remarks>
+    bool SetRelays(int mask, int values)
+    {
+        var success = true;
+        for (int channel = 1; channel <= ChannelCount; channel++)
+        {
+            var bit = 1 << (channel - 1);
+            if ((mask & bit) == 0)
+                continue;
+
+            var on = (values & bit) != 0;
+            if (GetRelay(channel) == (on ? RelayState.On : RelayState.Off))
+                continue;
+
+            if (!SetRelay(channel, on))
+                success = false;
+        }
+        return success;
+    }
+
     /// <summary>
     /// Get the current state of a relay channel.
     /// </summary>
@@ -146,7 +146,12 @@ public sealed class LcusRelayBoard : IRelayBoard
                 {
                     _logger?.LogDebug("Found LCUS relay board by USB path hash: {Hash} -> {Port}",
                         pathHash, device.PortName);
-                    return TryOpenPort(device.PortName);
+                    if (TryOpenPort(device.PortName))
+                        return true;
+
+                    // The enumeration may have come from the probe cache - probe afresh next time
+                    Ch340RelayProbe.InvalidateCache(device.PortName);
+                    return false;
                 }
             }
 
@@ -243,18 +248,15 @@ public sealed class LcusRelayBoard : IRelayBoard
         {
             _serialPort.DiscardInBuffer();
             _serialPort.Write(new byte[] { StatusQuery }, 0, 1);
-            Thread.Sleep(100);
 
-            var bytesAvailable = _serialPort.BytesToRead;
-            if (bytesAvailable == 0)
+            // Returns once the board goes quiet rather than after a fixed wait
+            var buffer = Ch340RelayProbe.ReadResponseAsync(
+                _serialPort, r => r.Count >= 8, Ch340RelayProbe.ResponseTimeoutMs).GetAwaiter().GetResult();
+            if (buffer.Length == 0)
                 return null;
 
             // The number of bytes returned indicates the channel count
-            var buffer = new byte[bytesAvailable];
-            _serialPort.Read(buffer, 0, bytesAvailable);
-
-            // Update channel count based on response
-            _channelCount = Math.Clamp(bytesAvailable, 1, 8);
+            _channelCount = Math.Clamp(buffer.Length, 1, 8);
 
             // Convert channel states to bitmask
             byte state = 0;
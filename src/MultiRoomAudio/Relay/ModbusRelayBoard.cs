@@ -15,6 +15,7 @@ namespace MultiRoomAudio.Relay;
 /// - Commands are ASCII-encoded hex strings starting with ':' and ending with CR+LF
 /// - Device address: 0xFE (254)
 /// - Function code 0x05: Write single coil (relay control)
+/// - Function code 0x0F: Write multiple coils (several relays in one frame)
 /// - Relay addresses: 0x00-0x0F for channels 1-16
 /// - ON value: 0xFF00, OFF value: 0x0000
 /// - Example ON command for channel 1: :FE050000FF00FE\r\n
@@ -150,7 +151,12 @@ public sealed class ModbusRelayBoard : IRelayBoard
                 {
                     _logger?.LogDebug("Found Modbus relay board by USB path hash: {Hash} -> {Port}",
                         pathHash, device.PortName);
-                    return TryOpenPort(device.PortName);
+                    if (TryOpenPort(device.PortName))
+                        return true;
+
+                    // The enumeration may have come from the probe cache - probe afresh next time
+                    Ch340RelayProbe.InvalidateCache(device.PortName);
+                    return false;
                 }
             }
 
@@ -308,6 +314,51 @@ public sealed class ModbusRelayBoard : IRelayBoard
         }
     }
 
+    /// <summary>
+    /// Set several relays in one Write Multiple Coils (0x0F) frame.
+    /// </summary>
+    public bool SetRelays(int mask, int values)
+    {
+        lock (_lock)
+        {
+            if (_serialPort == null || !_serialPort.IsOpen)
+            {
+                _logger?.LogWarning("Cannot set relays - serial port not open");
+                return false;
+            }
+
+            var channelMask = (1 << _channelCount) - 1;
+            var newState = (ushort)((_currentState & ~mask) | (values & mask & channelMask));
+            if (newState == _currentState)
+                return true;
+
+            try
+            {
+                var command = BuildWriteCoilsCommand(newState);
+                _serialPort.Write(command);
+
+                Thread.Sleep(CommandDelayMs);
+
+                if (_serialPort.BytesToRead > 0)
+                {
+                    _serialPort.DiscardInBuffer();
+                }
+
+                var oldState = _currentState;
+                _currentState = newState;
+                _logger?.LogDebug("Modbus SetRelays(mask 0x{Mask:X4}): state 0x{Old:X4}->0x{New:X4}",
+                    mask, oldState, _currentState);
+
+                return true;
+            }
+            catch (Exception ex)
+            {
+                _logger?.LogError(ex, "Failed to set relays (mask 0x{Mask:X4})", mask);
+                return false;
+            }
+        }
+    }
+
     /// <inheritdoc />
     public RelayState GetRelay(int channel)
     {
@@ -455,13 +506,21 @@ public sealed class ModbusRelayBoard : IRelayBoard
     /// Build command to set all relays on or off using Write Multiple Coils (0x0F).
     /// </summary>
     private string BuildAllRelaysCommand(bool on)
+    {
+        return BuildWriteCoilsCommand(on ? (ushort)((1 << _channelCount) - 1) : (ushort)0);
+    }
+
+    /// <summary>
+    /// Build a Write Multiple Coils (0x0F) command that sets every relay to <paramref name="state"/>.
+    /// </summary>
+    private string BuildWriteCoilsCommand(ushort state)
     {
         // Function 0x0F: Write Multiple Coils
         // Address: 0xFE
         // Start address: 0x0000
-        // Quantity: 0x0010 (16 coils)
-        // Byte count: 0x02 (2 bytes for 16 coils)
-        // Coil values: 0xFFFF (all on) or 0x0000 (all off)
+        // Quantity: one coil per channel
+        // Byte count: 0x02 for 16 coils, 0x01 for up to 8
+        // Coil values: coil 0 in the least significant bit of the first byte
 
         byte startHi = 0x00;
         byte startLo = 0x00;
@@ -469,15 +528,10 @@ public sealed class ModbusRelayBoard : IRelayBoard
         byte countLo = (byte)_channelCount;
         byte byteCount = (byte)((_channelCount + 7) / 8);
 
-        // Calculate coil values based on channel count
         var coilValues = new byte[byteCount];
-        if (on)
+        for (int i = 0; i < byteCount; i++)
         {
-            for (int i = 0; i < byteCount; i++)
-            {
-                int bitsInThisByte = Math.Min(8, _channelCount - (i * 8));
-                coilValues[i] = (byte)((1 << bitsInThisByte) - 1);
-            }
+            coilValues[i] = (byte)((state >> (i * 8)) & 0xFF);
         }
 
         // Build data array
@@ -534,46 +588,27 @@ public sealed class ModbusRelayBoard : IRelayBoard
 
     /// <summary>
     /// Enumerate available Modbus relay board devices.
-    /// Probes each serial port with a Modbus "read coils" command to verify it's actually a relay board.
-    /// Only returns devices that respond correctly, filtering out other CH340 devices (Arduinos, GPS, etc.).
+    /// Uses the shared CH340 probe (parallel, cached) and keeps the ports that answered the
+    /// Modbus "read coils" command, filtering out other CH340 devices (Arduinos, GPS, LCUS boards, etc.).
     /// </summary>
     public static List<ModbusRelayDeviceInfo> EnumerateDevices(ILogger? logger = null)
     {
         var result = new List<ModbusRelayDeviceInfo>();
 
-        try
+        foreach (var device in Ch340RelayProbe.EnumerateDevices(logger))
         {
-            var ports = GetAvailableSerialPorts();
-
-            foreach (var port in ports)
-            {
-                // Try to get the USB port path for stable identification
-                var usbPortPath = GetUsbPortPath(port, logger);
-
-                // Probe the device to verify it's actually a Modbus relay board
-                var probeResult = ProbeDevice(port, logger);
-
-                if (probeResult == ModbusProbeResult.RelayBoard)
-                {
-                    result.Add(new ModbusRelayDeviceInfo(
-                        PortName: port,
-                        Description: GetPortDescription(port),
-                        IsAvailable: true,
-                        UsbPortPath: usbPortPath
-                    ));
-
-                    logger?.LogDebug("Verified Modbus relay board: {Port}, USB path: {UsbPath}",
-                        port, usbPortPath ?? "(unknown)");
-                }
-                else
-                {
-                    logger?.LogDebug("Skipping {Port}: probe result = {Result}", port, probeResult);
-                }
-            }
-        }
-        catch (Exception ex)
-        {
-            logger?.LogWarning(ex, "Error enumerating serial ports");
+            if (device.Protocol != Ch340Protocol.Modbus)
+                continue;
+
+            result.Add(new ModbusRelayDeviceInfo(
+                PortName: device.PortName,
+                Description: GetPortDescription(device.PortName),
+                IsAvailable: true,
+                UsbPortPath: device.UsbPortPath
+            ));
+
+            logger?.LogDebug("Verified Modbus relay board: {Port}, USB path: {UsbPath}",
+                device.PortName, device.UsbPortPath ?? "(unknown)");
         }
 
         return result;
@@ -642,14 +677,13 @@ public sealed class ModbusRelayBoard : IRelayBoard
             port.Write(probeCommand);
             port.BaseStream.Flush();
 
-            // Wait for response
-            Thread.Sleep(200);
+            // Wait for the echo, which ends with CR LF
+            var responseBytes = Ch340RelayProbe.ReadResponseAsync(
+                port, r => r.Count > 0 && r[^1] == (byte)'\n', Ch340RelayProbe.ResponseTimeoutMs).GetAwaiter().GetResult();
 
             // Check for response
-            if (port.BytesToRead > 0)
+            if (responseBytes.Length > 0)
             {
-                var responseBytes = new byte[port.BytesToRead];
-                port.Read(responseBytes, 0, responseBytes.Length);
                 var response = System.Text.Encoding.ASCII.GetString(responseBytes);
 
                 logger?.LogDebug("Probe response from {Port}: {Response}", portName, response.TrimEnd());
@@ -683,66 +717,6 @@ public sealed class ModbusRelayBoard : IRelayBoard
         }
     }
 
-    /// <summary>
-    /// Get the USB port path for a serial port device (Linux only).
-    /// Returns the bus-port path like "1-2.3" which is stable across reboots.
-    /// </summary>
-    private static string? GetUsbPortPath(string portName, ILogger? logger = null)
-    {
-        if (!OperatingSystem.IsLinux())
-            return null;
-
-        try
-        {
-            // On Linux, /sys/class/tty/ttyUSBX/device is a symlink to the USB device
-            // e.g., /sys/class/tty/ttyUSB0/device -> ../../devices/.../usb1/1-2/1-2.3/1-2.3:1.0/ttyUSB0
-            var deviceName = Path.GetFileName(portName); // e.g., "ttyUSB0"
-            var sysPath = $"/sys/class/tty/{deviceName}/device";
-
-            if (!Directory.Exists(sysPath))
-            {
-                logger?.LogDebug("Sysfs path not found for {Port}: {Path}", portName, sysPath);
-                return null;
-            }
-
-            // Resolve the symlink to get the full device path
-            var targetPath = Path.GetFullPath(sysPath);
-
-            // Extract the USB port path (e.g., "1-2.3") from the path
-            // The path typically contains something like /usb1/1-2/1-2.3/1-2.3:1.0/
-            var match = System.Text.RegularExpressions.Regex.Match(
-                targetPath,
-                @"/(\d+-[\d.]+)(?::\d+\.\d+)?/");
-
-            if (match.Success)
-            {
-                return match.Groups[1].Value;
-            }
-
-            // Alternative: try reading from uevent or other sysfs files
-            var ueventPath = Path.Combine(sysPath, "..", "..", "uevent");
-            if (File.Exists(ueventPath))
-            {
-                var uevent = File.ReadAllText(ueventPath);
-                var devPathMatch = System.Text.RegularExpressions.Regex.Match(
-                    uevent,
-                    @"DEVPATH=.*/(\d+-[\d.]+)/");
-                if (devPathMatch.Success)
-                {
-                    return devPathMatch.Groups[1].Value;
-                }
-            }
-
-            logger?.LogDebug("Could not extract USB port path from {Path}", targetPath);
-            return null;
-        }
-        catch (Exception ex)
-        {
-            logger?.LogDebug(ex, "Error getting USB port path for {Port}", portName);
-            return null;
-        }
-    }
-
     /// <summary>
     /// Get a human-readable description for a serial port.
     /// </summary>
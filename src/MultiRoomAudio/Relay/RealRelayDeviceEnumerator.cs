@@ -1,4 +1,5 @@
 using MultiRoomAudio.Models;
+using MultiRoomAudio.Services;
 
 namespace MultiRoomAudio.Relay;
 
@@ -6,20 +7,51 @@ namespace MultiRoomAudio.Relay;
 /// Real implementation of relay device enumeration.
 /// Discovers actual FTDI, HID, Modbus, and LCUS relay boards connected to the system.
 /// </summary>
+/// <remarks>
+/// While the <see cref="HotplugMonitor"/> is running, the device list is kept until a USB,
+/// serial or hidraw device is added or removed, instead of being rescanned on every request.
+/// </remarks>
 public class RealRelayDeviceEnumerator : IRelayDeviceEnumerator
 {
     private readonly ILogger<RealRelayDeviceEnumerator> _logger;
+    private readonly HotplugMonitor? _hotplug;
+    private readonly object _cacheLock = new();
+    private List<RelayDeviceInfo>? _cachedDevices;
+    private long _generation;
 
-    public RealRelayDeviceEnumerator(ILogger<RealRelayDeviceEnumerator> logger)
+    public RealRelayDeviceEnumerator(
+        ILogger<RealRelayDeviceEnumerator> logger,
+        RelayProbeCacheService probeCache,
+        HotplugMonitor? hotplug = null)
     {
         _logger = logger;
+        _hotplug = hotplug;
+
+        // Boards re-enumerate through the static probe when reconnecting, so share the cache there
+        Ch340RelayProbe.Cache = probeCache;
+
+        if (_hotplug != null)
+        {
+            _hotplug.DeviceChanged += OnHotplug;
+        }
     }
 
     /// <inheritdoc />
     public bool IsHardwareAvailable =>
         FtdiRelayBoard.IsLibraryAvailable() ||
-        HidRelayBoard.EnumerateDevices(_logger).Count > 0 ||
-        Ch340RelayProbe.EnumerateDevices(_logger).Count > 0;
+        GetAllDevices().Count > 0;
+
+    private void OnHotplug(object? sender, HotplugEventArgs e)
+    {
+        if (e.Device.Subsystem is not ("tty" or "hidraw" or "usb"))
+            return;
+
+        lock (_cacheLock)
+        {
+            _cachedDevices = null;
+            _generation++;
+        }
+    }
 
     /// <inheritdoc />
     public List<FtdiDeviceInfo> GetFtdiDevices()
@@ -45,6 +77,31 @@ public class RealRelayDeviceEnumerator : IRelayDeviceEnumerator
 
     /// <inheritdoc />
     public List<RelayDeviceInfo> GetAllDevices()
+    {
+        long generation;
+        lock (_cacheLock)
+        {
+            if (_cachedDevices != null && _hotplug?.IsRunning == true)
+                return new List<RelayDeviceInfo>(_cachedDevices);
+
+            generation = _generation;
+        }
+
+        var result = ScanAllDevices();
+
+        lock (_cacheLock)
+        {
+            // Don't keep a scan that raced with a hotplug event
+            if (_generation == generation && _hotplug?.IsRunning == true)
+            {
+                _cachedDevices = new List<RelayDeviceInfo>(result);
+            }
+        }
+
+        return result;
+    }
+
+    private List<RelayDeviceInfo> ScanAllDevices()
     {
         var result = new List<RelayDeviceInfo>();
 
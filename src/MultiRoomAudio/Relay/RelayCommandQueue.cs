@@ -0,0 +1,256 @@
+using System.Diagnostics;
+using System.Numerics;
+using MultiRoomAudio.Models;
+
+namespace MultiRoomAudio.Relay;
+
+/// <summary>
+/// Asynchronous command queue for one relay board.
+/// Channel changes are queued without blocking the caller and written by a single worker,
+/// merging every change that arrives within a short window into one multi-channel frame.
+/// </summary>
+/// <remarks>
+/// Board writes are slow (serial boards sleep ~100ms per command for the echo), and trigger
+/// changes arrive from player-state events. A grouped start that switches several channels
+/// therefore costs one frame instead of one command per channel, and no player thread waits
+/// for the hardware. Changes that arrive while a frame is being written are merged into the
+/// next one; a later change for the same channel replaces the pending one.
+/// </remarks>
+public sealed class RelayCommandQueue : IDisposable
+{
+    private readonly ILogger? _logger;
+    private readonly string _boardId;
+    private readonly Func<IRelayBoard?> _resolveBoard;
+    private readonly object _lock = new();
+    private readonly SemaphoreSlim _signal = new(0);
+    private readonly CancellationTokenSource _cts = new();
+    private readonly Task _worker;
+
+    // Pending changes, guarded by _lock: bit n of the mask = channel n+1 has a change
+    private int _pendingMask;
+    private int _pendingValues;
+    private long _oldestPendingTimestamp;
+    private List<TaskCompletionSource<bool>> _pendingWaiters = new();
+
+    // Metrics
+    private long _commandsQueued;
+    private long _framesWritten;
+    private long _failedFrames;
+    private double _lastLatencyMs;
+    private double _averageLatencyMs;
+    private double _maxLatencyMs;
+
+    /// <summary>
+    /// How long the worker waits after the first pending change for more to merge.
+    /// </summary>
+    private const int CoalesceWindowMs = 20;
+
+    /// <summary>
+    /// Weight of each frame in the average command latency.
+    /// </summary>
+    private const double LatencySmoothing = 0.2;
+
+    /// <param name="boardId">Board identifier, for logs.</param>
+    /// <param name="resolveBoard">
+    /// Returns the connected board at write time (reconnecting if needed), or null if unavailable.
+    /// Called on the worker thread, so reconnection never blocks the caller either.
+    /// </param>
+    /// <param name="logger">Optional logger instance.</param>
+    public RelayCommandQueue(string boardId, Func<IRelayBoard?> resolveBoard, ILogger? logger = null)
+    {
+        _boardId = boardId;
+        _resolveBoard = resolveBoard;
+        _logger = logger;
+        _worker = Task.Run(() => RunAsync(_cts.Token));
+    }
+
+    /// <summary>
+    /// Channel changes waiting to be written.
+    /// </summary>
+    public int QueueDepth
+    {
+        get
+        {
+            lock (_lock)
+            {
+                return BitOperations.PopCount((uint)_pendingMask);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Queue a channel change. Returns immediately; the task completes with the result of the
+    /// frame that carried the change.
+    /// </summary>
+    public Task<bool> Enqueue(int channel, bool on)
+    {
+        if (channel < 1 || channel > 16)
+            return Task.FromResult(false);
+
+        var tcs = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+        var bit = 1 << (channel - 1);
+
+        lock (_lock)
+        {
+            if (_cts.IsCancellationRequested)
+                return Task.FromResult(false);
+
+            if (_pendingMask == 0)
+            {
+                _oldestPendingTimestamp = Stopwatch.GetTimestamp();
+            }
+
+            _pendingMask |= bit;
+            _pendingValues = on ? _pendingValues | bit : _pendingValues & ~bit;
+            _pendingWaiters.Add(tcs);
+            _commandsQueued++;
+        }
+
+        _signal.Release();
+        return tcs.Task;
+    }
+
+    /// <summary>
+    /// Snapshot of queue depth and command latency.
+    /// </summary>
+    public RelayCommandQueueStats GetStats()
+    {
+        lock (_lock)
+        {
+            return new RelayCommandQueueStats(
+                QueueDepth: BitOperations.PopCount((uint)_pendingMask),
+                CommandsQueued: _commandsQueued,
+                FramesWritten: _framesWritten,
+                FailedFrames: _failedFrames,
+                LastLatencyMs: Math.Round(_lastLatencyMs, 1),
+                AverageLatencyMs: Math.Round(_averageLatencyMs, 1),
+                MaxLatencyMs: Math.Round(_maxLatencyMs, 1));
+        }
+    }
+
+    private async Task RunAsync(CancellationToken ct)
+    {
+        while (!ct.IsCancellationRequested)
+        {
+            try
+            {
+                await _signal.WaitAsync(ct);
+
+                // Let changes from the same player event (or grouped start) arrive
+                await Task.Delay(CoalesceWindowMs, ct);
+            }
+            catch (OperationCanceledException)
+            {
+                break;
+            }
+
+            // Drain the signals of the changes merged into this frame; a change queued
+            // after this point signals again and is written by the next iteration
+            while (_signal.CurrentCount > 0 && _signal.Wait(0))
+            {
+            }
+
+            int mask, values;
+            long queuedAt;
+            List<TaskCompletionSource<bool>> waiters;
+            lock (_lock)
+            {
+                mask = _pendingMask;
+                values = _pendingValues;
+                queuedAt = _oldestPendingTimestamp;
+                waiters = _pendingWaiters;
+
+                _pendingMask = 0;
+                _pendingValues = 0;
+                _pendingWaiters = new List<TaskCompletionSource<bool>>();
+            }
+
+            if (mask == 0)
+                continue;
+
+            var success = WriteFrame(mask, values);
+            var latencyMs = Stopwatch.GetElapsedTime(queuedAt).TotalMilliseconds;
+
+            lock (_lock)
+            {
+                _framesWritten++;
+                if (!success)
+                    _failedFrames++;
+                _lastLatencyMs = latencyMs;
+                _averageLatencyMs = _framesWritten == 1
+                    ? latencyMs
+                    : _averageLatencyMs + (latencyMs - _averageLatencyMs) * LatencySmoothing;
+                _maxLatencyMs = Math.Max(_maxLatencyMs, latencyMs);
+            }
+
+            if (waiters.Count > 1)
+            {
+                _logger?.LogDebug(
+                    "Relay board '{BoardId}': {Count} changes merged into one frame (mask 0x{Mask:X4}, values 0x{Values:X4}) in {Latency:F0}ms",
+                    _boardId, waiters.Count, mask, values, latencyMs);
+            }
+
+            foreach (var waiter in waiters)
+            {
+                waiter.TrySetResult(success);
+            }
+        }
+
+        // Fail anything still queued at shutdown
+        List<TaskCompletionSource<bool>> remaining;
+        lock (_lock)
+        {
+            remaining = _pendingWaiters;
+            _pendingWaiters = new List<TaskCompletionSource<bool>>();
+            _pendingMask = 0;
+        }
+
+        foreach (var waiter in remaining)
+        {
+            waiter.TrySetResult(false);
+        }
+    }
+
+    private bool WriteFrame(int mask, int values)
+    {
+        try
+        {
+            var board = _resolveBoard();
+            if (board == null || !board.IsConnected)
+            {
+                _logger?.LogWarning("Relay board '{BoardId}' not connected - dropped change (mask 0x{Mask:X4})",
+                    _boardId, mask);
+                return false;
+            }
+
+            return board.SetRelays(mask, values);
+        }
+        catch (Exception ex)
+        {
+            _logger?.LogError(ex, "Relay board '{BoardId}' write failed (mask 0x{Mask:X4})", _boardId, mask);
+            return false;
+        }
+    }
+
+    public void Dispose()
+    {
+        lock (_lock)
+        {
+            if (_cts.IsCancellationRequested)
+                return;
+
+            _cts.Cancel();
+        }
+
+        try
+        {
+            _worker.Wait(TimeSpan.FromSeconds(2));
+        }
+        catch (AggregateException)
+        {
+            // Worker exits via cancellation
+        }
+
+        _cts.Dispose();
+    }
+}
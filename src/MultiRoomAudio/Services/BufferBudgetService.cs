@@ -0,0 +1,338 @@
+using System.Collections.Concurrent;
+using MultiRoomAudio.Models;
+using Sendspin.SDK.Models;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Sizes each player's local PCM buffer (TimedAudioBuffer) from the server lead and
+/// jitter it actually sees, within a global memory budget shared by all players.
+/// </summary>
+/// <remarks>
+/// <para>
+/// The buffer must hold everything the server sends ahead of play time. That lead shows
+/// up as the buffer level while playing, so we track a decaying peak of BufferedMs plus
+/// its mean absolute deviation (jitter). Capacity = peak + 4×jitter + 1s margin, clamped
+/// to 2-8 seconds. Until enough observations exist a player gets the full 8 seconds.
+/// </para>
+/// <para>
+/// When the players' desired capacities exceed the budget, every player is scaled down
+/// proportionally (never below the minimum). Capacity is applied when the pipeline creates
+/// its buffer, i.e. at each stream start, so a rebalance reaches existing players on their
+/// next stream.
+/// </para>
+/// <para>
+/// Capacity is the only lever: the buffer stores decoded float32 samples whatever the source
+/// bit depth, and that storage belongs to the SDK's TimedAudioBuffer. Keeping 16/24-bit
+/// samples packed (or compressed frames decoded just ahead of the read cursor) would need a
+/// buffer in the SDK that does so; until then the budget is charged at 4 bytes per sample.
+/// </para>
+/// </remarks>
+public class BufferBudgetService
+{
+    /// <summary>
+    /// Smallest buffer we will ever allocate. Covers MA's typical 1-2s lead with margin.
+    /// </summary>
+    private const int MinCapacityMs = 2000;
+
+    /// <summary>
+    /// Largest buffer we allocate (the previous fixed capacity for every player).
+    /// </summary>
+    private const int MaxCapacityMs = 8000;
+
+    /// <summary>
+    /// Headroom above the observed peak + jitter.
+    /// </summary>
+    private const int SafetyMarginMs = 1000;
+
+    /// <summary>
+    /// Jitter multiplier - 4 deviations keeps bursts from overflowing the buffer.
+    /// </summary>
+    private const double JitterMultiplier = 4.0;
+
+    /// <summary>
+    /// Observations required before sizing from measurements (~10s of playback at 500ms).
+    /// </summary>
+    private const int MinObservations = 20;
+
+    /// <summary>
+    /// EWMA factor for the mean buffer level and jitter.
+    /// </summary>
+    private const double EwmaAlpha = 0.05;
+
+    /// <summary>
+    /// Per-observation decay of the peak so a one-off spike is forgotten after a few minutes.
+    /// </summary>
+    private const double PeakDecay = 0.998;
+
+    private readonly ILogger<BufferBudgetService> _logger;
+    private readonly long _budgetBytes;
+    private readonly ConcurrentDictionary<string, PlayerBudget> _players = new();
+    private volatile bool _isConstrained;
+
+    /// <summary>
+    /// Sizing state for one player. Fields are guarded by <see cref="Lock"/>.
+    /// </summary>
+    private sealed class PlayerBudget
+    {
+        public readonly object Lock = new();
+        public AudioFormat? Format;
+        public int CapacityMs = MaxCapacityMs;
+        public long CapacityBytes;
+        public int AdvertisedCapacityBytes;
+        public double MeanBufferedMs;
+        public double JitterMs;
+        public double PeakBufferedMs;
+        public long Observations;
+    }
+
+    public BufferBudgetService(ILogger<BufferBudgetService> logger, EnvironmentService environment)
+    {
+        _logger = logger;
+        _budgetBytes = environment.BufferMemoryBudgetMb * 1024L * 1024L;
+        _logger.LogDebug("Buffer memory budget: {Budget}MB", environment.BufferMemoryBudgetMb);
+    }
+
+    /// <summary>
+    /// Allocates the local buffer capacity for a player's new stream.
+    /// Called from the pipeline's buffer factory.
+    /// </summary>
+    /// <param name="playerName">Player name.</param>
+    /// <param name="format">Decoded stream format (buffer stores float32 at this rate/channels).</param>
+    /// <returns>Buffer capacity in milliseconds.</returns>
+    public int AllocateCapacityMs(string playerName, AudioFormat format)
+    {
+        var budget = _players.GetOrAdd(playerName, _ => new PlayerBudget());
+
+        int desiredMs;
+        lock (budget.Lock)
+        {
+            budget.Format = format;
+            desiredMs = GetDesiredCapacityMs(budget);
+        }
+
+        var scale = GetBudgetScale(playerName, BytesFor(desiredMs, format));
+        var capacityMs = Math.Max(MinCapacityMs, (int)(desiredMs * scale));
+
+        lock (budget.Lock)
+        {
+            budget.CapacityMs = capacityMs;
+            budget.CapacityBytes = BytesFor(capacityMs, format);
+        }
+
+        if (scale < 1.0)
+        {
+            _logger.LogInformation(
+                "Player '{Name}': buffer {Capacity}ms (wanted {Desired}ms, scaled to fit {Budget}MB budget)",
+                playerName, capacityMs, desiredMs, _budgetBytes / (1024 * 1024));
+        }
+        else
+        {
+            _logger.LogDebug("Player '{Name}': buffer {Capacity}ms for {Rate}Hz {Channels}ch",
+                playerName, capacityMs, format.SampleRate, format.Channels);
+        }
+
+        return capacityMs;
+    }
+
+    /// <summary>
+    /// Gets the buffer capacity (bytes of compressed audio) to advertise in client/hello.
+    /// </summary>
+    /// <remarks>
+    /// Deliberately not tied to the learned local capacity: the server's lead is what the local
+    /// sizing learns from, so advertising less would throttle the lead, shrink the learned
+    /// capacity and shrink the advertisement again. It is also sent only once, at hello, so no
+    /// rebalance could reach it. The bytes hold <see cref="MaxCapacityMs"/> of the least
+    /// compressible advertised format at its uncompressed rate, which no codec exceeds, so the
+    /// server is never held to less lead than the largest local buffer.
+    /// </remarks>
+    /// <param name="playerName">Player name.</param>
+    /// <param name="formats">Formats advertised in client/hello.</param>
+    public int GetAdvertisedCapacityBytes(string playerName, IReadOnlyList<AudioFormat> formats)
+    {
+        if (formats.Count == 0)
+            throw new ArgumentException("At least one format must be advertised", nameof(formats));
+
+        var bytesPerSecond = formats.Max(GetUncompressedBytesPerSecond);
+        var bytes = (int)Math.Min(int.MaxValue, MaxCapacityMs / 1000.0 * bytesPerSecond);
+
+        var budget = _players.GetOrAdd(playerName, _ => new PlayerBudget());
+        lock (budget.Lock)
+        {
+            budget.AdvertisedCapacityBytes = bytes;
+        }
+
+        return bytes;
+    }
+
+    /// <summary>
+    /// Gets how far ahead of play time the server has been seen to send (the decaying peak of
+    /// the buffer level), or null until enough observations exist.
+    /// </summary>
+    /// <remarks>
+    /// A start cannot be held for longer than this: the buffer never gets further ahead.
+    /// </remarks>
+    public int? GetObservedLeadMs(string playerName)
+    {
+        if (!_players.TryGetValue(playerName, out var budget))
+            return null;
+
+        lock (budget.Lock)
+        {
+            return budget.Observations >= MinObservations ? (int)budget.PeakBufferedMs : null;
+        }
+    }
+
+    /// <summary>
+    /// Records a buffer level observation while the player is playing.
+    /// </summary>
+    public void RecordBufferLevel(string playerName, int bufferedMs)
+    {
+        if (!_players.TryGetValue(playerName, out var budget))
+            return;
+
+        lock (budget.Lock)
+        {
+            if (budget.Observations == 0)
+            {
+                budget.MeanBufferedMs = bufferedMs;
+            }
+            else
+            {
+                var deviation = Math.Abs(bufferedMs - budget.MeanBufferedMs);
+                budget.JitterMs += EwmaAlpha * (deviation - budget.JitterMs);
+                budget.MeanBufferedMs += EwmaAlpha * (bufferedMs - budget.MeanBufferedMs);
+            }
+
+            budget.PeakBufferedMs = Math.Max(bufferedMs, budget.PeakBufferedMs * PeakDecay);
+            budget.Observations++;
+        }
+    }
+
+    /// <summary>
+    /// Releases a player's allocation (player stopped or removed).
+    /// </summary>
+    public void Release(string playerName)
+    {
+        _players.TryRemove(playerName, out _);
+    }
+
+    /// <summary>
+    /// Gets the bytes currently allocated to a player's buffer (0 if none).
+    /// </summary>
+    public long GetAllocatedBytes(string playerName)
+    {
+        if (!_players.TryGetValue(playerName, out var budget))
+            return 0;
+
+        lock (budget.Lock)
+        {
+            return budget.CapacityBytes;
+        }
+    }
+
+    /// <summary>
+    /// Gets the budget overview for the /api/memory endpoint.
+    /// </summary>
+    public MemoryBudgetResponse GetSnapshot()
+    {
+        var players = new List<PlayerBufferAllocation>();
+        long allocated = 0;
+        long fixedAllocation = 0;
+
+        foreach (var (name, budget) in _players.OrderBy(p => p.Key))
+        {
+            lock (budget.Lock)
+            {
+                var format = budget.Format;
+                allocated += budget.CapacityBytes;
+                if (format != null)
+                    fixedAllocation += BytesFor(MaxCapacityMs, format);
+
+                players.Add(new PlayerBufferAllocation(
+                    PlayerName: name,
+                    Format: format != null
+                        ? $"{format.Codec.ToUpperInvariant()} {format.SampleRate}Hz {format.Channels}ch"
+                        : null,
+                    CapacityMs: budget.CapacityMs,
+                    CapacityBytes: budget.CapacityBytes,
+                    DesiredCapacityMs: GetDesiredCapacityMs(budget),
+                    JitterMs: Math.Round(budget.JitterMs, 1),
+                    PeakBufferedMs: Math.Round(budget.PeakBufferedMs, 1),
+                    Observations: budget.Observations,
+                    AdvertisedCapacityBytes: budget.AdvertisedCapacityBytes));
+            }
+        }
+
+        return new MemoryBudgetResponse(
+            BudgetBytes: _budgetBytes,
+            AllocatedBytes: allocated,
+            FixedAllocationBytes: fixedAllocation,
+            SavedBytes: Math.Max(0, fixedAllocation - allocated),
+            IsBudgetConstrained: _isConstrained,
+            ProcessRssBytes: Environment.WorkingSet,
+            ManagedHeapBytes: GC.GetTotalMemory(forceFullCollection: false),
+            Players: players);
+    }
+
+    /// <summary>
+    /// Desired capacity from observations. Must be called under the budget's lock.
+    /// </summary>
+    private static int GetDesiredCapacityMs(PlayerBudget budget)
+    {
+        if (budget.Observations < MinObservations)
+            return MaxCapacityMs;
+
+        var desired = budget.PeakBufferedMs + JitterMultiplier * budget.JitterMs + SafetyMarginMs;
+        return Math.Clamp((int)Math.Ceiling(desired), MinCapacityMs, MaxCapacityMs);
+    }
+
+    /// <summary>
+    /// Computes the scale factor (≤ 1) that fits all players' desired buffers in the budget.
+    /// </summary>
+    private double GetBudgetScale(string playerName, long requestedBytes)
+    {
+        long totalDesired = requestedBytes;
+        foreach (var (name, budget) in _players)
+        {
+            if (name == playerName)
+                continue;
+
+            lock (budget.Lock)
+            {
+                if (budget.Format != null)
+                    totalDesired += BytesFor(GetDesiredCapacityMs(budget), budget.Format);
+            }
+        }
+
+        var constrained = totalDesired > _budgetBytes;
+        if (constrained != _isConstrained)
+        {
+            _isConstrained = constrained;
+            _logger.LogInformation(
+                constrained
+                    ? "Buffer memory budget exceeded ({Desired}MB wanted, {Budget}MB budget) - rebalancing players"
+                    : "Buffer memory back within budget ({Desired}MB wanted, {Budget}MB budget)",
+                totalDesired / (1024 * 1024), _budgetBytes / (1024 * 1024));
+        }
+
+        return constrained ? (double)_budgetBytes / totalDesired : 1.0;
+    }
+
+    /// <summary>
+    /// Bytes of float32 PCM for a duration at a format (what TimedAudioBuffer stores).
+    /// </summary>
+    private static long BytesFor(int ms, AudioFormat format)
+    {
+        return (long)ms * format.SampleRate / 1000 * format.Channels * sizeof(float);
+    }
+
+    /// <summary>
+    /// Bytes per second of the format's PCM at its source bit depth (16-bit if unspecified).
+    /// </summary>
+    private static double GetUncompressedBytesPerSecond(AudioFormat format)
+    {
+        return (double)format.SampleRate * format.Channels *
+            (format.BitDepth is int bitDepth && bitDepth > 0 ? bitDepth / 8 : 2);
+    }
+}
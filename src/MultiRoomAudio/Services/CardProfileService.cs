@@ -115,80 +115,98 @@ public class CardProfileService
             }
         }
 
+        await RestoreCardStateAsync(cards, migratedProfiles);
+    }
+
+    #region Bulk Restore
+
+    /// <summary>
+    /// Restores saved profiles, boot mutes and device volume limits for all cards at once.
+    /// </summary>
+    /// <remarks>
+    /// Desired state is computed for every card and diffed against the current state, so
+    /// only real changes reach PulseAudio. Changes are issued concurrently over one native
+    /// connection (<see cref="PulseAudioControlSession"/>) instead of one pactl process per
+    /// setting per card. Profiles are applied first because switching a profile recreates
+    /// the card's sinks; sink state is then read once and mute/volume changes follow.
+    /// </remarks>
+    private async Task RestoreCardStateAsync(
+        List<PulseAudioCard> cards,
+        Dictionary<string, CardProfileConfiguration> savedProfiles)
+    {
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+        using var session = OpenControlSession();
+
         var restoredCount = 0;
         var failedCount = 0;
+        var unchangedCount = 0;
+        var restoredCards = new List<(PulseAudioCard Card, CardProfileConfiguration Config)>();
+        var profileChanges = new List<(PulseAudioCard Card, CardProfileConfiguration Config)>();
 
-        // Now restore profiles for each current card
+        // 1. Profiles: diff saved vs active
         foreach (var card in cards)
         {
             var stableKey = ConfigurationService.GenerateCardKey(card);
-
-            if (!migratedProfiles.TryGetValue(stableKey, out var config))
+            if (!savedProfiles.TryGetValue(stableKey, out var config))
             {
                 // No saved config for this card
                 continue;
             }
 
-            try
+            if (card.ActiveProfile.Equals(config.ProfileName, StringComparison.OrdinalIgnoreCase))
             {
-                // Check if already at the desired profile
-                if (card.ActiveProfile.Equals(config.ProfileName, StringComparison.OrdinalIgnoreCase))
-                {
-                    _logger.LogDebug(
-                        "Card '{CardName}' already at profile '{Profile}'",
-                        card.Name, config.ProfileName);
-                    restoredCount++;
-                    await ApplyBootMutePreferenceAsync(card, defaultUnmute: false, logBootAction: true);
-                    continue;
-                }
+                _logger.LogDebug(
+                    "Card '{CardName}' already at profile '{Profile}'",
+                    card.Name, config.ProfileName);
+                restoredCount++;
+                unchangedCount++;
+                restoredCards.Add((card, config));
+                continue;
+            }
 
-                // Verify profile exists and is available
-                var profile = card.Profiles.FirstOrDefault(p =>
-                    p.Name.Equals(config.ProfileName, StringComparison.OrdinalIgnoreCase));
+            // Verify profile exists and is available
+            var profile = card.Profiles.FirstOrDefault(p =>
+                p.Name.Equals(config.ProfileName, StringComparison.OrdinalIgnoreCase));
 
-                if (profile == null)
-                {
-                    _logger.LogWarning(
-                        "Saved profile '{Profile}' for card '{CardName}' not found",
-                        config.ProfileName, card.Name);
-                    failedCount++;
-                    continue;
-                }
+            if (profile == null)
+            {
+                _logger.LogWarning(
+                    "Saved profile '{Profile}' for card '{CardName}' not found",
+                    config.ProfileName, card.Name);
+                failedCount++;
+                continue;
+            }
 
-                if (!profile.IsAvailable)
-                {
-                    _logger.LogWarning(
-                        "Saved profile '{Profile}' for card '{CardName}' is not available",
-                        config.ProfileName, card.Name);
-                    failedCount++;
-                    continue;
-                }
+            if (!profile.IsAvailable)
+            {
+                _logger.LogWarning(
+                    "Saved profile '{Profile}' for card '{CardName}' is not available",
+                    config.ProfileName, card.Name);
+                failedCount++;
+                continue;
+            }
 
-                // Apply the profile
-                var success = _environment.IsMockHardware
-                    ? MockCardEnumerator.SetCardProfile(card.Name, config.ProfileName, out var error)
-                    : PulseAudioCardEnumerator.SetCardProfile(card.Name, config.ProfileName, out error);
+            profileChanges.Add((card, config));
+        }
 
-                if (success)
-                {
-                    _logger.LogInformation(
-                        "Restored card '{CardName}' to profile '{Profile}'",
-                        card.Name, config.ProfileName);
-                    restoredCount++;
-                    await ApplyBootMutePreferenceAsync(card, defaultUnmute: false, logBootAction: true);
-                }
-                else
-                {
-                    _logger.LogWarning(
-                        "Failed to restore profile '{Profile}' for card '{CardName}': {Error}",
-                        config.ProfileName, card.Name, error);
-                    failedCount++;
-                }
+        var profileResults = await Task.WhenAll(profileChanges.Select(async change =>
+            (change.Card, change.Config, Success: await ApplyProfileAsync(session, change.Card, change.Config.ProfileName))));
+
+        foreach (var (card, config, success) in profileResults)
+        {
+            if (success)
+            {
+                _logger.LogInformation(
+                    "Restored card '{CardName}' to profile '{Profile}'",
+                    card.Name, config.ProfileName);
+                restoredCount++;
+                restoredCards.Add((card, config));
             }
-            catch (Exception ex)
+            else
             {
-                _logger.LogError(ex,
-                    "Exception restoring profile for card '{CardName}'", card.Name);
+                _logger.LogWarning(
+                    "Failed to restore profile '{Profile}' for card '{CardName}'",
+                    config.ProfileName, card.Name);
                 failedCount++;
             }
         }
@@ -197,12 +215,207 @@ public class CardProfileService
             "CardProfileService started: {Restored} profiles restored, {Failed} failed",
             restoredCount, failedCount);
 
-        // Apply saved device volume limits after profile restoration
-        await ApplyDeviceVolumeLimitsAsync();
+        // 2. One sink enumeration, after profile switches have recreated sinks
+        var sinkStates = GetSinkControlStates();
+        var settingChanges = new List<Task<bool>>();
+        var bootMutes = new List<(string Card, bool Muted, Task<bool>[] Changes)>();
+
+        // 3. Boot mutes for restored cards (outcome logged once the changes complete)
+        foreach (var (card, config) in restoredCards)
+        {
+            if (config.BootMuted is not bool desiredMuted)
+                continue;
 
-        await Task.CompletedTask;
+            var cardSinks = GetSinksForCard(card, sinkStates);
+            if (cardSinks.Count == 0)
+                continue;
+
+            var toChange = cardSinks.Where(sink => sink.Muted != desiredMuted).ToList();
+            unchangedCount += cardSinks.Count - toChange.Count;
+            var muteChanges = toChange.Select(sink => ApplyMuteAsync(session, sink.Name, desiredMuted)).ToArray();
+            settingChanges.AddRange(muteChanges);
+            bootMutes.Add((GetCardDisplayName(card), desiredMuted, muteChanges));
+        }
+
+        // 4. Device volume limits
+        settingChanges.AddRange(PlanDeviceVolumeLimits(session, sinkStates, ref unchangedCount));
+
+        var settingResults = await Task.WhenAll(settingChanges);
+        var settingFailures = settingResults.Count(ok => !ok);
+
+        foreach (var (displayName, desiredMuted, muteChanges) in bootMutes)
+        {
+            var desiredLabel = desiredMuted ? "muted" : "unmuted";
+            var muteFailures = muteChanges.Count(change => !change.Result);
+            if (muteChanges.Length == 0)
+            {
+                _logger.LogInformation("Boot mute applied for card '{Card}': already {State}", displayName, desiredLabel);
+            }
+            else if (muteFailures == 0)
+            {
+                _logger.LogInformation(
+                    "Boot mute applied for card '{Card}': changed from {Previous} to {State}",
+                    displayName, desiredMuted ? "unmuted" : "muted", desiredLabel);
+            }
+            else
+            {
+                _logger.LogWarning(
+                    "Boot mute failed for card '{Card}': {Failed} of {Total} sinks could not be {State}",
+                    displayName, muteFailures, muteChanges.Length, desiredLabel);
+            }
+        }
+
+        stopwatch.Stop();
+        _logger.LogInformation(
+            "Card state restore: {Changes} changes applied ({Failed} failed), {Unchanged} already correct, in {Elapsed}ms",
+            profileChanges.Count + settingResults.Length,
+            profileResults.Count(r => !r.Success) + settingFailures,
+            unchangedCount,
+            stopwatch.ElapsedMilliseconds);
     }
 
+    /// <summary>
+    /// Builds volume-limit changes for devices whose current volume differs from the saved limit.
+    /// </summary>
+    private List<Task<bool>> PlanDeviceVolumeLimits(
+        PulseAudioControlSession? session,
+        Dictionary<string, SinkControlState> sinkStates,
+        ref int unchangedCount)
+    {
+        var changes = new List<Task<bool>>();
+
+        try
+        {
+            var deviceConfigs = _config.GetAllDeviceConfigurations();
+            if (deviceConfigs.Count == 0)
+            {
+                _logger.LogDebug("No device configurations with volume limits found");
+                return changes;
+            }
+
+            foreach (var device in _backend.GetOutputDevices())
+            {
+                var deviceKey = ConfigurationService.GenerateDeviceKey(device);
+                if (!deviceConfigs.TryGetValue(deviceKey, out var config) || config.MaxVolume is not int maxVolume)
+                    continue;
+
+                sinkStates.TryGetValue(device.Id, out var state);
+                if (state?.VolumePercent == maxVolume)
+                {
+                    unchangedCount++;
+                    continue;
+                }
+
+                var channels = state?.Channels ?? device.MaxChannels;
+                var name = device.Name;
+                changes.Add(ApplyVolumeAsync(session, device.Id, channels, maxVolume).ContinueWith(t =>
+                {
+                    var ok = t.IsCompletedSuccessfully && t.Result;
+                    if (ok)
+                        _logger.LogInformation("Applied volume limit {Volume}% to device '{Device}'", maxVolume, name);
+                    else
+                        _logger.LogWarning("Failed to apply volume limit for device '{Device}'", name);
+                    return ok;
+                }, TaskScheduler.Default));
+            }
+        }
+        catch (Exception ex)
+        {
+            _logger.LogError(ex, "Error applying device volume limits at startup");
+        }
+
+        return changes;
+    }
+
+    /// <summary>
+    /// Opens a native control connection, or returns null to fall back to pactl (mock mode or PA unreachable).
+    /// </summary>
+    private PulseAudioControlSession? OpenControlSession()
+    {
+        if (_environment.IsMockHardware)
+            return null;
+
+        try
+        {
+            return PulseAudioControlSession.Open(_logger);
+        }
+        catch (Exception ex)
+        {
+            _logger.LogDebug(ex, "Native PulseAudio control unavailable, using pactl for card restore");
+            return null;
+        }
+    }
+
+    private Dictionary<string, SinkControlState> GetSinkControlStates()
+    {
+        if (!_environment.IsMockHardware)
+            return PulseAudioCardEnumerator.GetSinkControlStates();
+
+        // Mock hardware has no volume readback - limits are always re-applied
+        return MockCardEnumerator.GetSinksMuteStates()
+            .ToDictionary(
+                kv => kv.Key,
+                kv => new SinkControlState(kv.Key, kv.Value, null, 2),
+                StringComparer.OrdinalIgnoreCase);
+    }
+
+    private List<SinkControlState> GetSinksForCard(PulseAudioCard card, Dictionary<string, SinkControlState> sinkStates)
+    {
+        if (_environment.IsMockHardware)
+        {
+            return MockCardEnumerator.GetSinksByCard(card.Name)
+                .Select(name => sinkStates.TryGetValue(name, out var state) ? state : new SinkControlState(name, false, null, 2))
+                .ToList();
+        }
+
+        return sinkStates.Values
+            .Where(state => PulseAudioCardEnumerator.SinkBelongsToCard(card.Name, state.Name))
+            .ToList();
+    }
+
+    private Task<bool> ApplyProfileAsync(PulseAudioControlSession? session, PulseAudioCard card, string profileName)
+    {
+        if (session != null)
+            return session.SetCardProfileAsync(card.Name, profileName);
+
+        var success = _environment.IsMockHardware
+            ? MockCardEnumerator.SetCardProfile(card.Name, profileName, out var error)
+            : PulseAudioCardEnumerator.SetCardProfile(card.Name, profileName, out error);
+        if (!success)
+            _logger.LogDebug("Set profile '{Profile}' on '{Card}' failed: {Error}", profileName, card.Name, error);
+        return Task.FromResult(success);
+    }
+
+    private async Task<bool> ApplyMuteAsync(PulseAudioControlSession? session, string sinkName, bool muted)
+    {
+        try
+        {
+            var success = session != null
+                ? await session.SetSinkMuteAsync(sinkName, muted)
+                : _environment.IsMockHardware
+                    ? MockCardEnumerator.SetMuteBySink(sinkName, muted)
+                    : await _volumeRunner.SetMuteAsync(sinkName, muted);
+
+            if (success)
+                _logger.LogDebug("Set sink '{Sink}' mute to {Muted} after profile restore", sinkName, muted);
+            return success;
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "Failed to set mute for sink '{Sink}' after profile restore", sinkName);
+            return false;
+        }
+    }
+
+    private Task<bool> ApplyVolumeAsync(PulseAudioControlSession? session, string sinkName, int channels, int volume)
+    {
+        return session != null
+            ? session.SetSinkVolumeAsync(sinkName, channels, volume)
+            : _backend.SetVolumeAsync(sinkName, volume, CancellationToken.None);
+    }
+
+    #endregion
+
     /// <summary>
     /// Gets all available sound cards with their profiles.
     /// Also tracks any new cards for persistence (handles hot-plug).
@@ -1070,6 +1283,7 @@ public class CardProfileService
             ? MockCardEnumerator.GetSinksByCard(card.Name)
             : PulseAudioCardEnumerator.GetSinksByCard(card.Name);
         var previousState = logBootAction ? GetCardMuteState(card) : null;
+        var failedCount = 0;
         foreach (var sinkName in sinks)
         {
             try
@@ -1079,10 +1293,15 @@ public class CardProfileService
                 {
                     _logger.LogDebug("Set sink '{Sink}' mute to {Muted} after profile restore", sinkName, desiredMuted);
                 }
+                else
+                {
+                    failedCount++;
+                }
             }
             catch (Exception ex)
             {
                 _logger.LogWarning(ex, "Failed to set mute for sink '{Sink}' after profile restore", sinkName);
+                failedCount++;
             }
         }
 
@@ -1090,7 +1309,16 @@ public class CardProfileService
         {
             var displayName = GetCardDisplayName(card);
             var desiredLabel = desiredMuted ? "muted" : "unmuted";
-            if (previousState.HasValue)
+            if (failedCount > 0)
+            {
+                _logger.LogWarning(
+                    "Boot mute failed for card '{Card}': {Failed} of {Total} sinks could not be {State}",
+                    displayName,
+                    failedCount,
+                    sinks.Count,
+                    desiredLabel);
+            }
+            else if (previousState.HasValue)
             {
                 var previousLabel = previousState.Value ? "muted" : "unmuted";
                 if (previousState.Value == desiredMuted)
@@ -1123,73 +1351,4 @@ public class CardProfileService
     {
         return string.IsNullOrWhiteSpace(card.Description) ? card.Name : card.Description;
     }
-
-    /// <summary>
-    /// Applies saved device volume limits from configuration.
-    /// Called at startup after card profiles are restored.
-    /// </summary>
-    private async Task ApplyDeviceVolumeLimitsAsync()
-    {
-        try
-        {
-            // Get all devices from backend
-            var devices = _backend.GetOutputDevices();
-            if (!devices.Any())
-            {
-                _logger.LogDebug("No devices found for volume limit application");
-                return;
-            }
-
-            // Get all device configurations
-            var deviceConfigs = _config.GetAllDeviceConfigurations();
-            if (deviceConfigs.Count == 0)
-            {
-                _logger.LogDebug("No device configurations with volume limits found");
-                return;
-            }
-
-            var appliedCount = 0;
-            var failedCount = 0;
-
-            foreach (var device in devices)
-            {
-                try
-                {
-                    // Generate device key to look up configuration
-                    var deviceKey = ConfigurationService.GenerateDeviceKey(device);
-                    if (!deviceConfigs.TryGetValue(deviceKey, out var config))
-                    {
-                        continue;
-                    }
-
-                    // Apply max volume if configured
-                    if (config.MaxVolume.HasValue)
-                    {
-                        await _backend.SetVolumeAsync(device.Id, config.MaxVolume.Value, CancellationToken.None);
-                        _logger.LogInformation(
-                            "Applied volume limit {Volume}% to device '{Device}'",
-                            config.MaxVolume.Value,
-                            device.Name);
-                        appliedCount++;
-                    }
-                }
-                catch (Exception ex)
-                {
-                    _logger.LogWarning(ex, "Failed to apply volume limit for device '{Device}'", device.Name);
-                    failedCount++;
-                }
-            }
-
-            if (appliedCount > 0 || failedCount > 0)
-            {
-                _logger.LogInformation(
-                    "Device volume limits applied: {Applied} succeeded, {Failed} failed",
-                    appliedCount, failedCount);
-            }
-        }
-        catch (Exception ex)
-        {
-            _logger.LogError(ex, "Error applying device volume limits at startup");
-        }
-    }
 }
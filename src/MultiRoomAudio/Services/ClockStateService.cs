@@ -0,0 +1,259 @@
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Learned clock and latency state persisted to YAML so players can warm start after a restart.
+/// </summary>
+public class ClockStateData
+{
+    /// <summary>
+    /// Clock drift learned per Sendspin server. Key: server address (host:port).
+    /// </summary>
+    public Dictionary<string, ServerClockState> Servers { get; set; } = new();
+
+    /// <summary>
+    /// Locked output latency learned per audio sink. Key: sink name.
+    /// </summary>
+    public Dictionary<string, DeviceLatencyState> Devices { get; set; } = new();
+}
+
+/// <summary>
+/// Clock drift of this host against a specific server, as learned by the Kalman filter.
+/// </summary>
+public class ServerClockState
+{
+    /// <summary>
+    /// Drift rate in parts per million (μs/s) once the filter reported it as reliable.
+    /// </summary>
+    public double DriftPpm { get; set; }
+
+    /// <summary>
+    /// Offset uncertainty in milliseconds at the time the drift was recorded.
+    /// </summary>
+    public double UncertaintyMs { get; set; }
+
+    /// <summary>
+    /// Number of measurements the filter had taken when the drift was recorded.
+    /// </summary>
+    public int MeasurementCount { get; set; }
+
+    /// <summary>
+    /// When the drift was last recorded.
+    /// </summary>
+    public DateTime UpdatedAt { get; set; }
+
+    /// <summary>
+    /// Most recent time from playback request to first in-sync audio without persisted state.
+    /// </summary>
+    public int? LastColdStartSyncMs { get; set; }
+
+    /// <summary>
+    /// Most recent time from playback request to first in-sync audio with persisted state.
+    /// </summary>
+    public int? LastWarmStartSyncMs { get; set; }
+}
+
+/// <summary>
+/// Output latency lock of a specific audio sink.
+/// </summary>
+public class DeviceLatencyState
+{
+    /// <summary>
+    /// Latency the PulseAudio stream locked to, in milliseconds.
+    /// </summary>
+    public int LockedLatencyMs { get; set; }
+
+    /// <summary>
+    /// When the latency was last recorded.
+    /// </summary>
+    public DateTime UpdatedAt { get; set; }
+}
+
+/// <summary>
+/// Persists learned clock drift (per server) and output latency locks (per sink) to
+/// clock-state.yaml so that players started after a container restart can skip part of
+/// the learning phase.
+/// </summary>
+/// <remarks>
+/// A host's crystal drift against the server is stable over days, and a sink's latency
+/// only changes when the hardware or PulseAudio configuration changes. Entries older than
+/// <see cref="MaxStateAge"/> are ignored so stale values never seed a player.
+/// </remarks>
+public class ClockStateService : YamlFileService<ClockStateData>
+{
+    /// <summary>
+    /// Maximum age of a persisted entry before it is treated as a cold start.
+    /// </summary>
+    private static readonly TimeSpan MaxStateAge = TimeSpan.FromDays(7);
+
+    /// <summary>
+    /// Drift change (ppm) between runs above which we log that the persisted value was off.
+    /// </summary>
+    private const double DriftMismatchWarningPpm = 5.0;
+
+    public ClockStateService(
+        ILogger<ClockStateService> logger,
+        EnvironmentService environment)
+        : base(environment.ClockStateConfigPath, logger)
+    {
+        Load();
+    }
+
+    /// <inheritdoc />
+    protected override void OnDataLoaded()
+    {
+        Logger.LogDebug("Loaded clock state: {Servers} server(s), {Devices} device(s)",
+            Data.Servers.Count, Data.Devices.Count);
+    }
+
+    /// <summary>
+    /// Gets the persisted clock state for a server, or null if none or stale.
+    /// </summary>
+    /// <param name="serverKey">Server address (host:port), or null to use the most recently seen server.</param>
+    /// <param name="includeStale">Return the entry even if it is too old to seed a warm start.</param>
+    /// <returns>A copy of the persisted state.</returns>
+    public ServerClockState? GetServerState(string? serverKey, bool includeStale = false)
+    {
+        Lock.EnterReadLock();
+        try
+        {
+            ServerClockState? state;
+            if (!string.IsNullOrEmpty(serverKey))
+            {
+                Data.Servers.TryGetValue(serverKey, out state);
+            }
+            else
+            {
+                // Server not known yet (mDNS discovery happens after creation).
+                // Most hosts only ever talk to one Music Assistant server.
+                state = Data.Servers.Values.MaxBy(s => s.UpdatedAt);
+            }
+
+            if (state == null || (!includeStale && !IsFresh(state.UpdatedAt)))
+                return null;
+
+            return new ServerClockState
+            {
+                DriftPpm = state.DriftPpm,
+                UncertaintyMs = state.UncertaintyMs,
+                MeasurementCount = state.MeasurementCount,
+                UpdatedAt = state.UpdatedAt,
+                LastColdStartSyncMs = state.LastColdStartSyncMs,
+                LastWarmStartSyncMs = state.LastWarmStartSyncMs
+            };
+        }
+        finally
+        {
+            Lock.ExitReadLock();
+        }
+    }
+
+    /// <summary>
+    /// Gets the persisted locked latency for a sink, or null if none or stale.
+    /// </summary>
+    public int? GetDeviceLatency(string? sinkName)
+    {
+        if (string.IsNullOrEmpty(sinkName))
+            return null;
+
+        Lock.EnterReadLock();
+        try
+        {
+            return Data.Devices.TryGetValue(sinkName, out var state) && IsFresh(state.UpdatedAt)
+                ? state.LockedLatencyMs
+                : null;
+        }
+        finally
+        {
+            Lock.ExitReadLock();
+        }
+    }
+
+    /// <summary>
+    /// Records a reliable drift estimate for a server.
+    /// </summary>
+    public void RecordServerClock(string serverKey, double driftPpm, double uncertaintyMs, int measurementCount)
+    {
+        Lock.EnterWriteLock();
+        try
+        {
+            if (!Data.Servers.TryGetValue(serverKey, out var state))
+            {
+                state = new ServerClockState();
+                Data.Servers[serverKey] = state;
+            }
+            else if (IsFresh(state.UpdatedAt) && Math.Abs(state.DriftPpm - driftPpm) > DriftMismatchWarningPpm)
+            {
+                Logger.LogInformation(
+                    "Clock drift against {Server} changed from {Old:F2} ppm to {New:F2} ppm since last run",
+                    serverKey, state.DriftPpm, driftPpm);
+            }
+
+            state.DriftPpm = driftPpm;
+            state.UncertaintyMs = uncertaintyMs;
+            state.MeasurementCount = measurementCount;
+            state.UpdatedAt = DateTime.UtcNow;
+        }
+        finally
+        {
+            Lock.ExitWriteLock();
+        }
+
+        Save();
+    }
+
+    /// <summary>
+    /// Records the time a player took to reach in-sync playback, for cold vs warm comparison.
+    /// </summary>
+    public void RecordTimeToSync(string serverKey, bool warmStart, int elapsedMs)
+    {
+        Lock.EnterWriteLock();
+        try
+        {
+            if (!Data.Servers.TryGetValue(serverKey, out var state))
+            {
+                // No drift recorded yet - keep the timing but leave UpdatedAt unset so the
+                // entry never seeds a warm start on its own.
+                state = new ServerClockState();
+                Data.Servers[serverKey] = state;
+            }
+
+            if (warmStart)
+                state.LastWarmStartSyncMs = elapsedMs;
+            else
+                state.LastColdStartSyncMs = elapsedMs;
+        }
+        finally
+        {
+            Lock.ExitWriteLock();
+        }
+
+        Save();
+    }
+
+    /// <summary>
+    /// Records the locked output latency of a sink.
+    /// </summary>
+    public void RecordDeviceLatency(string sinkName, int latencyMs)
+    {
+        Lock.EnterWriteLock();
+        try
+        {
+            Data.Devices[sinkName] = new DeviceLatencyState
+            {
+                LockedLatencyMs = latencyMs,
+                UpdatedAt = DateTime.UtcNow
+            };
+        }
+        finally
+        {
+            Lock.ExitWriteLock();
+        }
+
+        Save();
+    }
+
+    private static bool IsFresh(DateTime updatedAt)
+    {
+        return DateTime.UtcNow - updatedAt < MaxStateAge;
+    }
+}
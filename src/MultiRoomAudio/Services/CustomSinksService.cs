@@ -63,11 +63,22 @@ public class CustomSinksService : IAsyncDisposable
             .Build();
     }
 
+    /// <summary>
+    /// Maximum concurrent pactl load-module calls during startup.
+    /// Each forks a process and takes the PulseAudio core lock, so unbounded fan-out
+    /// on a 16-sink host just queues inside PulseAudio.
+    /// </summary>
+    private const int MaxConcurrentSinkLoads = 4;
+
     /// <summary>
     /// Load and start persisted sinks on startup.
     /// Called by StartupOrchestrator during background initialization.
     /// </summary>
-    public async Task InitializeAsync(CancellationToken cancellationToken)
+    /// <param name="cancellationToken">Cancellation token.</param>
+    /// <param name="onSinkLoaded">Called as each sink finishes loading (or fails), for startup progress.</param>
+    public async Task InitializeAsync(
+        CancellationToken cancellationToken,
+        Action<SinkLoadResult>? onSinkLoaded = null)
     {
         _logger.LogInformation("CustomSinksService starting...");
 
@@ -83,38 +94,181 @@ public class CustomSinksService : IAsyncDisposable
         // Migrate old configs that don't have identifiers or have stale sink names
         configs = MigrateConfigurations(configs);
 
-        // Sort by dependency order: combine sinks first, then remap sinks
-        // (remap sinks might depend on combine sinks as their master)
-        var sorted = configs
-            .OrderBy(c => c.Type == CustomSinkType.Combine ? 0 : 1)
-            .ToList();
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+        var results = await LoadSinkGraphAsync(configs, onSinkLoaded, cancellationToken);
+        stopwatch.Stop();
 
-        var loadedCount = 0;
-        var failedCount = 0;
+        var loadedCount = results.Count(r => r.Success);
+        var failedCount = results.Count - loadedCount;
 
-        foreach (var config in sorted)
+        if (failedCount > 0)
         {
-            try
+            _logger.LogWarning("CustomSinksService started: {Loaded} sinks loaded, {Failed} failed in {Elapsed}ms",
+                loadedCount, failedCount, stopwatch.ElapsedMilliseconds);
+        }
+        else
+        {
+            _logger.LogInformation("CustomSinksService started with {Count} sinks loaded in {Elapsed}ms",
+                loadedCount, stopwatch.ElapsedMilliseconds);
+        }
+    }
+
+    /// <summary>
+    /// Loads sinks concurrently, each one as soon as the custom sinks it depends on are loaded.
+    /// </summary>
+    /// <remarks>
+    /// A combine-sink depends on its slaves and a remap-sink on its master, where those are
+    /// other custom sinks; hardware sinks are already present. Independent sinks (typically
+    /// many remap-sinks carved from one multichannel card) load in parallel, bounded by
+    /// <see cref="MaxConcurrentSinkLoads"/>. A failed dependency fails its dependents without
+    /// calling pactl; sinks in a dependency cycle fail with an error naming the cycle.
+    /// </remarks>
+    private async Task<IReadOnlyList<SinkLoadResult>> LoadSinkGraphAsync(
+        List<CustomSinkConfiguration> configs,
+        Action<SinkLoadResult>? onSinkLoaded,
+        CancellationToken cancellationToken)
+    {
+        var byName = configs.ToDictionary(c => c.Name, StringComparer.OrdinalIgnoreCase);
+        var dependencies = configs.ToDictionary(
+            c => c.Name,
+            c => GetSinkDependencies(c).Where(byName.ContainsKey).Distinct(StringComparer.OrdinalIgnoreCase).ToList(),
+            StringComparer.OrdinalIgnoreCase);
+
+        var cyclic = FindCyclicSinks(dependencies);
+        var tasks = new Dictionary<string, Task<SinkLoadResult>>(StringComparer.OrdinalIgnoreCase);
+        using var throttle = new SemaphoreSlim(MaxConcurrentSinkLoads);
+
+        Task<SinkLoadResult> GetLoadTask(string name)
+        {
+            if (!tasks.TryGetValue(name, out var task))
             {
-                await LoadSinkAsync(config, cancellationToken);
-                loadedCount++;
+                // Dependencies are created first, so a sink's task only awaits existing tasks
+                var dependencyTasks = cyclic.Contains(name)
+                    ? new List<Task<SinkLoadResult>>()
+                    : dependencies[name].Select(GetLoadTask).ToList();
+                task = LoadWhenReadyAsync(byName[name], dependencyTasks);
+                tasks[name] = task;
             }
-            catch (Exception ex)
+            return task;
+        }
+
+        async Task<SinkLoadResult> LoadWhenReadyAsync(
+            CustomSinkConfiguration config,
+            List<Task<SinkLoadResult>> dependencyTasks)
+        {
+            SinkLoadResult result;
+
+            if (cyclic.Contains(config.Name))
             {
-                failedCount++;
-                _logger.LogError(ex, "Failed to load sink '{Name}' on startup", config.Name);
+                result = FailSink(config, "Circular dependency between custom sinks: " +
+                    string.Join(", ", cyclic.Order(StringComparer.OrdinalIgnoreCase)));
             }
+            else
+            {
+                var dependencyResults = await Task.WhenAll(dependencyTasks);
+                var failedDependency = dependencyResults.FirstOrDefault(r => !r.Success);
+
+                if (failedDependency != null)
+                {
+                    result = FailSink(config, $"Dependency '{failedDependency.Name}' failed to load");
+                }
+                else
+                {
+                    await throttle.WaitAsync(cancellationToken);
+                    var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                    try
+                    {
+                        await LoadSinkAsync(config, cancellationToken);
+                        result = new SinkLoadResult(config.Name, true, stopwatch.ElapsedMilliseconds);
+                    }
+                    catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+                    {
+                        throw;
+                    }
+                    catch (Exception ex)
+                    {
+                        _logger.LogError(ex, "Failed to load sink '{Name}' on startup", config.Name);
+                        result = new SinkLoadResult(config.Name, false, stopwatch.ElapsedMilliseconds, ex.Message);
+                    }
+                    finally
+                    {
+                        throttle.Release();
+                    }
+                }
+            }
+
+            onSinkLoaded?.Invoke(result);
+            return result;
         }
 
-        if (failedCount > 0)
+        foreach (var config in configs)
         {
-            _logger.LogWarning("CustomSinksService started: {Loaded} sinks loaded, {Failed} failed",
-                loadedCount, failedCount);
+            GetLoadTask(config.Name);
         }
-        else
+
+        return await Task.WhenAll(tasks.Values);
+    }
+
+    /// <summary>
+    /// Marks a sink as failed without attempting to load it.
+    /// </summary>
+    private SinkLoadResult FailSink(CustomSinkConfiguration config, string error)
+    {
+        var context = _sinks.GetOrAdd(config.Name, _ => new CustomSinkContext(config, DateTime.UtcNow));
+        context.State = CustomSinkState.Error;
+        context.ErrorMessage = error;
+        _logger.LogError("Failed to load sink '{Name}' on startup: {Error}", config.Name, error);
+        return new SinkLoadResult(config.Name, false, 0, error);
+    }
+
+    /// <summary>
+    /// Sink names a custom sink is built on (combine slaves or remap master).
+    /// </summary>
+    private static IEnumerable<string> GetSinkDependencies(CustomSinkConfiguration config)
+    {
+        if (config.Type == CustomSinkType.Combine)
+            return config.Slaves ?? new List<string>();
+
+        return string.IsNullOrEmpty(config.MasterSink)
+            ? Array.Empty<string>()
+            : new[] { config.MasterSink };
+    }
+
+    /// <summary>
+    /// Returns the sinks that are part of (or depend on) a dependency cycle.
+    /// </summary>
+    private static HashSet<string> FindCyclicSinks(Dictionary<string, List<string>> dependencies)
+    {
+        var cyclic = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+        var visiting = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+        var done = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+
+        bool Visit(string name)
+        {
+            if (done.Contains(name))
+                return cyclic.Contains(name);
+            if (!visiting.Add(name))
+                return true;    // back edge
+
+            var inCycle = false;
+            foreach (var dependency in dependencies[name])
+            {
+                inCycle |= Visit(dependency);
+            }
+
+            visiting.Remove(name);
+            done.Add(name);
+            if (inCycle)
+                cyclic.Add(name);
+            return inCycle;
+        }
+
+        foreach (var name in dependencies.Keys)
         {
-            _logger.LogInformation("CustomSinksService started with {Count} sinks loaded", loadedCount);
+            Visit(name);
         }
+
+        return cyclic;
     }
 
     /// <summary>
@@ -172,7 +326,8 @@ public class CustomSinksService : IAsyncDisposable
             Type = CustomSinkType.Combine,
             Description = request.Description,
             Slaves = request.Slaves,
-            SlaveIdentifiers = slaveIdentifiers!
+            SlaveIdentifiers = slaveIdentifiers!,
+            InProcess = request.InProcess
         };
 
         var context = new CustomSinkContext(config, DateTime.UtcNow)
@@ -190,6 +345,20 @@ public class CustomSinksService : IAsyncDisposable
         bool success = false;
         try
         {
+            if (RoutesInProcess(config))
+            {
+                await EnsureRoutedSinksExistAsync(config, cancellationToken);
+
+                context.State = CustomSinkState.Loaded;
+                _logger.LogInformation("Created in-process combine-sink '{Name}' over {Slaves}",
+                    request.Name, string.Join(", ", request.Slaves));
+
+                SaveConfiguration(config);
+                success = true;
+
+                return ToResponse(request.Name, context);
+            }
+
             var moduleIndex = await _moduleRunner.LoadCombineSinkAsync(
                 request.Name,
                 request.Slaves,
@@ -277,7 +446,8 @@ public class CustomSinksService : IAsyncDisposable
             MasterSinkIdentifiers = masterIdentifiers,
             Channels = request.Channels,
             ChannelMappings = request.ChannelMappings,
-            Remix = request.Remix
+            Remix = request.Remix,
+            InProcess = request.InProcess
         };
 
         var context = new CustomSinkContext(config, DateTime.UtcNow)
@@ -295,6 +465,20 @@ public class CustomSinksService : IAsyncDisposable
         bool success = false;
         try
         {
+            if (RoutesInProcess(config))
+            {
+                ValidateRoutedChannels(config, masterDevice);
+
+                context.State = CustomSinkState.Loaded;
+                _logger.LogInformation("Created in-process remap-sink '{Name}' on {Master}",
+                    request.Name, request.MasterSink);
+
+                SaveConfiguration(config);
+                success = true;
+
+                return ToResponse(request.Name, context);
+            }
+
             var moduleIndex = await _moduleRunner.LoadRemapSinkAsync(
                 request.Name,
                 request.MasterSink,
@@ -498,6 +682,9 @@ public class CustomSinksService : IAsyncDisposable
         if (!_sinks.TryGetValue(name, out var context))
             return false;
 
+        if (RoutesInProcess(context.Config))
+            return context.State == CustomSinkState.Loaded;
+
         if (!context.ModuleIndex.HasValue)
             return false;
 
@@ -543,6 +730,16 @@ public class CustomSinksService : IAsyncDisposable
 
         try
         {
+            if (RoutesInProcess(config))
+            {
+                // No module: players route onto the physical sinks themselves
+                await EnsureRoutedSinksExistAsync(config, cancellationToken);
+
+                context.State = CustomSinkState.Loaded;
+                _logger.LogInformation("Loaded in-process {Type} sink '{Name}'", config.Type, config.Name);
+                return;
+            }
+
             int? moduleIndex;
 
             if (config.Type == CustomSinkType.Combine)
@@ -1528,7 +1725,57 @@ public class CustomSinksService : IAsyncDisposable
         }
     }
 
-    private static CustomSinkResponse ToResponse(string name, CustomSinkContext context)
+    /// <summary>
+    /// Whether a sink is routed in-process (see <see cref="Audio.PulseAudio.PulseAudioChannelRouter"/>)
+    /// rather than loaded as a module. Mock hardware has no PulseAudio to route to, so it
+    /// always loads the (mock) module.
+    /// </summary>
+    private bool RoutesInProcess(CustomSinkConfiguration config)
+    {
+        return config.InProcess && !_environment.IsMockHardware;
+    }
+
+    /// <summary>
+    /// Checks that the physical sinks an in-process sink plays to exist: the master of a
+    /// remap-sink, or every slave of a combine-sink.
+    /// </summary>
+    private async Task EnsureRoutedSinksExistAsync(CustomSinkConfiguration config, CancellationToken cancellationToken)
+    {
+        foreach (var target in GetSinkDependencies(config))
+        {
+            if (!await _moduleRunner.SinkExistsAsync(target, cancellationToken))
+            {
+                throw new InvalidOperationException(
+                    $"Sink '{target}' of in-process {config.Type.ToString().ToLowerInvariant()}-sink '{config.Name}' not found");
+            }
+        }
+    }
+
+    /// <summary>
+    /// Checks that every mapped master channel exists on the master sink.
+    /// module-remap-sink does this itself; the in-process router needs it up front.
+    /// </summary>
+    private static void ValidateRoutedChannels(CustomSinkConfiguration config, AudioDevice? masterDevice)
+    {
+        if (masterDevice?.ChannelMap == null)
+        {
+            throw new ArgumentException($"Channel map of master sink '{config.MasterSink}' is unknown.");
+        }
+
+        var missing = (config.ChannelMappings ?? [])
+            .Select(m => m.MasterChannel)
+            .Where(c => !masterDevice.ChannelMap.Contains(c, StringComparer.OrdinalIgnoreCase))
+            .ToList();
+
+        if (missing.Count > 0)
+        {
+            throw new ArgumentException(
+                $"Master sink '{config.MasterSink}' has no channel(s) {string.Join(", ", missing)}. " +
+                $"Available channels: {string.Join(", ", masterDevice.ChannelMap)}");
+        }
+    }
+
+    private CustomSinkResponse ToResponse(string name, CustomSinkContext context)
     {
         var config = context.Config;
         return new CustomSinkResponse(
@@ -1543,7 +1790,8 @@ public class CustomSinksService : IAsyncDisposable
             Slaves: config.Slaves,
             MasterSink: config.MasterSink,
             Channels: config.Type == CustomSinkType.Remap ? config.Channels : null,
-            ChannelMappings: config.ChannelMappings
+            ChannelMappings: config.ChannelMappings,
+            InProcess: RoutesInProcess(config)
         );
     }
 
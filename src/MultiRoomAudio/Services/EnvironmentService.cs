@@ -17,6 +17,8 @@ public class EnvironmentService
     private readonly bool _isHaos;
     private readonly bool _isMockHardware;
     private readonly bool _enableAdvancedFormats;
+    private readonly int _bufferMemoryBudgetMb;
+    private readonly int _idleCorkMs;
     private readonly string _configPath;
     private readonly string _logPath;
     private readonly Dictionary<string, JsonElement>? _haosOptions;
@@ -28,6 +30,10 @@ public class EnvironmentService
     private const string HaosSupervisorTokenEnv = "SUPERVISOR_TOKEN";
     private const string MockHardwareEnv = "MOCK_HARDWARE";
     private const string AdvancedFormatsEnv = "ENABLE_ADVANCED_FORMATS";
+    private const string BufferMemoryBudgetEnv = "BUFFER_MEMORY_BUDGET_MB";
+    private const int DefaultBufferMemoryBudgetMb = 256;
+    private const string IdleCorkEnv = "IDLE_CORK_MS";
+    private const int DefaultIdleCorkMs = 5000;
 
     public EnvironmentService(ILogger<EnvironmentService> logger)
     {
@@ -99,6 +105,9 @@ public class EnvironmentService
         {
             _logger.LogInformation("ENABLE_ADVANCED_FORMATS mode enabled - per-player format selection available");
         }
+
+        _bufferMemoryBudgetMb = DetectBufferMemoryBudget();
+        _idleCorkMs = DetectIdleCork();
     }
 
     /// <summary>
@@ -118,6 +127,18 @@ public class EnvironmentService
     /// </summary>
     public bool EnableAdvancedFormats => _enableAdvancedFormats;
 
+    /// <summary>
+    /// Total memory (MB) shared by all players' local PCM buffers.
+    /// Set via BUFFER_MEMORY_BUDGET_MB or the HAOS option buffer_memory_budget_mb.
+    /// </summary>
+    public int BufferMemoryBudgetMb => _bufferMemoryBudgetMb;
+
+    /// <summary>
+    /// Silence (ms) after which an idle player stream is corked; 0 disables idle corking.
+    /// Set via IDLE_CORK_MS or the HAOS option idle_cork_ms.
+    /// </summary>
+    public int IdleCorkMs => _idleCorkMs;
+
     /// <summary>
     /// Current environment name ("haos" or "standalone").
     /// </summary>
@@ -143,6 +164,16 @@ public class EnvironmentService
     /// </summary>
     public string OnboardingConfigPath => Path.Combine(_configPath, "onboarding.yaml");
 
+    /// <summary>
+    /// Full path to clock-state.yaml (learned clock drift and latency locks for warm start).
+    /// </summary>
+    public string ClockStateConfigPath => Path.Combine(_configPath, "clock-state.yaml");
+
+    /// <summary>
+    /// Full path to relay-probe-cache.yaml (cached CH340 relay board probe results).
+    /// </summary>
+    public string RelayProbeCachePath => Path.Combine(_configPath, "relay-probe-cache.yaml");
+
     /// <summary>
     /// Full path to mock_hardware.yaml configuration file.
     /// Only used when IsMockHardware is true.
@@ -420,4 +451,66 @@ public class EnvironmentService
         // Default: disabled
         return false;
     }
+
+    private int DetectBufferMemoryBudget()
+    {
+        var envValue = Environment.GetEnvironmentVariable(BufferMemoryBudgetEnv);
+        if (!string.IsNullOrEmpty(envValue))
+        {
+            if (int.TryParse(envValue, out var mb) && mb > 0)
+            {
+                _logger.LogDebug("{EnvVar} detected: {Value}MB", BufferMemoryBudgetEnv, mb);
+                return mb;
+            }
+
+            _logger.LogWarning("{EnvVar} value '{Value}' is not a positive integer, using default {Default}MB",
+                BufferMemoryBudgetEnv, envValue, DefaultBufferMemoryBudgetMb);
+            return DefaultBufferMemoryBudgetMb;
+        }
+
+        if (_isHaos && _haosOptions != null &&
+            _haosOptions.TryGetValue("buffer_memory_budget_mb", out var element))
+        {
+            if (element.ValueKind == JsonValueKind.Number && element.TryGetInt32(out var haosMb) && haosMb > 0)
+            {
+                _logger.LogDebug("Buffer memory budget set via HAOS options: {Value}MB", haosMb);
+                return haosMb;
+            }
+
+            _logger.LogWarning("HAOS option 'buffer_memory_budget_mb' is not a positive integer");
+        }
+
+        return DefaultBufferMemoryBudgetMb;
+    }
+
+    private int DetectIdleCork()
+    {
+        var envValue = Environment.GetEnvironmentVariable(IdleCorkEnv);
+        if (!string.IsNullOrEmpty(envValue))
+        {
+            if (int.TryParse(envValue, out var ms) && ms >= 0)
+            {
+                _logger.LogDebug("{EnvVar} detected: {Value}ms", IdleCorkEnv, ms);
+                return ms;
+            }
+
+            _logger.LogWarning("{EnvVar} value '{Value}' is not a non-negative integer, using default {Default}ms",
+                IdleCorkEnv, envValue, DefaultIdleCorkMs);
+            return DefaultIdleCorkMs;
+        }
+
+        if (_isHaos && _haosOptions != null &&
+            _haosOptions.TryGetValue("idle_cork_ms", out var element))
+        {
+            if (element.ValueKind == JsonValueKind.Number && element.TryGetInt32(out var haosMs) && haosMs >= 0)
+            {
+                _logger.LogDebug("Idle cork delay set via HAOS options: {Value}ms", haosMs);
+                return haosMs;
+            }
+
+            _logger.LogWarning("HAOS option 'idle_cork_ms' is not a non-negative integer");
+        }
+
+        return DefaultIdleCorkMs;
+    }
 }
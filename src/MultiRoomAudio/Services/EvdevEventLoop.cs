@@ -0,0 +1,333 @@
+using System.Collections.Concurrent;
+using System.Runtime.InteropServices;
+using MultiRoomAudio.Models;
+using MultiRoomAudio.Utilities;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Handles one decoded input event. Called on the event loop thread; must not block.
+/// </summary>
+public delegate void InputEventHandler(in LinuxInputEvent evt);
+
+/// <summary>
+/// Reads every registered /dev/input/eventX device from a single epoll thread.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Devices are opened non-blocking and drained in batches of up to <see cref="EventsPerRead"/>
+/// events per read(2). Events are decoded in place from a reusable buffer, so steady-state
+/// reading allocates nothing. Handlers run on the loop thread and are expected to hand work
+/// off (e.g. to <see cref="HidVolumeCoalescer"/>) rather than await it.
+/// </para>
+/// <para>
+/// Registration opens the device on the caller's thread, so permission and not-found errors
+/// surface immediately. Removal is queued to the loop thread (woken through an eventfd), so a
+/// descriptor is never closed while it is being read. A device that reports EPOLLHUP/ENODEV
+/// (unplugged) is removed by the loop and its close callback invoked.
+/// </para>
+/// </remarks>
+public sealed unsafe class EvdevEventLoop : IDisposable
+{
+    private readonly ILogger<EvdevEventLoop> _logger;
+    private readonly object _lock = new();
+    private readonly ConcurrentDictionary<long, Registration> _registrations = new();
+    private readonly ConcurrentQueue<long> _pendingRemovals = new();
+
+    private int _epollFd = -1;
+    private int _wakeFd = -1;
+    private Thread? _thread;
+    private long _nextId;
+    private volatile bool _stopping;
+    private bool _disposed;
+
+    /// <summary>
+    /// Events read per read(2) call.
+    /// </summary>
+    private const int EventsPerRead = 64;
+
+    /// <summary>
+    /// Ready descriptors returned per epoll_wait.
+    /// </summary>
+    private const int MaxReadyPerWait = 16;
+
+    /// <summary>
+    /// epoll data value reserved for the wakeup eventfd.
+    /// </summary>
+    private const ulong WakeToken = 0;
+
+    private sealed class Registration
+    {
+        public required long Id { get; init; }
+        public required string Path { get; init; }
+        public required int Fd { get; init; }
+        public required InputEventHandler OnEvent { get; init; }
+        public Action? OnClosed { get; init; }
+    }
+
+    public EvdevEventLoop(ILogger<EvdevEventLoop> logger)
+    {
+        _logger = logger;
+    }
+
+    /// <summary>
+    /// Number of devices currently being read.
+    /// </summary>
+    public int DeviceCount => _registrations.Count;
+
+    /// <summary>
+    /// Open an input device and start delivering its events to <paramref name="onEvent"/>.
+    /// </summary>
+    /// <param name="path">Input device path (e.g., /dev/input/event5 or a /dev/input/by-id link).</param>
+    /// <param name="onEvent">Called on the loop thread for every event read.</param>
+    /// <param name="onClosed">Called on the loop thread if the device goes away (not on <see cref="Remove"/>).</param>
+    /// <returns>Registration id for <see cref="Remove"/>.</returns>
+    /// <exception cref="FileNotFoundException">The device does not exist.</exception>
+    /// <exception cref="UnauthorizedAccessException">The device cannot be opened for reading.</exception>
+    public long Add(string path, InputEventHandler onEvent, Action? onClosed = null)
+    {
+        lock (_lock)
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+            EnsureStarted();
+
+            var fd = LinuxNative.Open(path, LinuxNative.O_RDONLY | LinuxNative.O_NONBLOCK | LinuxNative.O_CLOEXEC);
+            if (fd < 0)
+            {
+                var errno = Marshal.GetLastPInvokeError();
+                throw errno switch
+                {
+                    LinuxNative.ENOENT or LinuxNative.ENODEV => new FileNotFoundException("Input device not found", path),
+                    LinuxNative.EACCES => new UnauthorizedAccessException($"Permission denied opening {path}"),
+                    _ => new IOException($"Failed to open {path} (errno {errno})")
+                };
+            }
+
+            var registration = new Registration
+            {
+                Id = ++_nextId,
+                Path = path,
+                Fd = fd,
+                OnEvent = onEvent,
+                OnClosed = onClosed
+            };
+            _registrations[registration.Id] = registration;
+
+            var ev = stackalloc byte[LinuxNative.EpollEventSize];
+            LinuxNative.WriteEpollEvent(ev, LinuxNative.EPOLLIN, (ulong)registration.Id);
+            if (LinuxNative.EpollCtl(_epollFd, LinuxNative.EPOLL_CTL_ADD, fd, ev) < 0)
+            {
+                var errno = Marshal.GetLastPInvokeError();
+                _registrations.TryRemove(registration.Id, out _);
+                LinuxNative.Close(fd);
+                throw new IOException($"Failed to watch {path} (errno {errno})");
+            }
+
+            _logger.LogDebug("Watching input device {Path} (fd {Fd}, {Count} device(s) total)",
+                path, fd, _registrations.Count);
+            return registration.Id;
+        }
+    }
+
+    /// <summary>
+    /// Stop reading a device. Its descriptor is closed on the loop thread.
+    /// </summary>
+    public void Remove(long id)
+    {
+        lock (_lock)
+        {
+            if (_disposed || !_registrations.ContainsKey(id))
+                return;
+
+            _pendingRemovals.Enqueue(id);
+            Wake();
+        }
+    }
+
+    private void EnsureStarted()
+    {
+        if (_thread != null)
+            return;
+
+        _epollFd = LinuxNative.EpollCreate1(LinuxNative.EPOLL_CLOEXEC);
+        if (_epollFd < 0)
+            throw new IOException($"epoll_create1 failed (errno {Marshal.GetLastPInvokeError()})");
+
+        _wakeFd = LinuxNative.EventFd(0, LinuxNative.EFD_NONBLOCK | LinuxNative.EFD_CLOEXEC);
+        if (_wakeFd < 0)
+            throw new IOException($"eventfd failed (errno {Marshal.GetLastPInvokeError()})");
+
+        var ev = stackalloc byte[LinuxNative.EpollEventSize];
+        LinuxNative.WriteEpollEvent(ev, LinuxNative.EPOLLIN, WakeToken);
+        if (LinuxNative.EpollCtl(_epollFd, LinuxNative.EPOLL_CTL_ADD, _wakeFd, ev) < 0)
+            throw new IOException($"Failed to watch wakeup eventfd (errno {Marshal.GetLastPInvokeError()})");
+
+        _thread = new Thread(Run)
+        {
+            IsBackground = true,
+            Name = "evdev-loop"
+        };
+        _thread.Start();
+        _logger.LogDebug("Input event loop started");
+    }
+
+    private void Wake()
+    {
+        if (_wakeFd < 0)
+            return;
+
+        ulong one = 1;
+        LinuxNative.Write(_wakeFd, (byte*)&one, sizeof(ulong));
+    }
+
+    private void Run()
+    {
+        var ready = stackalloc byte[MaxReadyPerWait * LinuxNative.EpollEventSize];
+        var buffer = new byte[EventsPerRead * LinuxInputConstants.InputEventSize];
+
+        while (!_stopping)
+        {
+            var count = LinuxNative.EpollWait(_epollFd, ready, MaxReadyPerWait, -1);
+            if (count < 0)
+            {
+                var errno = Marshal.GetLastPInvokeError();
+                if (errno == LinuxNative.EINTR)
+                    continue;
+
+                _logger.LogError("Input event loop stopped: epoll_wait failed (errno {Errno})", errno);
+                break;
+            }
+
+            for (int i = 0; i < count && !_stopping; i++)
+            {
+                var (events, data) = LinuxNative.ReadEpollEvent(ready, i);
+                if (data == WakeToken)
+                {
+                    ulong value;
+                    LinuxNative.Read(_wakeFd, (byte*)&value, sizeof(ulong));
+                    continue;
+                }
+
+                if (!_registrations.TryGetValue((long)data, out var registration))
+                    continue;
+
+                var alive = (events & LinuxNative.EPOLLIN) == 0 || Drain(registration, buffer);
+                if (!alive || (events & (LinuxNative.EPOLLHUP | LinuxNative.EPOLLERR)) != 0)
+                {
+                    _logger.LogInformation("Input device {Path} closed. Device may have been unplugged.",
+                        registration.Path);
+                    Close(registration);
+                    InvokeClosed(registration);
+                }
+            }
+
+            while (_pendingRemovals.TryDequeue(out var id))
+            {
+                if (_registrations.TryGetValue(id, out var registration))
+                {
+                    Close(registration);
+                    _logger.LogDebug("Stopped watching input device {Path}", registration.Path);
+                }
+            }
+        }
+
+        foreach (var registration in _registrations.Values)
+        {
+            Close(registration);
+        }
+    }
+
+    /// <summary>
+    /// Read everything available from a device and dispatch it.
+    /// </summary>
+    /// <returns>False if the device has gone away.</returns>
+    private bool Drain(Registration registration, byte[] buffer)
+    {
+        while (true)
+        {
+            nint bytesRead;
+            fixed (byte* p = buffer)
+            {
+                bytesRead = LinuxNative.Read(registration.Fd, p, (nuint)buffer.Length);
+            }
+
+            if (bytesRead < 0)
+            {
+                var errno = Marshal.GetLastPInvokeError();
+                if (errno == LinuxNative.EAGAIN)
+                    return true;
+                if (errno == LinuxNative.EINTR)
+                    continue;
+
+                return false;
+            }
+
+            if (bytesRead == 0)
+                return false;
+
+            // evdev only ever returns whole events
+            var events = MemoryMarshal.Cast<byte, LinuxInputEvent>(buffer.AsSpan(0, (int)bytesRead));
+            foreach (ref readonly var evt in events)
+            {
+                try
+                {
+                    registration.OnEvent(in evt);
+                }
+                catch (Exception ex)
+                {
+                    _logger.LogError(ex, "Input event handler for {Path} failed", registration.Path);
+                }
+            }
+
+            if (bytesRead < buffer.Length)
+                return true;
+        }
+    }
+
+    private void Close(Registration registration)
+    {
+        if (!_registrations.TryRemove(registration.Id, out _))
+            return;
+
+        LinuxNative.EpollCtl(_epollFd, LinuxNative.EPOLL_CTL_DEL, registration.Fd, null);
+        LinuxNative.Close(registration.Fd);
+    }
+
+    private void InvokeClosed(Registration registration)
+    {
+        try
+        {
+            registration.OnClosed?.Invoke();
+        }
+        catch (Exception ex)
+        {
+            _logger.LogError(ex, "Input device close handler for {Path} failed", registration.Path);
+        }
+    }
+
+    public void Dispose()
+    {
+        Thread? thread;
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            _stopping = true;
+            thread = _thread;
+            Wake();
+        }
+
+        if (thread != null && !thread.Join(TimeSpan.FromSeconds(2)))
+        {
+            _logger.LogWarning("Input event loop did not stop in time");
+            return;
+        }
+
+        if (_wakeFd >= 0)
+            LinuxNative.Close(_wakeFd);
+        if (_epollFd >= 0)
+            LinuxNative.Close(_epollFd);
+    }
+}
@@ -0,0 +1,112 @@
+using MultiRoomAudio.Models;
+using Sendspin.SDK.Models;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Result of picking the format(s) a player advertises to the server.
+/// </summary>
+/// <param name="Formats">Formats to advertise, in preference order.</param>
+/// <param name="Mode">"auto", "manual" or "all".</param>
+/// <param name="Reason">Why this format was chosen (shown in Stats for Nerds).</param>
+internal record FormatSelection(
+    List<AudioFormat> Formats,
+    string Mode,
+    string Reason
+);
+
+/// <summary>
+/// Picks the advertised audio format from what the output device plays natively.
+/// </summary>
+/// <remarks>
+/// <para>
+/// PulseAudio runs each sink at a fixed rate. Any stream at another rate is resampled
+/// by PulseAudio on top of the decode we already do, so advertising 192kHz to a 48kHz
+/// USB DAC costs network bandwidth, FLAC decode CPU and a resampling pass for no
+/// audible gain. Advertising FLAC at the sink's own rate lets the server do the one
+/// conversion it has to do anyway (from the source file) and leaves the local path
+/// rate-matched end to end.
+/// </para>
+/// <para>
+/// Like the previous "flac-48000" default, auto mode advertises a single FLAC format,
+/// which every Music Assistant build accepts.
+/// </para>
+/// </remarks>
+internal static class FormatNegotiator
+{
+    /// <summary>
+    /// Format preference value selecting device-aware negotiation (the default).
+    /// </summary>
+    public const string AutoFormat = "auto";
+
+    /// <summary>
+    /// Rate used when the sink rate is unknown or no advertised FLAC rate fits it.
+    /// </summary>
+    private const int FallbackSampleRate = 48000;
+
+    /// <summary>
+    /// Whether a format preference selects auto negotiation (null/empty or "auto").
+    /// </summary>
+    public static bool IsAuto(string? advertisedFormat)
+    {
+        return string.IsNullOrWhiteSpace(advertisedFormat) ||
+               advertisedFormat.Equals(AutoFormat, StringComparison.OrdinalIgnoreCase);
+    }
+
+    /// <summary>
+    /// Selects the FLAC format matching the output device.
+    /// </summary>
+    /// <param name="allFormats">All formats the player can decode.</param>
+    /// <param name="device">The PulseAudio sink, or null if it could not be resolved.</param>
+    /// <param name="hardware">Rates/bit depths parsed from ALSA, or null if not available.</param>
+    public static FormatSelection SelectNative(
+        IReadOnlyList<AudioFormat> allFormats,
+        AudioDevice? device,
+        DeviceCapabilities? hardware)
+    {
+        var flacFormats = allFormats
+            .Where(f => f.Codec.Equals("flac", StringComparison.OrdinalIgnoreCase))
+            .OrderByDescending(f => f.SampleRate)
+            .ToList();
+
+        var sinkRate = device?.DefaultSampleRate ?? 0;
+
+        // 1. The sink's own rate: no PulseAudio resampling at all
+        var native = flacFormats.FirstOrDefault(f => f.SampleRate == sinkRate && SupportsRate(hardware, f.SampleRate));
+        if (native != null)
+        {
+            return Single(native, $"matches sink rate {sinkRate}Hz");
+        }
+
+        // 2. Highest rate at or below the sink rate in the same family (44.1k vs 48k),
+        //    so any resampling is a cheap integer ratio rather than a fractional one
+        if (sinkRate > 0)
+        {
+            var sameFamily = flacFormats.FirstOrDefault(f =>
+                f.SampleRate <= sinkRate &&
+                sinkRate % f.SampleRate == 0 &&
+                SupportsRate(hardware, f.SampleRate));
+            if (sameFamily != null)
+            {
+                return Single(sameFamily, $"integer ratio to sink rate {sinkRate}Hz");
+            }
+        }
+
+        // 3. Compatibility default
+        var fallback = flacFormats.FirstOrDefault(f => f.SampleRate == FallbackSampleRate) ?? allFormats[0];
+        return Single(fallback, sinkRate > 0
+            ? $"no FLAC rate fits sink rate {sinkRate}Hz, using default"
+            : "sink rate unknown, using default");
+    }
+
+    private static bool SupportsRate(DeviceCapabilities? hardware, int sampleRate)
+    {
+        // Without ALSA data the sink rate from PulseAudio is the only thing we know
+        return hardware == null || hardware.SupportedSampleRates.Contains(sampleRate);
+    }
+
+    private static FormatSelection Single(AudioFormat format, string reason)
+    {
+        return new FormatSelection(new List<AudioFormat> { format }, AutoFormat, reason);
+    }
+}
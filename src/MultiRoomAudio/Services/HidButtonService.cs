@@ -1,5 +1,4 @@
 using System.Collections.Concurrent;
-using System.Runtime.InteropServices;
 using MultiRoomAudio.Models;
 
 namespace MultiRoomAudio.Services;
@@ -8,12 +7,21 @@ namespace MultiRoomAudio.Services;
 /// Manages HID button support for USB audio devices.
 /// Reads HID events directly from /dev/input/eventX and applies volume/mute changes to players.
 /// </summary>
+/// <remarks>
+/// All input devices are read by the shared <see cref="EvdevEventLoop"/> thread; key presses
+/// are handed to <see cref="HidVolumeCoalescer"/>, which applies them once per frame.
+/// Readers for unplugged devices are reopened when <see cref="HotplugMonitor"/> reports a new
+/// input device.
+/// </remarks>
 public class HidButtonService : IAsyncDisposable
 {
     private readonly ILogger<HidButtonService> _logger;
     private readonly HidInputDeviceDetector _hidDetector;
     private readonly ConfigurationService _configService;
     private readonly IServiceProvider _serviceProvider;
+    private readonly EvdevEventLoop _eventLoop;
+    private readonly HidVolumeCoalescer _volumeCoalescer;
+    private readonly HotplugMonitor? _hotplug;
 
     private readonly ConcurrentDictionary<string, HidButtonDeviceState> _deviceStates = new();
     private readonly SemaphoreSlim _initLock = new(1, 1);
@@ -25,16 +33,65 @@ public class HidButtonService : IAsyncDisposable
     /// </summary>
     private const int VolumeStep = 5;
 
+    /// <summary>
+    /// Delay after an input device is plugged in before reopening readers, so udev has
+    /// created the by-id links and set permissions.
+    /// </summary>
+    private const int ReattachDelayMs = 1000;
+
     public HidButtonService(
         ILogger<HidButtonService> logger,
         HidInputDeviceDetector hidDetector,
         ConfigurationService configService,
-        IServiceProvider serviceProvider)
+        IServiceProvider serviceProvider,
+        EvdevEventLoop eventLoop,
+        HidVolumeCoalescer volumeCoalescer,
+        HotplugMonitor? hotplug = null)
     {
         _logger = logger;
         _hidDetector = hidDetector;
         _configService = configService;
         _serviceProvider = serviceProvider;
+        _eventLoop = eventLoop;
+        _volumeCoalescer = volumeCoalescer;
+        _hotplug = hotplug;
+
+        if (_hotplug != null)
+        {
+            _hotplug.DeviceChanged += OnHotplug;
+        }
+    }
+
+    private void OnHotplug(object? sender, HotplugEventArgs e)
+    {
+        if (_disposed || e.Action != HotplugAction.Add || e.Device.Subsystem != "input")
+            return;
+
+        _ = Task.Delay(ReattachDelayMs).ContinueWith(_ => ReattachReaders(), TaskScheduler.Default);
+    }
+
+    /// <summary>
+    /// Reopen readers whose device went away while their player was still running.
+    /// </summary>
+    private void ReattachReaders()
+    {
+        if (_disposed)
+            return;
+
+        foreach (var (sinkName, state) in _deviceStates)
+        {
+            if (state.ReaderId != null || state.PlayerName is not { } playerName || state.InputDevicePath is not { } inputDevice)
+                continue;
+
+            if (!File.Exists(inputDevice))
+                continue;
+
+            if (StartHidReader(state, inputDevice, playerName))
+            {
+                _logger.LogInformation("HID input device for {SinkName} reconnected, resumed reader for player '{PlayerName}'",
+                    sinkName, playerName);
+            }
+        }
     }
 
     /// <summary>
@@ -227,7 +284,7 @@ public class HidButtonService : IAsyncDisposable
         });
 
         // If already running for this player, skip
-        if (state.ReaderTask != null && !state.ReaderTask.IsCompleted && state.PlayerName == playerName)
+        if (state.ReaderId != null && state.PlayerName == playerName)
         {
             _logger.LogDebug("HID reader already running for {SinkName} / {PlayerName}", sinkName, playerName);
             return;
@@ -237,9 +294,8 @@ public class HidButtonService : IAsyncDisposable
         StopHidReader(state);
 
         // Start new reader
-        state.PlayerName = playerName;
-        state.ReaderCts = new CancellationTokenSource();
-        state.ReaderTask = Task.Run(() => ReadHidEventsAsync(state, state.ReaderCts.Token));
+        if (!StartHidReader(state, inputDevice, playerName))
+            return;
 
         _logger.LogInformation("Started HID event reader for {SinkName} -> player '{PlayerName}' (input: {InputDevice})",
             sinkName, playerName, inputDevice);
@@ -280,71 +336,28 @@ public class HidButtonService : IAsyncDisposable
         return null;
     }
 
-    private void StopHidReader(HidButtonDeviceState state)
-    {
-        if (state.ReaderCts != null)
-        {
-            state.ReaderCts.Cancel();
-            state.ReaderCts.Dispose();
-            state.ReaderCts = null;
-        }
-        state.ReaderTask = null;
-        state.PlayerName = null;
-    }
-
-    private async Task ReadHidEventsAsync(HidButtonDeviceState state, CancellationToken ct)
+    private bool StartHidReader(HidButtonDeviceState state, string inputDevice, string playerName)
     {
-        var inputDevice = state.InputDevicePath;
-        var playerName = state.PlayerName;
-
-        if (string.IsNullOrEmpty(inputDevice) || string.IsNullOrEmpty(playerName))
-        {
-            _logger.LogWarning("Cannot start HID reader: missing input device or player name");
-            return;
-        }
-
         _logger.LogDebug("Opening HID input device: {InputDevice}", inputDevice);
 
         try
         {
-            using var fs = new FileStream(inputDevice, FileMode.Open, FileAccess.Read, FileShare.ReadWrite);
-            var buffer = new byte[LinuxInputConstants.InputEventSize];
-
-            while (!ct.IsCancellationRequested)
-            {
-                int bytesRead;
-                try
+            long readerId = 0;
+            readerId = _eventLoop.Add(
+                inputDevice,
+                (in LinuxInputEvent evt) => OnInputEvent(in evt, inputDevice, playerName),
+                () =>
                 {
-                    bytesRead = await fs.ReadAsync(buffer, 0, buffer.Length, ct);
-                }
-                catch (OperationCanceledException)
-                {
-                    break;
-                }
-
-                if (bytesRead < LinuxInputConstants.InputEventSize)
-                    continue;
-
-                var evt = ParseInputEvent(buffer);
-
-                // Log ALL events for debugging (to diagnose devices with non-standard key codes)
-                // EV_SYN(0) events are too noisy, skip those
-                if (evt.Type != LinuxInputConstants.EV_SYN)
-                {
-                    _logger.LogDebug("HID event: type={Type} code={Code} value={Value} (device: {Device})",
-                        evt.Type, evt.Code, evt.Value, inputDevice);
-                }
-
-                // Only process key press events (not release or repeat)
-                if (evt.Type != LinuxInputConstants.EV_KEY || evt.Value != LinuxInputConstants.KEY_PRESSED)
-                    continue;
-
-                await HandleKeyEventAsync(evt.Code, state, playerName);
-            }
-        }
-        catch (OperationCanceledException)
-        {
-            _logger.LogDebug("HID reader cancelled for {InputDevice}", inputDevice);
+                    // Device went away (unplugged) - forget the reader so the next start reopens it
+                    if (state.ReaderId == readerId)
+                    {
+                        state.ReaderId = null;
+                    }
+                });
+
+            state.ReaderId = readerId;
+            state.PlayerName = playerName;
+            return true;
         }
         catch (FileNotFoundException)
         {
@@ -356,92 +369,59 @@ public class HidButtonService : IAsyncDisposable
         }
         catch (Exception ex)
         {
-            _logger.LogError(ex, "Error reading HID events from {InputDevice}", inputDevice);
+            _logger.LogError(ex, "Error opening HID input device {InputDevice}", inputDevice);
         }
+
+        return false;
     }
 
-    private static LinuxInputEvent ParseInputEvent(byte[] buffer)
+    private void StopHidReader(HidButtonDeviceState state)
     {
-        var handle = GCHandle.Alloc(buffer, GCHandleType.Pinned);
-        try
-        {
-            return Marshal.PtrToStructure<LinuxInputEvent>(handle.AddrOfPinnedObject());
-        }
-        finally
+        if (state.ReaderId is { } readerId)
         {
-            handle.Free();
+            _eventLoop.Remove(readerId);
+            state.ReaderId = null;
         }
+        state.PlayerName = null;
     }
 
-    private async Task HandleKeyEventAsync(ushort keyCode, HidButtonDeviceState state, string playerName)
+    /// <summary>
+    /// Handle one input event. Runs on the event loop thread, so it only queues the intent.
+    /// </summary>
+    private void OnInputEvent(in LinuxInputEvent evt, string inputDevice, string playerName)
     {
-        // Get PlayerManagerService from DI
-        using var scope = _serviceProvider.CreateScope();
-        var playerManager = scope.ServiceProvider.GetService<PlayerManagerService>();
-        if (playerManager == null)
+        // Log ALL events for debugging (to diagnose devices with non-standard key codes)
+        // EV_SYN(0) events are too noisy, skip those
+        if (evt.Type != LinuxInputConstants.EV_SYN && _logger.IsEnabled(LogLevel.Debug))
         {
-            _logger.LogWarning("PlayerManagerService not available");
-            return;
+            _logger.LogDebug("HID event: type={Type} code={Code} value={Value} (device: {Device})",
+                evt.Type, evt.Code, evt.Value, inputDevice);
         }
 
-        switch (keyCode)
+        // Only process key press events (not release or repeat)
+        if (evt.Type != LinuxInputConstants.EV_KEY || evt.Value != LinuxInputConstants.KEY_PRESSED)
+            return;
+
+        switch (evt.Code)
         {
             case LinuxInputConstants.KEY_MUTE:
-                // Get current mute state from player (not our cached state, which may be stale)
-                var allPlayers = playerManager.GetAllPlayers();
-                var player = allPlayers.Players.FirstOrDefault(p =>
-                    p.Name.Equals(playerName, StringComparison.OrdinalIgnoreCase));
-
-                if (player == null)
-                {
-                    _logger.LogWarning("Player '{PlayerName}' not found for mute toggle", playerName);
-                    return;
-                }
-
-                // Toggle based on actual player state
-                var newMuteState = !player.IsMuted;
-                state.IsMuted = newMuteState; // Keep our cache in sync
-
-                _logger.LogInformation("HID mute button pressed for player '{PlayerName}': {State} (was {OldState})",
-                    playerName, newMuteState ? "muted" : "unmuted", player.IsMuted ? "muted" : "unmuted");
-                playerManager.SetMuted(playerName, newMuteState);
+                _volumeCoalescer.PostMuteToggle(playerName);
                 break;
 
             case LinuxInputConstants.KEY_VOLUMEUP:
-                _logger.LogDebug("HID volume up pressed for player '{PlayerName}'", playerName);
-                await AdjustVolumeAsync(playerManager, playerName, VolumeStep);
+                _volumeCoalescer.PostVolume(playerName, VolumeStep);
                 break;
 
             case LinuxInputConstants.KEY_VOLUMEDOWN:
-                _logger.LogDebug("HID volume down pressed for player '{PlayerName}'", playerName);
-                await AdjustVolumeAsync(playerManager, playerName, -VolumeStep);
+                _volumeCoalescer.PostVolume(playerName, -VolumeStep);
                 break;
 
             default:
-                _logger.LogDebug("Unhandled HID key code: {KeyCode}", keyCode);
+                _logger.LogDebug("Unhandled HID key code: {KeyCode}", evt.Code);
                 break;
         }
     }
 
-    private async Task AdjustVolumeAsync(PlayerManagerService playerManager, string playerName, int delta)
-    {
-        var allPlayers = playerManager.GetAllPlayers();
-        var player = allPlayers.Players.FirstOrDefault(p =>
-            p.Name.Equals(playerName, StringComparison.OrdinalIgnoreCase));
-
-        if (player == null)
-        {
-            _logger.LogWarning("Player '{PlayerName}' not found for volume adjustment", playerName);
-            return;
-        }
-
-        var newVolume = Math.Clamp(player.Volume + delta, 0, 100);
-        _logger.LogInformation("HID volume {Direction} for player '{PlayerName}': {OldVol}% -> {NewVol}%",
-            delta > 0 ? "up" : "down", playerName, player.Volume, newVolume);
-
-        await playerManager.SetVolumeAsync(playerName, newVolume);
-    }
-
     private void SaveHidButtonConfig(string deviceKey, bool enabled, string? inputPath, AudioDevice device)
     {
         var config = _configService.GetDevice(deviceKey);
@@ -473,6 +453,14 @@ public class HidButtonService : IAsyncDisposable
 
         _disposed = true;
 
+        if (_hotplug != null)
+        {
+            _hotplug.DeviceChanged -= OnHotplug;
+        }
+
+        // Apply and save anything still queued while players still exist
+        _volumeCoalescer.Dispose();
+
         // Stop all HID readers
         foreach (var (sinkName, state) in _deviceStates)
         {
@@ -1,4 +1,6 @@
+using System.Collections.Concurrent;
 using System.Text.RegularExpressions;
+using MultiRoomAudio.Models;
 
 namespace MultiRoomAudio.Services;
 
@@ -6,9 +8,22 @@ namespace MultiRoomAudio.Services;
 /// Detects HID input devices for USB audio devices.
 /// Maps USB audio devices to their corresponding /dev/input/eventX paths.
 /// </summary>
+/// <remarks>
+/// While the <see cref="HotplugMonitor"/> is running, lookups are remembered until an input
+/// device is added or removed, so listing devices doesn't rescan /dev/input/by-id each time.
+/// </remarks>
 public partial class HidInputDeviceDetector
 {
     private readonly ILogger<HidInputDeviceDetector> _logger;
+    private readonly HotplugMonitor? _hotplug;
+    private readonly ConcurrentDictionary<(string?, string?, string?, string?), string?> _lookupCache = new();
+
+    /// <summary>
+    /// Time for udev to create the by-id links after the kernel reports a new input device.
+    /// Lookups are forgotten again after this, so a lookup that ran before the links existed
+    /// isn't remembered as "no device".
+    /// </summary>
+    private const int UdevSettleMs = 2000;
 
     /// <summary>
     /// Directory containing symlinks to input devices by ID.
@@ -42,9 +57,24 @@ public partial class HidInputDeviceDetector
     [GeneratedRegex(@"/usb\d+/(\d+-\d+(?:\.\d+)*)/", RegexOptions.Compiled)]
     private static partial Regex SysfsUsbPortPattern();
 
-    public HidInputDeviceDetector(ILogger<HidInputDeviceDetector> logger)
+    public HidInputDeviceDetector(ILogger<HidInputDeviceDetector> logger, HotplugMonitor? hotplug = null)
     {
         _logger = logger;
+        _hotplug = hotplug;
+
+        if (_hotplug != null)
+        {
+            _hotplug.DeviceChanged += OnHotplug;
+        }
+    }
+
+    private void OnHotplug(object? sender, HotplugEventArgs e)
+    {
+        if (e.Device.Subsystem != "input")
+            return;
+
+        _lookupCache.Clear();
+        _ = Task.Delay(UdevSettleMs).ContinueWith(_ => _lookupCache.Clear(), TaskScheduler.Default);
     }
 
     /// <summary>
@@ -57,6 +87,20 @@ public partial class HidInputDeviceDetector
     /// <param name="serial">The USB serial number (optional, for fallback matching).</param>
     /// <returns>Path to the input device (e.g., /dev/input/by-id/usb-...-event-if03), or null if not found.</returns>
     public string? FindInputDevice(string? busPath, string? vendorId, string? productId, string? serial = null)
+    {
+        if (_hotplug?.IsRunning != true)
+            return ScanInputDevice(busPath, vendorId, productId, serial);
+
+        var key = (busPath, vendorId, productId, serial);
+        if (_lookupCache.TryGetValue(key, out var cached))
+            return cached;
+
+        var result = ScanInputDevice(busPath, vendorId, productId, serial);
+        _lookupCache[key] = result;
+        return result;
+    }
+
+    private string? ScanInputDevice(string? busPath, string? vendorId, string? productId, string? serial)
     {
         // Must be a USB device (bus_path contains "usb-")
         if (string.IsNullOrEmpty(busPath) || !busPath.Contains("usb-", StringComparison.OrdinalIgnoreCase))
@@ -0,0 +1,246 @@
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Merges volume and mute intents from HID buttons into at most one player update per frame.
+/// </summary>
+/// <remarks>
+/// <para>
+/// A volume knob reports one key press per detent, so a fast spin produces dozens of presses a
+/// second. Each one used to be a full volume change: apply, sync to Music Assistant, broadcast
+/// and save players.yaml. Presses are now summed per player and applied once every
+/// <see cref="FrameMs"/>; mute presses toggle once per odd count.
+/// </para>
+/// <para>
+/// The configuration is saved once the knob has been still for <see cref="PersistDelayMs"/>
+/// rather than on every frame. The frame timer only runs while there is something to apply
+/// or save.
+/// </para>
+/// </remarks>
+public sealed class HidVolumeCoalescer : IDisposable
+{
+    private readonly ILogger<HidVolumeCoalescer> _logger;
+    private readonly IServiceProvider _serviceProvider;
+    private readonly object _lock = new();
+    private readonly Dictionary<string, PendingIntent> _pending = new(StringComparer.OrdinalIgnoreCase);
+    private readonly Timer _timer;
+    private bool _running;
+    private bool _disposed;
+
+    /// <summary>
+    /// Interval at which pending intents are applied.
+    /// </summary>
+    private const int FrameMs = 50;
+
+    /// <summary>
+    /// Quiet time after the last volume change before the configuration is saved.
+    /// </summary>
+    private const int PersistDelayMs = 1000;
+
+    private sealed class PendingIntent
+    {
+        public int VolumeDelta;
+        public int MuteToggles;
+        public int Presses;
+        public long LastAppliedTicks;
+        public bool NeedsPersist;
+    }
+
+    public HidVolumeCoalescer(ILogger<HidVolumeCoalescer> logger, IServiceProvider serviceProvider)
+    {
+        _logger = logger;
+        _serviceProvider = serviceProvider;
+        _timer = new Timer(_ => OnFrame(), null, Timeout.Infinite, Timeout.Infinite);
+    }
+
+    /// <summary>
+    /// Queue a relative volume change for a player. Does not block.
+    /// </summary>
+    public void PostVolume(string playerName, int delta)
+    {
+        Post(playerName, intent =>
+        {
+            intent.VolumeDelta += delta;
+            intent.Presses++;
+        });
+    }
+
+    /// <summary>
+    /// Queue a mute toggle for a player. Does not block.
+    /// </summary>
+    public void PostMuteToggle(string playerName)
+    {
+        Post(playerName, intent =>
+        {
+            intent.MuteToggles++;
+            intent.Presses++;
+        });
+    }
+
+    private void Post(string playerName, Action<PendingIntent> update)
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            if (!_pending.TryGetValue(playerName, out var intent))
+            {
+                intent = new PendingIntent();
+                _pending[playerName] = intent;
+            }
+
+            update(intent);
+
+            if (!_running)
+            {
+                _running = true;
+                _timer.Change(FrameMs, FrameMs);
+            }
+        }
+    }
+
+    private void OnFrame()
+    {
+        List<(string Player, int Delta, int MuteToggles, int Presses)>? apply = null;
+        List<string>? persist = null;
+        var now = Environment.TickCount64;
+
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            foreach (var (player, intent) in _pending)
+            {
+                if (intent.VolumeDelta != 0 || intent.MuteToggles != 0)
+                {
+                    (apply ??= new()).Add((player, intent.VolumeDelta, intent.MuteToggles, intent.Presses));
+                    if (intent.VolumeDelta != 0)
+                    {
+                        intent.NeedsPersist = true;
+                        intent.LastAppliedTicks = now;
+                    }
+
+                    intent.VolumeDelta = 0;
+                    intent.MuteToggles = 0;
+                    intent.Presses = 0;
+                }
+                else if (intent.NeedsPersist && now - intent.LastAppliedTicks >= PersistDelayMs)
+                {
+                    (persist ??= new()).Add(player);
+                    intent.NeedsPersist = false;
+                }
+            }
+
+            // Forget players with nothing left to do, and stop the timer when all are idle
+            foreach (var player in _pending.Where(p => !p.Value.NeedsPersist && p.Value.Presses == 0)
+                         .Select(p => p.Key).ToList())
+            {
+                _pending.Remove(player);
+            }
+
+            if (_pending.Count == 0 && _running)
+            {
+                _running = false;
+                _timer.Change(Timeout.Infinite, Timeout.Infinite);
+            }
+        }
+
+        if (apply == null && persist == null)
+            return;
+
+        var playerManager = _serviceProvider.GetService<PlayerManagerService>();
+        if (playerManager == null)
+        {
+            _logger.LogWarning("PlayerManagerService not available");
+            return;
+        }
+
+        if (apply != null)
+        {
+            foreach (var (player, delta, muteToggles, presses) in apply)
+            {
+                try
+                {
+                    Apply(playerManager, player, delta, muteToggles, presses);
+                }
+                catch (Exception ex)
+                {
+                    _logger.LogError(ex, "Failed to apply HID volume change for player '{PlayerName}'", player);
+                }
+            }
+        }
+
+        if (persist != null)
+        {
+            foreach (var player in persist)
+            {
+                playerManager.PersistVolume(player);
+            }
+        }
+    }
+
+    private void Apply(PlayerManagerService playerManager, string playerName, int delta, int muteToggles, int presses)
+    {
+        var player = playerManager.GetPlayer(playerName);
+        if (player == null)
+        {
+            _logger.LogWarning("Player '{PlayerName}' not found for HID button change", playerName);
+            return;
+        }
+
+        // Get current mute state from player (not a cached state, which may be stale)
+        if (muteToggles % 2 == 1)
+        {
+            var newMuteState = !player.IsMuted;
+            _logger.LogInformation("HID mute button pressed for player '{PlayerName}': {State} (was {OldState})",
+                playerName, newMuteState ? "muted" : "unmuted", player.IsMuted ? "muted" : "unmuted");
+            playerManager.SetMuted(playerName, newMuteState);
+        }
+
+        if (delta == 0)
+            return;
+
+        var newVolume = Math.Clamp(player.Volume + delta, 0, 100);
+        if (newVolume == player.Volume)
+            return;
+
+        _logger.LogInformation("HID volume {Direction} for player '{PlayerName}': {OldVol}% -> {NewVol}% ({Presses} press(es))",
+            delta > 0 ? "up" : "down", playerName, player.Volume, newVolume, presses);
+
+        _ = playerManager.SetVolumeAsync(playerName, newVolume, persist: false);
+    }
+
+    public void Dispose()
+    {
+        List<string> unsaved;
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            unsaved = _pending.Where(p => p.Value.NeedsPersist).Select(p => p.Key).ToList();
+            _pending.Clear();
+        }
+
+        _timer.Dispose();
+
+        // Don't lose a volume set just before shutdown
+        if (unsaved.Count == 0)
+            return;
+
+        try
+        {
+            var playerManager = _serviceProvider.GetService<PlayerManagerService>();
+            foreach (var player in unsaved)
+            {
+                playerManager?.PersistVolume(player);
+            }
+        }
+        catch (ObjectDisposedException)
+        {
+            // Container already torn down
+        }
+    }
+}
@@ -0,0 +1,414 @@
+using System.Collections.Concurrent;
+using System.Runtime.InteropServices;
+using System.Text;
+using MultiRoomAudio.Models;
+using MultiRoomAudio.Utilities;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Background service that listens for kernel hotplug events (NETLINK_KOBJECT_UEVENT) and
+/// keeps an inventory of the input, serial, hidraw and USB devices present.
+/// </summary>
+/// <remarks>
+/// <para>
+/// The inventory is seeded from sysfs once at startup and then updated incrementally from
+/// uevents, so consumers learn about plugged and unplugged knobs and relay boards as it
+/// happens instead of rescanning on every request. <see cref="DeviceChanged"/> is raised on
+/// the monitor thread; handlers must hand off any slow work.
+/// </para>
+/// <para>
+/// Kernel uevents are raised before udev has finished with the device (permissions, by-id
+/// links), so consumers that open the device should allow a short settle delay. If the socket
+/// overflows, the inventory is rebuilt from sysfs and the differences are raised as events.
+/// </para>
+/// <para>
+/// Binding the socket does not prove events arrive: a rootless or user-namespace container can
+/// bind it and never receive one. <see cref="IsRunning"/> only becomes true once the first
+/// uevent has been received, and until then consumers keep scanning on demand, as they do
+/// where netlink is unavailable (non-Linux, restricted container). The inventory is also
+/// reconciled with sysfs every <see cref="ReconcileInterval"/>, so anything the socket missed
+/// is raised as events late rather than never.
+/// </para>
+/// </remarks>
+public sealed unsafe class HotplugMonitor : BackgroundService
+{
+    private readonly ILogger<HotplugMonitor> _logger;
+    private readonly ConcurrentDictionary<string, HotplugDevice> _devices = new(StringComparer.Ordinal);
+    private readonly object _scanLock = new();
+
+    /// <summary>
+    /// Receive buffer size. A uevent is a few hundred bytes; the kernel limit is 8 KiB.
+    /// </summary>
+    private const int ReceiveBufferSize = 8192;
+
+    /// <summary>
+    /// How often the receive loop checks for shutdown while idle.
+    /// </summary>
+    private const int PollTimeoutMs = 500;
+
+    /// <summary>
+    /// errno for a receive queue overflow (events were lost).
+    /// </summary>
+    private const int ENOBUFS = 105;
+
+    /// <summary>
+    /// How often the inventory is rebuilt from sysfs to catch events that were never delivered.
+    /// </summary>
+    private static readonly TimeSpan ReconcileInterval = TimeSpan.FromSeconds(60);
+
+    private static readonly (string Subsystem, string ClassPath)[] SysfsSources =
+    [
+        ("input", "/sys/class/input"),
+        ("tty", "/sys/class/tty"),
+        ("hidraw", "/sys/class/hidraw"),
+        ("usb", "/sys/bus/usb/devices")
+    ];
+
+    /// <summary>
+    /// Raised when a tracked device is added or removed.
+    /// </summary>
+    public event EventHandler<HotplugEventArgs>? DeviceChanged;
+
+    /// <summary>
+    /// Whether uevents are being received (at least one has arrived since the socket was bound).
+    /// While false, the inventory is not kept current and consumers should not cache scans.
+    /// </summary>
+    public bool IsRunning { get; private set; }
+
+    public HotplugMonitor(ILogger<HotplugMonitor> logger)
+    {
+        _logger = logger;
+    }
+
+    /// <summary>
+    /// Devices of a subsystem currently present.
+    /// </summary>
+    public IReadOnlyList<HotplugDevice> GetDevices(string subsystem)
+    {
+        return _devices.Values.Where(d => d.Subsystem == subsystem).ToList();
+    }
+
+    protected override Task ExecuteAsync(CancellationToken stoppingToken)
+    {
+        if (!OperatingSystem.IsLinux())
+        {
+            _logger.LogDebug("Hotplug monitor not available on this platform - devices are scanned on demand");
+            return Task.CompletedTask;
+        }
+
+        return Task.Factory.StartNew(() => Run(stoppingToken), stoppingToken,
+            TaskCreationOptions.LongRunning, TaskScheduler.Default);
+    }
+
+    private void Run(CancellationToken ct)
+    {
+        var fd = OpenSocket();
+        if (fd < 0)
+            return;
+
+        try
+        {
+            Rescan(raiseEvents: false);
+            _logger.LogInformation("Hotplug monitor started ({Count} devices present)", _devices.Count);
+            var nextReconcile = DateTime.UtcNow + ReconcileInterval;
+
+            var buffer = new byte[ReceiveBufferSize];
+            var pollFd = new LinuxNative.PollFd { Fd = fd, Events = LinuxNative.POLLIN };
+
+            while (!ct.IsCancellationRequested)
+            {
+                if (DateTime.UtcNow >= nextReconcile)
+                {
+                    Reconcile();
+                    nextReconcile = DateTime.UtcNow + ReconcileInterval;
+                }
+
+                pollFd.Revents = 0;
+                var ready = LinuxNative.Poll(ref pollFd, 1, PollTimeoutMs);
+                if (ready <= 0)
+                    continue;
+
+                nint length;
+                fixed (byte* p = buffer)
+                {
+                    length = LinuxNative.Recv(fd, p, (nuint)buffer.Length, 0);
+                }
+
+                if (length < 0)
+                {
+                    var errno = Marshal.GetLastPInvokeError();
+                    if (errno == ENOBUFS)
+                    {
+                        _logger.LogWarning("Hotplug events were dropped - rescanning devices");
+                        MarkReceiving();
+                        Rescan(raiseEvents: true);
+                    }
+                    continue;
+                }
+
+                HandleMessage(buffer.AsSpan(0, (int)length));
+            }
+        }
+        catch (Exception ex)
+        {
+            _logger.LogError(ex, "Hotplug monitor stopped - devices will be scanned on demand");
+        }
+        finally
+        {
+            IsRunning = false;
+            LinuxNative.Close(fd);
+        }
+    }
+
+    private int OpenSocket()
+    {
+        try
+        {
+            var fd = LinuxNative.Socket(LinuxNative.AF_NETLINK, LinuxNative.SOCK_DGRAM | LinuxNative.SOCK_CLOEXEC,
+                LinuxNative.NETLINK_KOBJECT_UEVENT);
+            if (fd < 0)
+            {
+                _logger.LogWarning("Hotplug monitor unavailable: netlink socket failed (errno {Errno}). Devices will be scanned on demand",
+                    Marshal.GetLastPInvokeError());
+                return -1;
+            }
+
+            var addr = new LinuxNative.SockAddrNetlink
+            {
+                Family = LinuxNative.AF_NETLINK,
+                Pid = 0, // let the kernel assign
+                Groups = LinuxNative.UEVENT_KERNEL_GROUP
+            };
+
+            if (LinuxNative.Bind(fd, ref addr, sizeof(LinuxNative.SockAddrNetlink)) < 0)
+            {
+                _logger.LogWarning("Hotplug monitor unavailable: netlink bind failed (errno {Errno}). Devices will be scanned on demand",
+                    Marshal.GetLastPInvokeError());
+                LinuxNative.Close(fd);
+                return -1;
+            }
+
+            return fd;
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "Hotplug monitor unavailable. Devices will be scanned on demand");
+            return -1;
+        }
+    }
+
+    /// <summary>
+    /// Parse a kernel uevent: "ACTION@DEVPATH\0KEY=VALUE\0KEY=VALUE\0...".
+    /// </summary>
+    private void HandleMessage(ReadOnlySpan<byte> message)
+    {
+        string? action = null, devPath = null, subsystem = null, devName = null, devType = null;
+
+        var first = true;
+        while (!message.IsEmpty)
+        {
+            var end = message.IndexOf((byte)0);
+            var field = end < 0 ? message : message[..end];
+            message = end < 0 ? ReadOnlySpan<byte>.Empty : message[(end + 1)..];
+
+            if (field.IsEmpty)
+                continue;
+
+            if (first)
+            {
+                // Header; udev's rebroadcasts (group 2) start with "libudev" and are not expected here
+                first = false;
+                if (field.IndexOf((byte)'@') < 0)
+                    return;
+                MarkReceiving();
+                continue;
+            }
+
+            var eq = field.IndexOf((byte)'=');
+            if (eq <= 0)
+                continue;
+
+            var key = field[..eq];
+            var value = field[(eq + 1)..];
+            if (key.SequenceEqual("ACTION"u8))
+                action = Encoding.UTF8.GetString(value);
+            else if (key.SequenceEqual("DEVPATH"u8))
+                devPath = Encoding.UTF8.GetString(value);
+            else if (key.SequenceEqual("SUBSYSTEM"u8))
+                subsystem = Encoding.UTF8.GetString(value);
+            else if (key.SequenceEqual("DEVNAME"u8))
+                devName = Encoding.UTF8.GetString(value);
+            else if (key.SequenceEqual("DEVTYPE"u8))
+                devType = Encoding.UTF8.GetString(value);
+        }
+
+        if (devPath == null || subsystem == null)
+            return;
+
+        switch (action)
+        {
+            case "add":
+                if (IsTracked(subsystem, devType, devName))
+                {
+                    var device = new HotplugDevice(subsystem, devPath, devName);
+                    if (_devices.TryAdd(devPath, device))
+                    {
+                        Raise(HotplugAction.Add, device);
+                    }
+                }
+                break;
+
+            case "remove":
+                if (_devices.TryRemove(devPath, out var removed))
+                {
+                    Raise(HotplugAction.Remove, removed);
+                }
+                break;
+        }
+    }
+
+    /// <summary>
+    /// Events are arriving: consumers may now rely on the inventory and cache their scans.
+    /// </summary>
+    private void MarkReceiving()
+    {
+        if (IsRunning)
+            return;
+
+        IsRunning = true;
+        _logger.LogDebug("Hotplug events are being received - device scans are now cached");
+    }
+
+    /// <summary>
+    /// Periodic rescan. Differences while events are arriving mean some were not delivered.
+    /// </summary>
+    private void Reconcile()
+    {
+        var changes = Rescan(raiseEvents: true);
+        if (changes > 0 && IsRunning)
+        {
+            _logger.LogWarning("Hotplug reconcile found {Count} device changes that were not reported as events", changes);
+        }
+        else if (changes > 0)
+        {
+            _logger.LogDebug("Hotplug reconcile found {Count} device changes (no events received yet)", changes);
+        }
+    }
+
+    /// <summary>
+    /// Rebuild the inventory from sysfs, raising events for anything that changed.
+    /// </summary>
+    /// <returns>Devices added or removed.</returns>
+    private int Rescan(bool raiseEvents)
+    {
+        lock (_scanLock)
+        {
+            var changes = 0;
+            var present = new Dictionary<string, HotplugDevice>(StringComparer.Ordinal);
+            foreach (var (subsystem, classPath) in SysfsSources)
+            {
+                if (!Directory.Exists(classPath))
+                    continue;
+
+                foreach (var entry in Directory.EnumerateFileSystemEntries(classPath))
+                {
+                    var device = ReadSysfsDevice(subsystem, entry);
+                    if (device != null)
+                    {
+                        present[device.DevPath] = device;
+                    }
+                }
+            }
+
+            foreach (var (devPath, device) in _devices)
+            {
+                if (!present.ContainsKey(devPath) && _devices.TryRemove(devPath, out _))
+                {
+                    changes++;
+                    if (raiseEvents)
+                        Raise(HotplugAction.Remove, device);
+                }
+            }
+
+            foreach (var (devPath, device) in present)
+            {
+                if (_devices.TryAdd(devPath, device))
+                {
+                    changes++;
+                    if (raiseEvents)
+                        Raise(HotplugAction.Add, device);
+                }
+            }
+
+            return changes;
+        }
+    }
+
+    private static HotplugDevice? ReadSysfsDevice(string subsystem, string entry)
+    {
+        try
+        {
+            // Class entries are links into /sys/devices; the link target is the DEVPATH
+            var info = new DirectoryInfo(entry);
+            var target = info.ResolveLinkTarget(returnFinalTarget: true) ?? info;
+            var fullPath = target.FullName;
+            if (!fullPath.StartsWith("/sys/", StringComparison.Ordinal))
+                return null;
+
+            string? devName = null, devType = null;
+            var ueventPath = Path.Combine(fullPath, "uevent");
+            if (File.Exists(ueventPath))
+            {
+                foreach (var line in File.ReadLines(ueventPath))
+                {
+                    if (line.StartsWith("DEVNAME=", StringComparison.Ordinal))
+                        devName = line[8..];
+                    else if (line.StartsWith("DEVTYPE=", StringComparison.Ordinal))
+                        devType = line[8..];
+                }
+            }
+
+            return IsTracked(subsystem, devType, devName)
+                ? new HotplugDevice(subsystem, fullPath[4..], devName)
+                : null;
+        }
+        catch
+        {
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Devices worth tracking: input event nodes (HID buttons), USB serial ports (CH340 relay
+    /// boards), hidraw nodes (HID relay boards) and whole USB devices (FTDI relay boards).
+    /// </summary>
+    private static bool IsTracked(string subsystem, string? devType, string? devName)
+    {
+        return subsystem switch
+        {
+            "input" => devName?.StartsWith("input/event", StringComparison.Ordinal) == true,
+            "tty" => devName != null &&
+                     (devName.StartsWith("ttyUSB", StringComparison.Ordinal) ||
+                      devName.StartsWith("ttyACM", StringComparison.Ordinal)),
+            "hidraw" => devName != null,
+            "usb" => devType == "usb_device",
+            _ => false
+        };
+    }
+
+    private void Raise(HotplugAction action, HotplugDevice device)
+    {
+        _logger.LogDebug("Hotplug {Action}: {Subsystem} {DevName} ({DevPath})",
+            action, device.Subsystem, device.DevName ?? "-", device.DevPath);
+
+        try
+        {
+            DeviceChanged?.Invoke(this, new HotplugEventArgs(action, device));
+        }
+        catch (Exception ex)
+        {
+            _logger.LogError(ex, "Hotplug handler failed for {DevPath}", device.DevPath);
+        }
+    }
+}
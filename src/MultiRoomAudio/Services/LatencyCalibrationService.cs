@@ -0,0 +1,283 @@
+using System.Collections.Concurrent;
+using MultiRoomAudio.Audio;
+using MultiRoomAudio.Audio.PulseAudio;
+using MultiRoomAudio.Exceptions;
+using MultiRoomAudio.Models;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Measures a player's true output latency by playing a known signal and finding it in a
+/// recording, then sets the player's delay offset to compensate.
+/// </summary>
+/// <remarks>
+/// <para>
+/// The player's clock sync already allows for the latency PulseAudio reports; what it cannot see
+/// is latency added after the sink (an AV receiver's DSP, a wireless link, the distance to the
+/// listener). Calibration plays an MLS or sweep on the player's sink and records it from a source.
+/// The signal player reports when PulseAudio says the first sample was heard, the capture reports
+/// when its first sample was recorded, and the FFT cross-correlation locates the signal in the
+/// recording. The difference is the unaccounted latency, and the suggested delay offset is its
+/// negative: a zone heard 40 ms late is advanced by 40 ms.
+/// </para>
+/// <para>
+/// Recording a sink's <c>.monitor</c> source measures an electrical loopback, which should come
+/// out near zero. To check the measurement locally, create two null sinks and delay one into the
+/// other with a loopback, then calibrate a player on the first while recording the second's monitor:
+/// <code>
+/// pactl load-module module-null-sink sink_name=calib_out
+/// pactl load-module module-null-sink sink_name=calib_in
+/// pactl load-module module-loopback source=calib_out.monitor sink=calib_in latency_msec=150
+/// </code>
+/// The offset should come out near 150 ms.
+/// </para>
+/// <para>
+/// Music playing on the player while calibrating is noise to the measurement and lowers the
+/// confidence; stopped or paused players calibrate best. A microphone should be close to the
+/// speaker: sound takes about 3 ms per metre.
+/// </para>
+/// </remarks>
+public class LatencyCalibrationService
+{
+    private readonly ILogger<LatencyCalibrationService> _logger;
+    private readonly PlayerManagerService _players;
+    private readonly ConfigurationService _config;
+    private readonly ToneGeneratorService _toneGenerator;
+    private readonly CustomSinksService _customSinks;
+    private readonly EnvironmentService _environment;
+
+    /// <summary>
+    /// Lowest confidence at which the result is applied (main peak 6 dB above any other).
+    /// </summary>
+    public const double MinConfidence = 0.5;
+
+    /// <summary>
+    /// Recording before the signal starts, so the capture is running when it arrives.
+    /// </summary>
+    private const int LeadInMs = 200;
+
+    /// <summary>
+    /// Largest offset that can be measured: recording continues this long after playback ends.
+    /// </summary>
+    private const int MaxOffsetMs = 1000;
+
+    /// <summary>
+    /// Room in the recording buffer for connection setup and draining.
+    /// </summary>
+    private const int RecordingSlackMs = 3000;
+
+    /// <summary>
+    /// Sweep length. An MLS always plays one period.
+    /// </summary>
+    private const int SweepDurationMs = 1000;
+
+    /// <summary>
+    /// Time allowed for the record stream to deliver its first data.
+    /// </summary>
+    private static readonly TimeSpan CaptureStartTimeout = TimeSpan.FromSeconds(5);
+
+    /// <summary>
+    /// PulseAudio's name for the default sink, for players without a device.
+    /// </summary>
+    private const string DefaultSink = "@DEFAULT_SINK@";
+
+    // Players being calibrated, to reject overlapping requests
+    private readonly ConcurrentDictionary<string, byte> _active = new(StringComparer.Ordinal);
+
+    public LatencyCalibrationService(
+        ILogger<LatencyCalibrationService> logger,
+        PlayerManagerService players,
+        ConfigurationService config,
+        ToneGeneratorService toneGenerator,
+        CustomSinksService customSinks,
+        EnvironmentService environment)
+    {
+        _logger = logger;
+        _players = players;
+        _config = config;
+        _toneGenerator = toneGenerator;
+        _customSinks = customSinks;
+        _environment = environment;
+    }
+
+    /// <summary>
+    /// Measures a player's output latency and optionally applies the compensating delay offset.
+    /// </summary>
+    /// <param name="name">Player name.</param>
+    /// <param name="request">Source, signal and whether to apply the result.</param>
+    /// <param name="ct">Cancellation token.</param>
+    /// <exception cref="ArgumentException">The player does not exist or the request is invalid.</exception>
+    /// <exception cref="OperationInProgressException">The player is already being calibrated.</exception>
+    /// <exception cref="InvalidOperationException">Nothing usable was recorded.</exception>
+    public async Task<LatencyCalibrationResult> CalibrateAsync(
+        string name,
+        LatencyCalibrationRequest request,
+        CancellationToken ct = default)
+    {
+        var player = _players.GetPlayer(name)
+            ?? throw new ArgumentException($"Player '{name}' not found");
+
+        if (request.Signal is not (TestSignal.Mls or TestSignal.LogSweep))
+            throw new ArgumentException("Latency calibration needs an Mls or LogSweep signal");
+
+        var sink = ResolveSink(player.Device);
+
+        if (!_active.TryAdd(name, 0))
+            throw new OperationInProgressException("Latency calibration");
+
+        try
+        {
+            _logger.LogInformation("Calibrating latency of '{Name}': {Signal} on {Sink}, recording from {Source}",
+                name, request.Signal, sink, request.Source ?? "default source");
+
+            if (_environment.IsMockHardware)
+            {
+                // Nothing was measured, so never apply: that would overwrite the user's offset with 0
+                await Task.Delay(100, ct);
+                var mockPeak = new CorrelationPeak(0, 1, 120, false);
+                return Complete(name, player, sink, request with { Apply = false }, 0, mockPeak,
+                    "Mock hardware: no audio was played and nothing was applied");
+            }
+
+            var (offsetMs, peak) = await MeasureAsync(sink, request, ct);
+            return Complete(name, player, sink, request, offsetMs, peak, null);
+        }
+        finally
+        {
+            _active.TryRemove(name, out _);
+        }
+    }
+
+    /// <summary>
+    /// Plays the signal while recording and returns how much later it arrived than PulseAudio expected.
+    /// </summary>
+    private async Task<(double OffsetMs, CorrelationPeak Peak)> MeasureAsync(
+        string sink,
+        LatencyCalibrationRequest request,
+        CancellationToken ct)
+    {
+        const int rate = ToneGeneratorService.SampleRate;
+        var reference = Render(CreateGenerator(request.Signal));
+        var maxFrames = reference.Length + (int)((long)rate * (LeadInMs + MaxOffsetMs + RecordingSlackMs) / 1000);
+
+        using var capture = PulseAudioCapture.Start(_logger, request.Source, rate, maxFrames);
+        await capture.FirstData.WaitAsync(CaptureStartTimeout, ct);
+        await Task.Delay(LeadInMs, ct);
+
+        var playStartUs = await _toneGenerator.PlayMeasurementAsync(sink, CreateGenerator(request.Signal), ct);
+        await Task.Delay(MaxOffsetMs, ct);
+
+        var (recording, captureStartUs) = capture.Stop();
+        if (playStartUs == null || captureStartUs == null)
+            throw new InvalidOperationException("PulseAudio reported no stream timing, so the latency cannot be measured");
+
+        var peak = CrossCorrelator.FindDelay(recording, reference, rate)
+            ?? throw new InvalidOperationException(
+                $"Nothing was recorded from {request.Source ?? "the default source"}");
+
+        var arrivalUs = captureStartUs.Value + peak.DelayFrames * 1_000_000.0 / rate;
+        var offsetMs = (arrivalUs - playStartUs.Value) / 1000.0;
+
+        _logger.LogDebug("Calibration on {Sink}: signal found {Delay:F1} frames into {Frames} recorded, " +
+            "offset {Offset:F2}ms, confidence {Confidence:F2} ({Psr:F1} dB)",
+            sink, peak.DelayFrames, recording.Length, offsetMs, peak.Confidence, peak.PeakToSidelobeDb);
+
+        return (offsetMs, peak);
+    }
+
+    private LatencyCalibrationResult Complete(
+        string name,
+        PlayerResponse player,
+        string sink,
+        LatencyCalibrationRequest request,
+        double offsetMs,
+        CorrelationPeak peak,
+        string? note)
+    {
+        var suggested = Math.Clamp((int)Math.Round(-offsetMs), -5000, 5000);
+        int? reportedLatencyMs = player.OutputLatencyMs > 0 ? player.OutputLatencyMs : null;
+
+        var applied = false;
+        string message;
+        if (peak.Confidence < MinConfidence)
+        {
+            message = $"Measurement not clear enough to apply (confidence {peak.Confidence:F2}, " +
+                      $"needs {MinConfidence:F2}). Check the source level and reduce background noise.";
+        }
+        else if (Math.Abs(offsetMs) > MaxOffsetMs)
+        {
+            message = $"Measured offset {offsetMs:F1}ms is outside the measurable range of ±{MaxOffsetMs}ms";
+        }
+        else if (request.Apply)
+        {
+            // Same as PUT /offset: apply to the running player and persist
+            applied = _players.SetDelayOffset(name, suggested);
+            if (applied)
+                _config.UpdatePlayerField(name, c => c.DelayMs = suggested);
+
+            message = applied
+                ? $"Delay offset set to {suggested}ms"
+                : $"Player '{name}' is not running; delay offset not applied";
+        }
+        else
+        {
+            message = $"Suggested delay offset: {suggested}ms";
+        }
+
+        if (note != null)
+            message = $"{note}. {message}";
+
+        _logger.LogInformation("Latency calibration of '{Name}': offset {Offset:F1}ms, confidence {Confidence:F2}, " +
+            "delay {Previous}ms -> {Suggested}ms ({Outcome})",
+            name, offsetMs, peak.Confidence, player.DelayMs, suggested, applied ? "applied" : "not applied");
+
+        return new LatencyCalibrationResult(
+            PlayerName: name,
+            Sink: sink,
+            Source: request.Source,
+            Signal: request.Signal,
+            OffsetMs: Math.Round(offsetMs, 2),
+            ReportedLatencyMs: reportedLatencyMs,
+            OutputLatencyMs: reportedLatencyMs + Math.Round(offsetMs, 2),
+            Confidence: Math.Round(peak.Confidence, 3),
+            PeakToSidelobeDb: Math.Round(peak.PeakToSidelobeDb, 1),
+            Inverted: peak.Inverted,
+            SuggestedDelayMs: suggested,
+            PreviousDelayMs: player.DelayMs,
+            Applied: applied,
+            Message: message);
+    }
+
+    /// <summary>
+    /// The PulseAudio sink a player's audio ends up on.
+    /// </summary>
+    private string ResolveSink(string? device)
+    {
+        if (string.IsNullOrEmpty(device))
+            return DefaultSink;
+
+        var custom = _customSinks.GetSink(device);
+        if (custom?.InProcess != true)
+            return device;
+
+        // In-process zones have no sink of their own; their latency is the card's
+        if (string.IsNullOrEmpty(custom.MasterSink))
+            throw new ArgumentException($"Zone '{device}' plays to several outputs; calibrate a player on each output instead");
+
+        return custom.MasterSink;
+    }
+
+    private static SignalGenerator CreateGenerator(TestSignal signal)
+    {
+        // One MLS period: more would add correlation peaks a period away from the arrival
+        var durationMs = signal == TestSignal.Mls ? 1 : SweepDurationMs;
+        return new SignalGenerator(signal, ToneGeneratorService.SampleRate, durationMs);
+    }
+
+    private static float[] Render(SignalGenerator generator)
+    {
+        var samples = new float[generator.TotalFrames];
+        generator.Read(samples);
+        return samples;
+    }
+}
@@ -0,0 +1,611 @@
+using System.IO.Compression;
+using System.IO.MemoryMappedFiles;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Position in the archive after the last entry of a page.
+/// </summary>
+/// <remarks>
+/// Archived entries have no sequence number and several can share a timestamp, so the cursor
+/// is the last entry's timestamp plus how many matching entries at that timestamp were already
+/// returned. The next page starts at the timestamp (inclusive) and skips that many.
+/// Serialized as <c>{ticks}-{count}</c>.
+/// </remarks>
+/// <param name="Ticks">Timestamp (UTC ticks) of the last entry returned.</param>
+/// <param name="Returned">Matching entries at <paramref name="Ticks"/> already returned.</param>
+public readonly record struct LogArchiveCursor(long Ticks, int Returned)
+{
+    public override string ToString() => $"{Ticks}-{Returned}";
+
+    public static bool TryParse(string? value, out LogArchiveCursor cursor)
+    {
+        cursor = default;
+        var separator = value?.LastIndexOf('-') ?? -1;
+        if (separator <= 0 ||
+            !long.TryParse(value.AsSpan(0, separator), out var ticks) ||
+            !int.TryParse(value.AsSpan(separator + 1), out var returned) ||
+            returned < 1)
+            return false;
+
+        cursor = new LogArchiveCursor(ticks, returned);
+        return true;
+    }
+}
+
+/// <summary>
+/// One page of archived log entries.
+/// </summary>
+/// <param name="Entries">Matching entries in the requested order.</param>
+/// <param name="NextCursor">Cursor for the next page, or null if this is the last page.</param>
+/// <param name="BlocksScanned">Index records examined.</param>
+/// <param name="BlocksDecompressed">Blocks actually read and decompressed.</param>
+public record LogArchiveQueryResult(
+    IReadOnlyList<LogEntry> Entries,
+    LogArchiveCursor? NextCursor,
+    int BlocksScanned,
+    int BlocksDecompressed
+);
+
+/// <summary>
+/// Size and time span of the on-disk log archive.
+/// </summary>
+public record LogArchiveStats(
+    int SegmentCount,
+    long TotalBytes,
+    DateTime? OldestEntry,
+    DateTime? NewestEntry
+);
+
+/// <summary>
+/// Compressed, segmented on-disk log archive with a per-block index.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Entries are grouped into blocks of up to <see cref="MaxBlockEntries"/> entries. Each block
+/// is gzip-compressed on its own and appended to the current segment file (*.seg). For each
+/// block, a fixed-size record is appended to the segment's index file (*.idx): file offset,
+/// time range, and bitmasks of the levels and categories it contains.
+/// </para>
+/// <para>
+/// A query memory-maps the index of each segment in the time range. It decompresses only the
+/// blocks whose time range and level/category masks can match, so reading a few minutes from
+/// last night touches only a handful of blocks out of days of history.
+/// </para>
+/// <para>
+/// Segments rotate daily or at <see cref="MaxSegmentBytes"/>. The oldest segments are deleted
+/// beyond <see cref="MaxArchiveAge"/> or <see cref="MaxArchiveBytes"/>. The block being
+/// filled stays in memory and is flushed when it fills, after <see cref="MaxBlockAge"/>, or
+/// on shutdown; queries include it.
+/// </para>
+/// </remarks>
+public sealed class LogArchive : IDisposable
+{
+    /// <summary>
+    /// Index record per block. Layout is the on-disk format - do not reorder.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Pack = 1)]
+    private struct BlockIndexRecord
+    {
+        public long Offset;
+        public int CompressedLength;
+        public int EntryCount;
+        public long MinTicks;
+        public long MaxTicks;
+        public ushort LevelMask;
+        public ushort CategoryMask;
+    }
+
+    private sealed record Segment(string DataPath, string IndexPath, long StartTicks);
+
+    private static readonly int IndexRecordSize = Marshal.SizeOf<BlockIndexRecord>();
+
+    private const string ArchiveDirectoryName = "archive";
+    private const string SegmentExtension = ".seg";
+    private const string IndexExtension = ".idx";
+    private const int MaxBlockEntries = 1000;
+    private const long MaxSegmentBytes = 4 * 1024 * 1024;      // 4MB compressed
+    private const long MaxArchiveBytes = 64 * 1024 * 1024;     // 64MB compressed (weeks of logs)
+    private static readonly TimeSpan MaxArchiveAge = TimeSpan.FromDays(14);
+    private static readonly TimeSpan MaxBlockAge = TimeSpan.FromSeconds(30);
+
+    private readonly string _directory;
+    private readonly object _writeLock = new();
+    private readonly List<LogEntry> _pending = new(MaxBlockEntries);
+    private readonly Timer _flushTimer;
+    private DateTime _pendingSince;
+    private Segment? _current;
+    private FileStream? _dataStream;
+    private FileStream? _indexStream;
+    private bool _disposed;
+
+    public LogArchive(string logDirectory)
+    {
+        _directory = Path.Combine(logDirectory, ArchiveDirectoryName);
+        _flushTimer = new Timer(_ => FlushIfStale(), null, MaxBlockAge, MaxBlockAge);
+    }
+
+    /// <summary>
+    /// Adds entries to the archive. Called from the log consumer thread.
+    /// </summary>
+    public void Append(IReadOnlyList<LogEntry> entries)
+    {
+        lock (_writeLock)
+        {
+            if (_disposed)
+                return;
+
+            foreach (var entry in entries)
+            {
+                if (_pending.Count == 0)
+                    _pendingSince = DateTime.UtcNow;
+
+                _pending.Add(entry);
+                if (_pending.Count >= MaxBlockEntries)
+                    FlushBlock();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Queries the archive. The cursor is the previous page's <see cref="LogArchiveQueryResult.NextCursor"/>:
+    /// newest-first continues with older entries, oldest-first with newer ones.
+    /// <see cref="LogQueryOptions.Cursor"/> is not used.
+    /// </summary>
+    public LogArchiveQueryResult Query(LogQueryOptions options, LogArchiveCursor? cursor = null)
+    {
+        var lowerTicks = options.StartTime?.ToUniversalTime().Ticks ?? long.MinValue;
+        var upperTicks = options.EndTime?.ToUniversalTime().Ticks ?? long.MaxValue;
+        if (cursor.HasValue)
+        {
+            // Inclusive: entries sharing the cursor's timestamp may not all have been returned
+            if (options.NewestFirst)
+                upperTicks = Math.Min(upperTicks, cursor.Value.Ticks);
+            else
+                lowerTicks = Math.Max(lowerTicks, cursor.Value.Ticks);
+        }
+
+        var levelMask = GetLevelMask(options.MinLevel);
+        var categoryMask = options.Category.HasValue ? (ushort)(1 << (int)options.Category.Value) : ushort.MaxValue;
+        var take = Math.Max(0, options.Take);
+        var results = new List<LogEntry>();
+        var skipped = 0;
+        var skippedAtCursor = 0;
+        var scanned = 0;
+        var decompressed = 0;
+        var hasMore = false;
+
+        // Returns false once the page is full
+        bool Collect(IEnumerable<LogEntry> blockEntries)
+        {
+            foreach (var entry in blockEntries)
+            {
+                if (!Matches(entry, options, lowerTicks, upperTicks))
+                    continue;
+                if (cursor.HasValue && skippedAtCursor < cursor.Value.Returned &&
+                    entry.Timestamp.ToUniversalTime().Ticks == cursor.Value.Ticks)
+                {
+                    skippedAtCursor++;
+                    continue;
+                }
+                if (skipped < options.Skip)
+                {
+                    skipped++;
+                    continue;
+                }
+                if (results.Count == take)
+                {
+                    hasMore = true;
+                    return false;
+                }
+                results.Add(entry);
+            }
+            return true;
+        }
+
+        List<LogEntry> pending;
+        lock (_writeLock)
+        {
+            pending = _pending.ToList();
+        }
+
+        // Newest data is the in-memory block, then segments newest to oldest
+        if (options.NewestFirst && !Collect(Enumerable.Reverse(pending)))
+            return Page();
+
+        var segments = ListSegments();
+        if (options.NewestFirst)
+            segments.Reverse();
+
+        for (var s = 0; s < segments.Count; s++)
+        {
+            var segment = segments[s];
+
+            // Segment covers [start, next segment start)
+            if (segment.StartTicks > upperTicks)
+                continue;
+            var nextStart = options.NewestFirst
+                ? (s > 0 ? segments[s - 1].StartTicks : long.MaxValue)
+                : (s + 1 < segments.Count ? segments[s + 1].StartTicks : long.MaxValue);
+            if (nextStart <= lowerTicks)
+                continue;
+
+            var blocks = ReadIndex(segment);
+            scanned += blocks.Count;
+
+            var candidates = blocks
+                .Where(b => b.MaxTicks >= lowerTicks && b.MinTicks <= upperTicks &&
+                            (b.LevelMask & levelMask) != 0 && (b.CategoryMask & categoryMask) != 0);
+            if (options.NewestFirst)
+                candidates = candidates.Reverse();
+
+            foreach (var block in candidates)
+            {
+                var entries = ReadBlock(segment, block);
+                decompressed++;
+                if (options.NewestFirst)
+                    entries.Reverse();
+                if (!Collect(entries))
+                    return Page();
+            }
+        }
+
+        if (!options.NewestFirst)
+            Collect(pending);
+
+        return Page();
+
+        LogArchiveQueryResult Page()
+        {
+            if (!hasMore || results.Count == 0)
+                return new LogArchiveQueryResult(results, null, scanned, decompressed);
+
+            // Count the page's entries at its last timestamp, plus those skipped at the same cursor
+            var lastTicks = results[^1].Timestamp.ToUniversalTime().Ticks;
+            var returned = 0;
+            for (var i = results.Count - 1; i >= 0 && results[i].Timestamp.ToUniversalTime().Ticks == lastTicks; i--)
+                returned++;
+            if (cursor?.Ticks == lastTicks)
+                returned += skippedAtCursor;
+
+            return new LogArchiveQueryResult(results, new LogArchiveCursor(lastTicks, returned), scanned, decompressed);
+        }
+    }
+
+    /// <summary>
+    /// Gets the size and time span of the archive.
+    /// </summary>
+    public LogArchiveStats GetStats()
+    {
+        var segments = ListSegments();
+        long totalBytes = 0;
+        long? oldest = null;
+        long? newest = null;
+
+        foreach (var segment in segments)
+        {
+            totalBytes += FileLength(segment.DataPath) + FileLength(segment.IndexPath);
+            var blocks = ReadIndex(segment);
+            if (blocks.Count == 0)
+                continue;
+            oldest ??= blocks[0].MinTicks;
+            newest = blocks[^1].MaxTicks;
+        }
+
+        lock (_writeLock)
+        {
+            if (_pending.Count > 0)
+            {
+                oldest ??= _pending[0].Timestamp.Ticks;
+                newest = _pending[^1].Timestamp.Ticks;
+            }
+        }
+
+        return new LogArchiveStats(
+            segments.Count,
+            totalBytes,
+            oldest.HasValue ? new DateTime(oldest.Value, DateTimeKind.Utc) : null,
+            newest.HasValue ? new DateTime(newest.Value, DateTimeKind.Utc) : null);
+    }
+
+    /// <summary>
+    /// Deletes all archived logs.
+    /// </summary>
+    public void Clear()
+    {
+        lock (_writeLock)
+        {
+            _pending.Clear();
+            CloseSegment();
+            foreach (var segment in ListSegments())
+                DeleteSegment(segment);
+        }
+    }
+
+    private void FlushIfStale()
+    {
+        lock (_writeLock)
+        {
+            if (!_disposed && _pending.Count > 0 && DateTime.UtcNow - _pendingSince >= MaxBlockAge)
+                FlushBlock();
+        }
+    }
+
+    /// <summary>
+    /// Compresses the pending block and appends it to the current segment. Caller holds the write lock.
+    /// </summary>
+    private void FlushBlock()
+    {
+        if (_pending.Count == 0)
+            return;
+
+        try
+        {
+            EnsureSegment(_pending[0].Timestamp);
+
+            var record = new BlockIndexRecord
+            {
+                Offset = _dataStream!.Length,
+                EntryCount = _pending.Count,
+                MinTicks = long.MaxValue,
+                MaxTicks = long.MinValue
+            };
+
+            using var buffer = new MemoryStream();
+            using (var gzip = new GZipStream(buffer, CompressionLevel.Optimal, leaveOpen: true))
+            using (var writer = new BinaryWriter(gzip, Encoding.UTF8))
+            {
+                foreach (var entry in _pending)
+                {
+                    var ticks = entry.Timestamp.ToUniversalTime().Ticks;
+                    record.MinTicks = Math.Min(record.MinTicks, ticks);
+                    record.MaxTicks = Math.Max(record.MaxTicks, ticks);
+                    record.LevelMask |= (ushort)(1 << (int)entry.Level);
+                    record.CategoryMask |= (ushort)(1 << (int)entry.Category);
+
+                    writer.Write(ticks);
+                    writer.Write((byte)entry.Level);
+                    writer.Write((byte)entry.Category);
+                    writer.Write(entry.Message);
+                    writer.Write(entry.Exception != null);
+                    if (entry.Exception != null)
+                        writer.Write(entry.Exception);
+                }
+            }
+
+            record.CompressedLength = (int)buffer.Length;
+
+            // Data first, then the index record - readers only see fully written blocks
+            _dataStream.Seek(0, SeekOrigin.End);
+            buffer.Position = 0;
+            buffer.CopyTo(_dataStream);
+            _dataStream.Flush();
+
+            Span<byte> recordBytes = stackalloc byte[IndexRecordSize];
+            MemoryMarshal.Write(recordBytes, in record);
+            _indexStream!.Seek(0, SeekOrigin.End);
+            _indexStream.Write(recordBytes);
+            _indexStream.Flush();
+
+            if (_dataStream.Length >= MaxSegmentBytes)
+                CloseSegment();
+        }
+        catch (Exception)
+        {
+            // Archive is best effort - the plain text log still has these entries
+            CloseSegment();
+        }
+        finally
+        {
+            _pending.Clear();
+        }
+    }
+
+    /// <summary>
+    /// Opens the segment for a block, rotating daily. Caller holds the write lock.
+    /// </summary>
+    private void EnsureSegment(DateTime blockStart)
+    {
+        var utcStart = blockStart.ToUniversalTime();
+        if (_current != null && new DateTime(_current.StartTicks, DateTimeKind.Utc).Date == utcStart.Date)
+            return;
+
+        CloseSegment();
+        Directory.CreateDirectory(_directory);
+        ApplyRetention();
+
+        var name = $"log-{utcStart.Ticks:D19}";
+        _current = new Segment(
+            Path.Combine(_directory, name + SegmentExtension),
+            Path.Combine(_directory, name + IndexExtension),
+            utcStart.Ticks);
+        _dataStream = new FileStream(_current.DataPath, FileMode.Append, FileAccess.Write, FileShare.ReadWrite | FileShare.Delete);
+        _indexStream = new FileStream(_current.IndexPath, FileMode.Append, FileAccess.Write, FileShare.ReadWrite | FileShare.Delete);
+    }
+
+    private void CloseSegment()
+    {
+        _dataStream?.Dispose();
+        _indexStream?.Dispose();
+        _dataStream = null;
+        _indexStream = null;
+        _current = null;
+    }
+
+    /// <summary>
+    /// Deletes segments beyond the age and size limits (oldest first).
+    /// </summary>
+    private void ApplyRetention()
+    {
+        var segments = ListSegments();
+        var cutoff = (DateTime.UtcNow - MaxArchiveAge).Ticks;
+        var totalBytes = segments.Sum(s => FileLength(s.DataPath) + FileLength(s.IndexPath));
+
+        for (var i = 0; i < segments.Count; i++)
+        {
+            // A segment is expired once the next one started before the cutoff
+            var expired = i + 1 < segments.Count && segments[i + 1].StartTicks < cutoff;
+            if (!expired && totalBytes <= MaxArchiveBytes)
+                break;
+
+            totalBytes -= FileLength(segments[i].DataPath) + FileLength(segments[i].IndexPath);
+            DeleteSegment(segments[i]);
+        }
+    }
+
+    private List<Segment> ListSegments()
+    {
+        if (!Directory.Exists(_directory))
+            return new List<Segment>();
+
+        var segments = new List<Segment>();
+        foreach (var dataPath in Directory.GetFiles(_directory, "log-*" + SegmentExtension))
+        {
+            var name = Path.GetFileNameWithoutExtension(dataPath);
+            if (long.TryParse(name.AsSpan(4), out var startTicks))
+            {
+                segments.Add(new Segment(dataPath, Path.ChangeExtension(dataPath, IndexExtension), startTicks));
+            }
+        }
+
+        segments.Sort((a, b) => a.StartTicks.CompareTo(b.StartTicks));
+        return segments;
+    }
+
+    /// <summary>
+    /// Reads a segment's block index through a read-only memory map.
+    /// </summary>
+    private static List<BlockIndexRecord> ReadIndex(Segment segment)
+    {
+        var records = new List<BlockIndexRecord>();
+        try
+        {
+            using var stream = new FileStream(segment.IndexPath, FileMode.Open, FileAccess.Read,
+                FileShare.ReadWrite | FileShare.Delete);
+
+            // Only complete records - the writer may be appending
+            var count = stream.Length / IndexRecordSize;
+            if (count == 0)
+                return records;
+
+            using var map = MemoryMappedFile.CreateFromFile(stream, null, count * IndexRecordSize,
+                MemoryMappedFileAccess.Read, HandleInheritability.None, leaveOpen: true);
+            using var accessor = map.CreateViewAccessor(0, count * IndexRecordSize, MemoryMappedFileAccess.Read);
+
+            for (long i = 0; i < count; i++)
+            {
+                accessor.Read(i * IndexRecordSize, out BlockIndexRecord record);
+                records.Add(record);
+            }
+        }
+        catch (IOException)
+        {
+            // Segment deleted or unreadable - treat as empty
+        }
+        catch (UnauthorizedAccessException)
+        {
+        }
+
+        return records;
+    }
+
+    private static List<LogEntry> ReadBlock(Segment segment, BlockIndexRecord block)
+    {
+        var entries = new List<LogEntry>(block.EntryCount);
+        try
+        {
+            var compressed = new byte[block.CompressedLength];
+            using (var stream = new FileStream(segment.DataPath, FileMode.Open, FileAccess.Read,
+                       FileShare.ReadWrite | FileShare.Delete))
+            {
+                stream.Seek(block.Offset, SeekOrigin.Begin);
+                stream.ReadExactly(compressed);
+            }
+
+            using var gzip = new GZipStream(new MemoryStream(compressed), CompressionMode.Decompress);
+            using var reader = new BinaryReader(gzip, Encoding.UTF8);
+            for (var i = 0; i < block.EntryCount; i++)
+            {
+                var ticks = reader.ReadInt64();
+                var level = (LogLevel)reader.ReadByte();
+                var category = (LogCategory)reader.ReadByte();
+                var message = reader.ReadString();
+                var exception = reader.ReadBoolean() ? reader.ReadString() : null;
+                entries.Add(new LogEntry(new DateTime(ticks, DateTimeKind.Utc), level, category, message, exception));
+            }
+        }
+        catch (Exception ex) when (ex is IOException or InvalidDataException or EndOfStreamException)
+        {
+            // Corrupt or deleted block - return what was decoded
+        }
+
+        return entries;
+    }
+
+    private static bool Matches(LogEntry entry, LogQueryOptions options, long lowerTicks, long upperTicks)
+    {
+        var ticks = entry.Timestamp.ToUniversalTime().Ticks;
+        if (ticks < lowerTicks || ticks > upperTicks)
+            return false;
+        if (options.MinLevel.HasValue && entry.Level < options.MinLevel.Value)
+            return false;
+        if (options.Category.HasValue && entry.Category != options.Category.Value)
+            return false;
+        if (!string.IsNullOrWhiteSpace(options.SearchText) &&
+            !entry.Message.Contains(options.SearchText, StringComparison.OrdinalIgnoreCase) &&
+            !(entry.Exception?.Contains(options.SearchText, StringComparison.OrdinalIgnoreCase) ?? false))
+            return false;
+        return true;
+    }
+
+    private static ushort GetLevelMask(LogLevel? minLevel)
+    {
+        if (!minLevel.HasValue)
+            return ushort.MaxValue;
+
+        ushort mask = 0;
+        for (var level = (int)minLevel.Value; level <= (int)LogLevel.None; level++)
+            mask |= (ushort)(1 << level);
+        return mask;
+    }
+
+    private static long FileLength(string path)
+    {
+        try
+        {
+            return new FileInfo(path).Length;
+        }
+        catch (IOException)
+        {
+            return 0;
+        }
+    }
+
+    private static void DeleteSegment(Segment segment)
+    {
+        try
+        {
+            File.Delete(segment.DataPath);
+            File.Delete(segment.IndexPath);
+        }
+        catch
+        {
+            // Ignore - retried on next rotation
+        }
+    }
+
+    public void Dispose()
+    {
+        _flushTimer.Dispose();
+        lock (_writeLock)
+        {
+            if (_disposed)
+                return;
+            FlushBlock();
+            CloseSegment();
+            _disposed = true;
+        }
+    }
+}
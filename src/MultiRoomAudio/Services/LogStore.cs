@@ -0,0 +1,459 @@
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// One page of log query results.
+/// </summary>
+/// <param name="Entries">Matching entries in the requested order.</param>
+/// <param name="TotalCount">Total matching entries (ignoring pagination).</param>
+/// <param name="NextCursor">Cursor for the next page, or null if this is the last page.</param>
+public record LogQueryResult(
+    IReadOnlyList<LogEntry> Entries,
+    int TotalCount,
+    long? NextCursor
+);
+
+/// <summary>
+/// Fixed-capacity in-memory log store with per-level and per-category indexes.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Every entry gets a sequence number in append order (entries arrive through the single log
+/// consumer). That is nearly, but not exactly, time order: producers stamp the time before they
+/// enqueue, so a thread preempted in between lands behind later-stamped entries. The main ring
+/// holds the entries. For each
+/// level and each category there is an index ring with the sequence numbers of entries
+/// with that level or category. Running counters per level and per category make stats
+/// and most total counts O(1).
+/// </para>
+/// <para>
+/// Queries walk only the relevant index rings. They merge the rings for a minimum level, and
+/// narrow a time range by binary search widened by <see cref="MaxReorder"/>, then check each
+/// entry's timestamp. Results come out in sequence order. Cursors are sequence numbers, so
+/// paging deep into the log does not re-scan the pages before it.
+/// </para>
+/// <para>
+/// Writers serialize on a private lock. Readers take no lock. Each ring slot stores its
+/// sequence number, so a reader can tell when a slot has been overwritten during a query
+/// and treats that entry as evicted.
+/// </para>
+/// </remarks>
+public sealed class LogStore
+{
+    private sealed record Slot(long Seq, LogEntry Entry);
+
+    private static readonly int LevelCount = (int)LogLevel.None + 1;
+    private static readonly int CategoryCount = Enum.GetValues<LogCategory>().Length;
+
+    /// <summary>
+    /// Largest assumed gap between an entry's timestamp and a later-appended entry's timestamp
+    /// (time from stamping to enqueue). Time-range searches are widened by this much.
+    /// </summary>
+    private static readonly TimeSpan MaxReorder = TimeSpan.FromSeconds(1);
+
+    private readonly int _capacity;
+    private readonly Slot?[] _slots;
+    private readonly SeqRing[] _levelIndex;
+    private readonly SeqRing[] _categoryIndex;
+    private readonly int[] _levelCounts;
+    private readonly int[] _categoryCounts;
+    private readonly object _writeLock = new();
+    private long _firstSeq;
+    private long _nextSeq;
+
+    public LogStore(int capacity)
+    {
+        _capacity = capacity;
+        _slots = new Slot?[capacity];
+        _levelIndex = Enumerable.Range(0, LevelCount).Select(_ => new SeqRing(capacity)).ToArray();
+        _categoryIndex = Enumerable.Range(0, CategoryCount).Select(_ => new SeqRing(capacity)).ToArray();
+        _levelCounts = new int[LevelCount];
+        _categoryCounts = new int[CategoryCount];
+    }
+
+    /// <summary>
+    /// Number of entries currently held.
+    /// </summary>
+    public int Count => (int)(Volatile.Read(ref _nextSeq) - Volatile.Read(ref _firstSeq));
+
+    /// <summary>
+    /// Appends an entry, evicting the oldest when full.
+    /// </summary>
+    public void Append(LogEntry entry)
+    {
+        lock (_writeLock)
+        {
+            var seq = _nextSeq;
+
+            if (seq - _firstSeq == _capacity)
+            {
+                // Advance the start before the slot is reused so readers see it as evicted
+                var evicted = _slots[_firstSeq % _capacity]?.Entry;
+                if (evicted != null)
+                {
+                    Interlocked.Decrement(ref _levelCounts[(int)evicted.Level]);
+                    Interlocked.Decrement(ref _categoryCounts[(int)evicted.Category]);
+                }
+                Volatile.Write(ref _firstSeq, _firstSeq + 1);
+            }
+
+            Volatile.Write(ref _slots[seq % _capacity], new Slot(seq, entry));
+            _levelIndex[(int)entry.Level].Add(seq);
+            _categoryIndex[(int)entry.Category].Add(seq);
+            Interlocked.Increment(ref _levelCounts[(int)entry.Level]);
+            Interlocked.Increment(ref _categoryCounts[(int)entry.Category]);
+
+            // Publish last: readers never see a sequence number whose slot isn't written
+            Volatile.Write(ref _nextSeq, seq + 1);
+        }
+    }
+
+    /// <summary>
+    /// Removes all entries. Sequence numbers keep increasing, so old cursors stay valid.
+    /// </summary>
+    public void Clear()
+    {
+        lock (_writeLock)
+        {
+            Volatile.Write(ref _firstSeq, _nextSeq);
+            Array.Clear(_levelCounts);
+            Array.Clear(_categoryCounts);
+        }
+    }
+
+    /// <summary>
+    /// Runs a query: one page of entries plus the total match count.
+    /// </summary>
+    public LogQueryResult Query(LogQueryOptions options)
+    {
+        var take = Math.Max(0, options.Take);
+        var entries = new List<LogEntry>(Math.Min(take, 512));
+        long? nextCursor = null;
+        var skipped = 0;
+
+        foreach (var (seq, entry) in Matches(options, options.Cursor))
+        {
+            if (skipped < options.Skip)
+            {
+                skipped++;
+                continue;
+            }
+
+            if (entries.Count == take)
+            {
+                // At least one more match exists - page continues after the last returned entry
+                nextCursor = GetCursorIncluding(seq, options.NewestFirst);
+                break;
+            }
+
+            entries.Add(entry);
+        }
+
+        return new LogQueryResult(entries, CountMatches(options), nextCursor);
+    }
+
+    /// <summary>
+    /// Counts entries matching the filters (ignoring cursor and pagination).
+    /// </summary>
+    public int CountMatches(LogQueryOptions options)
+    {
+        var hasText = !string.IsNullOrWhiteSpace(options.SearchText);
+        var hasTime = options.StartTime.HasValue || options.EndTime.HasValue;
+
+        // Counter fast paths: at most one indexed filter, nothing that needs the entries
+        if (!hasText && !hasTime)
+        {
+            if (!options.MinLevel.HasValue && !options.Category.HasValue)
+                return Count;
+            if (options.MinLevel.HasValue && !options.Category.HasValue)
+                return SumLevelCounts(options.MinLevel.Value);
+            if (options.Category.HasValue && !options.MinLevel.HasValue)
+                return Math.Max(0, Volatile.Read(ref _categoryCounts[(int)options.Category.Value]));
+        }
+
+        var count = 0;
+        foreach (var _ in Matches(options, cursor: null))
+        {
+            count++;
+        }
+        return count;
+    }
+
+    /// <summary>
+    /// Gets counts by level and category from the running counters.
+    /// </summary>
+    public LogStats GetStats()
+    {
+        var byLevel = new Dictionary<string, int>();
+        for (var i = 0; i < LevelCount; i++)
+        {
+            var count = Volatile.Read(ref _levelCounts[i]);
+            if (count > 0)
+                byLevel[((LogLevel)i).ToString()] = count;
+        }
+
+        var byCategory = new Dictionary<string, int>();
+        for (var i = 0; i < CategoryCount; i++)
+        {
+            var count = Volatile.Read(ref _categoryCounts[i]);
+            if (count > 0)
+                byCategory[((LogCategory)i).ToString()] = count;
+        }
+
+        var first = Volatile.Read(ref _firstSeq);
+        var next = Volatile.Read(ref _nextSeq);
+        DateTime? oldest = null;
+        DateTime? newest = null;
+        if (next > first)
+        {
+            // Oldest may be evicted between reads - then the next one is the oldest
+            for (var seq = first; seq < next && oldest == null; seq++)
+                oldest = TryGet(seq)?.Timestamp;
+            newest = TryGet(next - 1)?.Timestamp;
+        }
+
+        return new LogStats(byLevel, byCategory, (int)(next - first), oldest, newest);
+    }
+
+    /// <summary>
+    /// Enumerates matching entries in the requested order, starting after the cursor.
+    /// </summary>
+    private IEnumerable<(long Seq, LogEntry Entry)> Matches(LogQueryOptions options, long? cursor)
+    {
+        var lo = Volatile.Read(ref _firstSeq);
+        var hi = Volatile.Read(ref _nextSeq);
+
+        // Time bounds via binary search, widened because append order is only nearly time order;
+        // entries inside the widened range are checked exactly below
+        if (options.StartTime.HasValue)
+            lo = Math.Max(lo, LowerBoundByTime(lo, hi, options.StartTime.Value - MaxReorder, inclusive: true));
+        if (options.EndTime.HasValue)
+            hi = Math.Min(hi, LowerBoundByTime(lo, hi, options.EndTime.Value + MaxReorder, inclusive: false));
+
+        if (cursor.HasValue)
+        {
+            if (options.NewestFirst)
+                hi = Math.Min(hi, cursor.Value);
+            else
+                lo = Math.Max(lo, cursor.Value + 1);
+        }
+
+        if (lo >= hi)
+            yield break;
+
+        var search = string.IsNullOrWhiteSpace(options.SearchText) ? null : options.SearchText;
+
+        // Drive the walk from the smaller index and check the other filter per entry
+        var useCategoryIndex = options.Category.HasValue &&
+            (!options.MinLevel.HasValue ||
+             Volatile.Read(ref _categoryCounts[(int)options.Category.Value]) < SumLevelCounts(options.MinLevel.Value));
+
+        IEnumerable<long> source;
+        if (useCategoryIndex)
+        {
+            source = _categoryIndex[(int)options.Category!.Value].Range(lo, hi, options.NewestFirst);
+        }
+        else if (options.MinLevel.HasValue)
+        {
+            var rings = new List<IEnumerable<long>>();
+            for (var level = (int)options.MinLevel.Value; level < (int)LogLevel.None; level++)
+            {
+                rings.Add(_levelIndex[level].Range(lo, hi, options.NewestFirst));
+            }
+            source = Merge(rings, options.NewestFirst);
+        }
+        else
+        {
+            source = SeqRange(lo, hi, options.NewestFirst);
+        }
+
+        foreach (var seq in source)
+        {
+            var entry = TryGet(seq);
+            if (entry == null)
+            {
+                // Evicted while we were reading - older entries are gone too
+                if (options.NewestFirst)
+                    yield break;
+                continue;
+            }
+
+            if (options.MinLevel.HasValue && entry.Level < options.MinLevel.Value)
+                continue;
+            if (options.Category.HasValue && entry.Category != options.Category.Value)
+                continue;
+            if (entry.Timestamp < options.StartTime || entry.Timestamp > options.EndTime)
+                continue;
+            if (search != null &&
+                !entry.Message.Contains(search, StringComparison.OrdinalIgnoreCase) &&
+                !(entry.Exception?.Contains(search, StringComparison.OrdinalIgnoreCase) ?? false))
+                continue;
+
+            yield return (seq, entry);
+        }
+    }
+
+    private LogEntry? TryGet(long seq)
+    {
+        var slot = Volatile.Read(ref _slots[seq % _capacity]);
+        return slot != null && slot.Seq == seq && seq >= Volatile.Read(ref _firstSeq)
+            ? slot.Entry
+            : null;
+    }
+
+    /// <summary>
+    /// First sequence number in [lo, hi) whose timestamp is at/after (inclusive) or after the given time.
+    /// </summary>
+    /// <remarks>
+    /// With <paramref name="time"/> widened by <see cref="MaxReorder"/>, nothing before the result
+    /// can match: an entry older than the widened bound means every earlier entry is older than
+    /// the real one.
+    /// </remarks>
+    private long LowerBoundByTime(long lo, long hi, DateTime time, bool inclusive)
+    {
+        while (lo < hi)
+        {
+            var mid = lo + (hi - lo) / 2;
+            var entry = TryGet(mid);
+
+            // Evicted entries are older than anything still held
+            var before = entry == null || (inclusive ? entry.Timestamp < time : entry.Timestamp <= time);
+            if (before)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    private int SumLevelCounts(LogLevel minLevel)
+    {
+        var sum = 0;
+        for (var level = (int)minLevel; level < (int)LogLevel.None; level++)
+        {
+            sum += Volatile.Read(ref _levelCounts[level]);
+        }
+        return Math.Max(0, sum);
+    }
+
+    private static long GetCursorIncluding(long seq, bool newestFirst)
+    {
+        // Cursor is exclusive: newest-first continues below it, oldest-first above it
+        return newestFirst ? seq + 1 : seq - 1;
+    }
+
+    private static IEnumerable<long> SeqRange(long lo, long hi, bool descending)
+    {
+        if (descending)
+        {
+            for (var seq = hi - 1; seq >= lo; seq--)
+                yield return seq;
+        }
+        else
+        {
+            for (var seq = lo; seq < hi; seq++)
+                yield return seq;
+        }
+    }
+
+    /// <summary>
+    /// Merges sorted sequence streams (at most one per level) into one sorted stream.
+    /// </summary>
+    private static IEnumerable<long> Merge(List<IEnumerable<long>> sources, bool descending)
+    {
+        var heads = sources.Select(s => s.GetEnumerator()).Where(e => e.MoveNext()).ToList();
+        try
+        {
+            while (heads.Count > 0)
+            {
+                var best = 0;
+                for (var i = 1; i < heads.Count; i++)
+                {
+                    var better = descending
+                        ? heads[i].Current > heads[best].Current
+                        : heads[i].Current < heads[best].Current;
+                    if (better)
+                        best = i;
+                }
+
+                yield return heads[best].Current;
+
+                if (!heads[best].MoveNext())
+                {
+                    heads[best].Dispose();
+                    heads.RemoveAt(best);
+                }
+            }
+        }
+        finally
+        {
+            foreach (var head in heads)
+                head.Dispose();
+        }
+    }
+
+    /// <summary>
+    /// Ring of ascending sequence numbers for one level or category.
+    /// Single writer (under the store's write lock), lock-free readers.
+    /// </summary>
+    private sealed class SeqRing
+    {
+        private readonly long[] _items;
+        private long _written;
+
+        public SeqRing(int capacity)
+        {
+            _items = new long[capacity];
+        }
+
+        public void Add(long seq)
+        {
+            _items[_written % _items.Length] = seq;
+            Volatile.Write(ref _written, _written + 1);
+        }
+
+        /// <summary>
+        /// Enumerates held sequence numbers within [lo, hi).
+        /// </summary>
+        public IEnumerable<long> Range(long lo, long hi, bool descending)
+        {
+            var written = Volatile.Read(ref _written);
+            var oldest = Math.Max(0, written - _items.Length);
+            var start = LowerBound(oldest, written, lo);
+            var end = LowerBound(start, written, hi);
+
+            if (descending)
+            {
+                for (var i = end - 1; i >= start; i--)
+                {
+                    var seq = Volatile.Read(ref _items[i % _items.Length]);
+                    if (i < Volatile.Read(ref _written) - _items.Length)
+                        yield break; // Overwritten - everything older is gone as well
+                    yield return seq;
+                }
+            }
+            else
+            {
+                for (var i = start; i < end; i++)
+                {
+                    var seq = Volatile.Read(ref _items[i % _items.Length]);
+                    if (i < Volatile.Read(ref _written) - _items.Length)
+                        continue; // Overwritten while reading - entry was evicted
+                    yield return seq;
+                }
+            }
+        }
+
+        private long LowerBound(long lo, long hi, long value)
+        {
+            while (lo < hi)
+            {
+                var mid = lo + (hi - lo) / 2;
+                if (Volatile.Read(ref _items[mid % _items.Length]) < value)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+    }
+}
@@ -1,5 +1,6 @@
 using System.Collections.Concurrent;
 using System.Text;
+using System.Threading.Channels;
 
 namespace MultiRoomAudio.Services;
 
@@ -39,21 +40,46 @@ public record LogQueryOptions(
     DateTime? EndTime = null,
     int Skip = 0,
     int Take = 100,
-    bool NewestFirst = true
+    bool NewestFirst = true,
+    long? Cursor = null
 );
 
 /// <summary>
 /// Manages log collection, file persistence, in-memory buffering, and retrieval.
 /// </summary>
+/// <remarks>
+/// <para>
+/// Producers never block: <see cref="AddEntry(LogEntry)"/> only enqueues onto a lock-free
+/// channel. Log calls come from everywhere, including the PulseAudio write callback and
+/// the sample source on the audio thread, so they must not wait on disk or network I/O.
+/// </para>
+/// <para>
+/// A single background consumer drains the queue in batches: it appends the batch to the
+/// in-memory buffer, writes it to the log file with one flush, and raises
+/// <see cref="LogBatchAdded"/> once for SignalR streaming. When the queue is full new
+/// entries are dropped and counted; the consumer logs a warning with the drop count.
+/// A failing sink (buffer, file or archive) is reported on stderr - the log itself may be
+/// what is broken - and the consumer carries on with the next batch.
+/// </para>
+/// </remarks>
 public class LoggingService : IDisposable
 {
     private readonly EnvironmentService _environment;
-    private readonly CircularBuffer<LogEntry> _buffer;
+    private readonly LogStore _store;
+    private readonly LogArchive _archive;
     private readonly object _fileLock = new();
-    private readonly object _bufferLock = new();
+    private readonly Channel<LogEntry> _queue;
+    private readonly CancellationTokenSource _consumerCts = new();
+    private readonly Task _consumerTask;
     private StreamWriter? _fileWriter;
     private string? _currentLogFilePath;
-    private bool _disposed;
+    private volatile bool _disposed;
+
+    // Queue accounting (Interlocked - producers are lock-free)
+    private int _pendingCount;
+    private long _droppedCount;
+    private long _reportedDroppedCount;
+    private long _batchCount;
 
     private const int InMemoryBufferSize = 2000;
     private const long MaxLogFileSizeBytes = 10 * 1024 * 1024; // 10MB
@@ -61,16 +87,69 @@ public class LoggingService : IDisposable
     private const string LogFileName = "multiroom-audio.log";
 
     /// <summary>
-    /// Event fired when a new log entry is added.
+    /// Maximum entries waiting for the consumer before new entries are dropped.
+    /// </summary>
+    private const int MaxPendingEntries = 8192;
+
+    /// <summary>
+    /// Maximum entries handled per batch.
+    /// </summary>
+    private const int MaxBatchSize = 512;
+
+    /// <summary>
+    /// How long the consumer waits after the first entry to collect a batch.
+    /// Bounds live-stream latency while coalescing bursts into one write and one push.
+    /// </summary>
+    private static readonly TimeSpan BatchInterval = TimeSpan.FromMilliseconds(100);
+
+    /// <summary>
+    /// How long Dispose waits for queued entries to be written.
+    /// </summary>
+    private static readonly TimeSpan ShutdownDrainTimeout = TimeSpan.FromSeconds(2);
+
+    /// <summary>
+    /// How long Dispose waits for a cancelled consumer to finish its current batch
+    /// before closing the file and archive under it.
+    /// </summary>
+    private static readonly TimeSpan ShutdownCancelTimeout = TimeSpan.FromSeconds(1);
+
+    /// <summary>
+    /// Event fired (on the consumer thread) after a batch of entries has been stored.
+    /// </summary>
+    public event EventHandler<IReadOnlyList<LogEntry>>? LogBatchAdded;
+
+    /// <summary>
+    /// Entries dropped because the queue was full.
+    /// </summary>
+    public long DroppedCount => Interlocked.Read(ref _droppedCount);
+
+    /// <summary>
+    /// Entries waiting to be processed by the consumer.
+    /// </summary>
+    public int PendingCount => Volatile.Read(ref _pendingCount);
+
+    /// <summary>
+    /// Batches processed by the consumer.
     /// </summary>
-    public event EventHandler<LogEntry>? LogEntryAdded;
+    public long BatchCount => Interlocked.Read(ref _batchCount);
 
     public LoggingService(EnvironmentService environment)
     {
         _environment = environment;
-        _buffer = new CircularBuffer<LogEntry>(InMemoryBufferSize);
+        _store = new LogStore(InMemoryBufferSize);
+        _archive = new LogArchive(environment.LogPath);
+
+        // Unbounded channel is a lock-free queue; the bound is enforced by _pendingCount
+        _queue = Channel.CreateUnbounded<LogEntry>(new UnboundedChannelOptions
+        {
+            SingleReader = true,
+            SingleWriter = false,
+            AllowSynchronousContinuations = false
+        });
 
         InitializeFileLogging();
+
+        _consumerTask = Task.Run(() => ConsumeAsync(_consumerCts.Token));
     }
 
     private void InitializeFileLogging()
@@ -84,10 +163,8 @@ public class LoggingService : IDisposable
             }
 
             _currentLogFilePath = Path.Combine(logDir, LogFileName);
-            _fileWriter = new StreamWriter(_currentLogFilePath, append: true, Encoding.UTF8)
-            {
-                AutoFlush = true
-            };
+            // Flushed once per batch by the consumer
+            _fileWriter = new StreamWriter(_currentLogFilePath, append: true, Encoding.UTF8);
         }
         catch (Exception)
         {
@@ -97,24 +174,25 @@ public class LoggingService : IDisposable
     }
 
     /// <summary>
-    /// Adds a log entry to the buffer and file.
+    /// Queues a log entry for the buffer, file and live stream. Never blocks.
     /// </summary>
     public void AddEntry(LogEntry entry)
     {
         if (_disposed)
             return;
 
-        // Add to in-memory buffer
-        lock (_bufferLock)
+        if (Interlocked.Increment(ref _pendingCount) > MaxPendingEntries)
         {
-            _buffer.Add(entry);
+            Interlocked.Decrement(ref _pendingCount);
+            Interlocked.Increment(ref _droppedCount);
+            return;
         }
 
-        // Write to file
-        WriteToFile(entry);
-
-        // Fire event for real-time streaming
-        LogEntryAdded?.Invoke(this, entry);
+        if (!_queue.Writer.TryWrite(entry))
+        {
+            // Writer completed (shutting down)
+            Interlocked.Decrement(ref _pendingCount);
+        }
     }
 
     /// <summary>
@@ -127,54 +205,21 @@ public class LoggingService : IDisposable
         AddEntry(entry);
     }
 
+    /// <summary>
+    /// Runs a log query: one page of entries, the total match count and the next-page cursor.
+    /// Does not block log writers.
+    /// </summary>
+    public LogQueryResult Query(LogQueryOptions? options = null)
+    {
+        return _store.Query(options ?? new LogQueryOptions());
+    }
+
     /// <summary>
     /// Gets log entries matching the specified query options.
     /// </summary>
     public IReadOnlyList<LogEntry> GetEntries(LogQueryOptions? options = null)
     {
-        options ??= new LogQueryOptions();
-
-        lock (_bufferLock)
-        {
-            var query = _buffer.AsEnumerable();
-
-            // Apply filters
-            if (options.MinLevel.HasValue)
-            {
-                query = query.Where(e => e.Level >= options.MinLevel.Value);
-            }
-
-            if (options.Category.HasValue)
-            {
-                query = query.Where(e => e.Category == options.Category.Value);
-            }
-
-            if (!string.IsNullOrWhiteSpace(options.SearchText))
-            {
-                var search = options.SearchText.ToLowerInvariant();
-                query = query.Where(e =>
-                    e.Message.Contains(search, StringComparison.OrdinalIgnoreCase) ||
-                    (e.Exception?.Contains(search, StringComparison.OrdinalIgnoreCase) ?? false));
-            }
-
-            if (options.StartTime.HasValue)
-            {
-                query = query.Where(e => e.Timestamp >= options.StartTime.Value);
-            }
-
-            if (options.EndTime.HasValue)
-            {
-                query = query.Where(e => e.Timestamp <= options.EndTime.Value);
-            }
-
-            // Order
-            query = options.NewestFirst
-                ? query.OrderByDescending(e => e.Timestamp)
-                : query.OrderBy(e => e.Timestamp);
-
-            // Pagination
-            return query.Skip(options.Skip).Take(options.Take).ToList();
-        }
+        return Query(options).Entries;
     }
 
     /// <summary>
@@ -182,69 +227,35 @@ public class LoggingService : IDisposable
     /// </summary>
     public int GetTotalCount(LogQueryOptions? options = null)
     {
-        options ??= new LogQueryOptions();
+        return _store.CountMatches(options ?? new LogQueryOptions());
+    }
 
-        lock (_bufferLock)
+    /// <summary>
+    /// Gets statistics about the current logs (from running counters, no scan).
+    /// </summary>
+    public LogStats GetStats()
+    {
+        return _store.GetStats() with
         {
-            var query = _buffer.AsEnumerable();
-
-            if (options.MinLevel.HasValue)
-            {
-                query = query.Where(e => e.Level >= options.MinLevel.Value);
-            }
-
-            if (options.Category.HasValue)
-            {
-                query = query.Where(e => e.Category == options.Category.Value);
-            }
-
-            if (!string.IsNullOrWhiteSpace(options.SearchText))
-            {
-                var search = options.SearchText.ToLowerInvariant();
-                query = query.Where(e =>
-                    e.Message.Contains(search, StringComparison.OrdinalIgnoreCase) ||
-                    (e.Exception?.Contains(search, StringComparison.OrdinalIgnoreCase) ?? false));
-            }
-
-            if (options.StartTime.HasValue)
-            {
-                query = query.Where(e => e.Timestamp >= options.StartTime.Value);
-            }
-
-            if (options.EndTime.HasValue)
-            {
-                query = query.Where(e => e.Timestamp <= options.EndTime.Value);
-            }
+            DroppedEntries = DroppedCount,
+            PendingEntries = PendingCount
+        };
+    }
 
-            return query.Count();
-        }
+    /// <summary>
+    /// Queries the compressed on-disk archive (days of history beyond the in-memory buffer).
+    /// </summary>
+    public LogArchiveQueryResult QueryArchive(LogQueryOptions options, LogArchiveCursor? cursor = null)
+    {
+        return _archive.Query(options, cursor);
     }
 
     /// <summary>
-    /// Gets statistics about the current logs.
+    /// Gets the size and time span of the on-disk archive.
     /// </summary>
-    public LogStats GetStats()
+    public LogArchiveStats GetArchiveStats()
     {
-        lock (_bufferLock)
-        {
-            var entries = _buffer.ToList();
-
-            var byLevel = entries
-                .GroupBy(e => e.Level)
-                .ToDictionary(g => g.Key.ToString(), g => g.Count());
-
-            var byCategory = entries
-                .GroupBy(e => e.Category)
-                .ToDictionary(g => g.Key.ToString(), g => g.Count());
-
-            return new LogStats(
-                byLevel,
-                byCategory,
-                entries.Count,
-                entries.MinBy(e => e.Timestamp)?.Timestamp,
-                entries.MaxBy(e => e.Timestamp)?.Timestamp
-            );
-        }
+        return _archive.GetStats();
     }
 
     /// <summary>
@@ -252,10 +263,8 @@ public class LoggingService : IDisposable
     /// </summary>
     public void Clear()
     {
-        lock (_bufferLock)
-        {
-            _buffer.Clear();
-        }
+        _store.Clear();
+        _archive.Clear();
 
         lock (_fileLock)
         {
@@ -292,7 +301,122 @@ public class LoggingService : IDisposable
         }
     }
 
-    private void WriteToFile(LogEntry entry)
+    /// <summary>
+    /// Background consumer: drains the queue in batches until shutdown.
+    /// </summary>
+    private async Task ConsumeAsync(CancellationToken cancellationToken)
+    {
+        var reader = _queue.Reader;
+        var batch = new List<LogEntry>(MaxBatchSize);
+
+        try
+        {
+            while (await reader.WaitToReadAsync(cancellationToken))
+            {
+                // Let a burst accumulate so it costs one write and one push
+                if (!cancellationToken.IsCancellationRequested)
+                {
+                    try
+                    {
+                        await Task.Delay(BatchInterval, cancellationToken);
+                    }
+                    catch (OperationCanceledException)
+                    {
+                        // Shutting down - drain what we have
+                    }
+                }
+
+                while (reader.TryRead(out var entry))
+                {
+                    batch.Add(entry);
+                    if (batch.Count == MaxBatchSize)
+                    {
+                        ProcessBatch(batch);
+                        batch.Clear();
+                    }
+                }
+
+                if (batch.Count > 0)
+                {
+                    ProcessBatch(batch);
+                    batch.Clear();
+                }
+            }
+        }
+        catch (OperationCanceledException)
+        {
+            // Shutdown timed out - remaining entries are discarded
+        }
+    }
+
+    private void ProcessBatch(List<LogEntry> batch)
+    {
+        Interlocked.Add(ref _pendingCount, -batch.Count);
+        Interlocked.Increment(ref _batchCount);
+
+        // Report drops since the last batch in-band so they show up in the UI and file
+        var dropped = Interlocked.Read(ref _droppedCount);
+        var newlyDropped = dropped - _reportedDroppedCount;
+        if (newlyDropped > 0)
+        {
+            _reportedDroppedCount = dropped;
+            batch.Add(new LogEntry(
+                DateTime.UtcNow,
+                LogLevel.Warning,
+                LogCategory.System,
+                $"Log queue full: {newlyDropped} entries dropped ({dropped} total)"));
+        }
+
+        try
+        {
+            foreach (var entry in batch)
+            {
+                _store.Append(entry);
+            }
+        }
+        catch (Exception ex)
+        {
+            ReportSinkFailure("in-memory buffer", ex);
+        }
+
+        WriteToFile(batch);
+
+        try
+        {
+            _archive.Append(batch);
+        }
+        catch (Exception ex)
+        {
+            ReportSinkFailure("archive", ex);
+        }
+
+        try
+        {
+            LogBatchAdded?.Invoke(this, batch.ToArray());
+        }
+        catch
+        {
+            // Streaming failures must not stop the consumer
+        }
+    }
+
+    /// <summary>
+    /// Reports a sink that failed to take a batch. Goes to stderr, which the container
+    /// runtime keeps even when our own log storage is what failed.
+    /// </summary>
+    private static void ReportSinkFailure(string sink, Exception ex)
+    {
+        try
+        {
+            Console.Error.WriteLine($"{DateTime.UtcNow:o} LoggingService: log {sink} failed, batch not stored there: {ex}");
+        }
+        catch
+        {
+            // Nowhere left to report to
+        }
+    }
+
+    private void WriteToFile(IReadOnlyList<LogEntry> entries)
     {
         lock (_fileLock)
         {
@@ -303,10 +427,15 @@ public class LoggingService : IDisposable
             {
                 // Check for rotation
                 RotateLogFileIfNeeded();
+                if (_fileWriter == null)
+                    return;
 
                 // Format: 2026-01-10T14:23:45.123Z|INFO|Player|Message|Exception
-                var line = FormatLogLine(entry);
-                _fileWriter.WriteLine(line);
+                foreach (var entry in entries)
+                {
+                    _fileWriter.WriteLine(FormatLogLine(entry));
+                }
+                _fileWriter.Flush();
             }
             catch
             {
@@ -372,10 +501,7 @@ public class LoggingService : IDisposable
             File.Move(_currentLogFilePath, rotatedPath);
 
             // Create new current file
-            _fileWriter = new StreamWriter(_currentLogFilePath, append: false, Encoding.UTF8)
-            {
-                AutoFlush = true
-            };
+            _fileWriter = new StreamWriter(_currentLogFilePath, append: false, Encoding.UTF8);
         }
         catch
         {
@@ -438,6 +564,25 @@ public class LoggingService : IDisposable
             return;
         _disposed = true;
 
+        // Stop accepting entries and give the consumer a moment to write what is queued.
+        // If it has to be cancelled, wait for it to leave the batch it is in before the
+        // file and archive are closed under it.
+        _queue.Writer.TryComplete();
+        try
+        {
+            if (!_consumerTask.Wait(ShutdownDrainTimeout))
+            {
+                _consumerCts.Cancel();
+                _consumerTask.Wait(ShutdownCancelTimeout);
+            }
+        }
+        catch (AggregateException)
+        {
+            // Consumer faulted - nothing more to drain
+        }
+
+        _archive.Dispose();
+
         lock (_fileLock)
         {
             _fileWriter?.Dispose();
@@ -454,67 +599,7 @@ public record LogStats(
     Dictionary<string, int> ByCategory,
     int TotalEntries,
     DateTime? OldestEntry,
-    DateTime? NewestEntry
+    DateTime? NewestEntry,
+    long DroppedEntries = 0,
+    int PendingEntries = 0
 );
-
-/// <summary>
-/// A simple fixed-size circular buffer.
-/// </summary>
-public class CircularBuffer<T>
-{
-    private readonly T[] _buffer;
-    private readonly int _capacity;
-    private int _start;
-    private int _count;
-
-    public CircularBuffer(int capacity)
-    {
-        _capacity = capacity;
-        _buffer = new T[capacity];
-        _start = 0;
-        _count = 0;
-    }
-
-    public int Count => _count;
-
-    public void Add(T item)
-    {
-        var index = (_start + _count) % _capacity;
-        _buffer[index] = item;
-
-        if (_count < _capacity)
-        {
-            _count++;
-        }
-        else
-        {
-            // Buffer is full, overwrite oldest
-            _start = (_start + 1) % _capacity;
-        }
-    }
-
-    public void Clear()
-    {
-        _start = 0;
-        _count = 0;
-        Array.Clear(_buffer);
-    }
-
-    public IEnumerable<T> AsEnumerable()
-    {
-        for (int i = 0; i < _count; i++)
-        {
-            yield return _buffer[(_start + i) % _capacity];
-        }
-    }
-
-    public List<T> ToList()
-    {
-        var list = new List<T>(_count);
-        for (int i = 0; i < _count; i++)
-        {
-            list.Add(_buffer[(_start + i) % _capacity]);
-        }
-        return list;
-    }
-}
@@ -37,6 +37,9 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
     private readonly TriggerService _triggerService;
     private readonly IServiceProvider _serviceProvider;
     private readonly VersionService _versionService;
+    private readonly ClockStateService _clockState;
+    private readonly BufferBudgetService _bufferBudget;
+    private readonly AlsaCapabilityService _alsaCapabilities;
     private readonly ConcurrentDictionary<string, PlayerContext> _players = new();
     private readonly MdnsServerDiscovery _serverDiscovery;
     private bool _disposed;
@@ -123,29 +126,6 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
 
     #region Constants
 
-    /// <summary>
-    /// Buffer capacity announced to the Sendspin server (in bytes).
-    ///
-    /// Per protocol spec: "buffer_capacity: max size in bytes of compressed audio
-    /// messages in the buffer that are yet to be played"
-    ///
-    /// The server sends audio chunks as far ahead as this capacity allows.
-    /// At typical Opus bitrates (~128kbps), 32MB = many minutes of audio.
-    /// This large value ensures the server always has audio ready to send.
-    /// </summary>
-    private const int ServerAnnouncedBufferCapacityBytes = 32_000_000;
-
-    /// <summary>
-    /// Local circular buffer capacity for decompressed PCM audio (in milliseconds).
-    ///
-    /// This is the TimedAudioBuffer size - how much decoded audio we can hold locally.
-    /// Must be large enough to handle network jitter and decode timing variations.
-    ///
-    /// Note: This is DIFFERENT from ServerAnnouncedBufferCapacityBytes which controls
-    /// how far ahead the server sends compressed audio.
-    /// </summary>
-    private const int LocalBufferCapacityMs = 8000;
-
     /// <summary>
     /// Target buffer level for playback readiness (in milliseconds).
     ///
@@ -153,12 +133,37 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
     /// Lower values = faster playback start but more sensitive to jitter.
     ///
     /// This is NOT a buffer capacity - it's a threshold for when to START playing.
-    /// The actual buffer can hold much more (see LocalBufferCapacityMs).
+    /// The actual buffer can hold much more (sized per player by BufferBudgetService).
     ///
     /// With SDK's HasMinimalSync (2 clock measurements), typical startup is 300-500ms.
     /// </summary>
     private const int PlaybackStartThresholdMs = 250;
 
+    /// <summary>
+    /// How long the pipeline waits for clock convergence before starting playback.
+    /// </summary>
+    /// <remarks>
+    /// Not shortened on a warm start: the SDK's KalmanClockSynchronizer has no way to be
+    /// seeded with a persisted drift or offset, so every run's filter starts cold.
+    /// </remarks>
+    private const int ConvergenceTimeoutMs = 1000;
+
+    /// <summary>
+    /// Sync error below which playback counts as "in sync" for warm start timing.
+    /// Matches SyncToleranceMs in PlayerStatsMapper.
+    /// </summary>
+    private const double WarmStartSyncToleranceMs = 30.0;
+
+    /// <summary>
+    /// Poll interval for recording learned clock/latency state after connection.
+    /// </summary>
+    private static readonly TimeSpan WarmStartTrackingInterval = TimeSpan.FromMilliseconds(250);
+
+    /// <summary>
+    /// Interval for buffer level observations fed to BufferBudgetService.
+    /// </summary>
+    private static readonly TimeSpan BufferLevelSampleInterval = TimeSpan.FromMilliseconds(500);
+
     /// <summary>
     /// Sync correction options tuned for PulseAudio's timing characteristics.
     /// Uses a high threshold for Tier 3 (frame drop/insert) to prefer smooth rate adjustment.
@@ -403,6 +408,22 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         public EventHandler<SdkPlayerState>? PlayerStateHandler { get; set; }
         // Flag to prevent feedback loops when updating server
         public bool IsUpdatingFromServer { get; set; }
+
+        // Warm start: state persisted on a previous run and what this run has learned
+        public ServerClockState? PersistedClockState { get; init; }
+        public int? PersistedLatencyMs { get; init; }
+        public DateTime? PlaybackRequestedAt { get; set; }
+        public int? TimeToFirstSyncMs { get; set; }
+        // Whether this player currently holds its 12V trigger on (see CreatePipelineStateHandler)
+        public bool HoldsTrigger { get; set; }
+        public bool ClockStateRecorded { get; set; }
+        public bool LatencyStateRecorded { get; set; }
+
+        // How the advertised format was chosen (auto negotiation or user preference)
+        public FormatSelection? FormatSelection { get; init; }
+
+        // Music Assistant group this player currently belongs to (from GroupState)
+        public string? GroupId { get; set; }
     }
 
     /// <summary>
@@ -427,7 +448,10 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         IAudioPipeline Pipeline,
         SendspinConnection Connection,
         ISendspinClient Client,
-        DeviceCapabilities? DeviceCapabilities
+        DeviceCapabilities? DeviceCapabilities,
+        ServerClockState? PersistedClockState,
+        int? PersistedLatencyMs,
+        FormatSelection FormatSelection
     );
 
     public PlayerManagerService(
@@ -441,6 +465,9 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         TriggerService triggerService,
         IServiceProvider serviceProvider,
         VersionService versionService,
+        ClockStateService clockState,
+        BufferBudgetService bufferBudget,
+        AlsaCapabilityService alsaCapabilities,
         PulseAudioSubscriptionService? subscriptionService = null)
     {
         _logger = logger;
@@ -453,6 +480,9 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         _triggerService = triggerService;
         _serviceProvider = serviceProvider;
         _versionService = versionService;
+        _clockState = clockState;
+        _bufferBudget = bufferBudget;
+        _alsaCapabilities = alsaCapabilities;
         _subscriptionService = subscriptionService;
         _serverDiscovery = new MdnsServerDiscovery(
             loggerFactory.CreateLogger<MdnsServerDiscovery>());
@@ -857,7 +887,10 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
                 cachedDevice)
             {
                 State = Models.PlayerState.Created,
-                InitialVolume = request.Volume
+                InitialVolume = request.Volume,
+                PersistedClockState = components.PersistedClockState,
+                PersistedLatencyMs = components.PersistedLatencyMs,
+                FormatSelection = components.FormatSelection
             };
 
             // Phase 3: Wire up events
@@ -913,9 +946,9 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         // Probe device capabilities (used for reporting in Stats for Nerds)
         var deviceCapabilities = _backendFactory.GetDeviceCapabilities(request.Device);
 
-        // Apply format filtering (always defaults to flac-48000 for maximum compatibility)
-        var audioFormats = GetDefaultFormats();
-        audioFormats = FilterFormatsByPreference(audioFormats, request.AdvertisedFormat);
+        // Pick advertised format: negotiated from the device unless the user chose one
+        var formatSelection = SelectAdvertisedFormats(request);
+        var audioFormats = formatSelection.Formats;
 
         // Create capabilities with player role
         var clientCapabilities = new ClientCapabilities
@@ -924,7 +957,10 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             ClientName = request.Name,
             Roles = new List<string> { "controller@v1", "player@v1", "metadata@v1" },
             AudioFormats = audioFormats,
-            BufferCapacity = ServerAnnouncedBufferCapacityBytes,
+            // Per protocol spec: "buffer_capacity: max size in bytes of compressed audio
+            // messages in the buffer that are yet to be played". Sized so it never limits
+            // the server's lead below the largest local buffer, whichever format it picks.
+            BufferCapacity = _bufferBudget.GetAdvertisedCapacityBytes(request.Name, audioFormats),
             InitialVolume = request.Volume,
             InitialMuted = false, // Players start unmuted
 
@@ -941,6 +977,25 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         // Create audio player using the appropriate backend
         var player = _backendFactory.CreatePlayer(request.Device, _loggerFactory);
 
+        // Warm start from state learned on a previous run (see ClockStateService).
+        // The server isn't known until connect, so fall back to the configured/cached URI.
+        // Only the latency lock can be seeded; the persisted drift is kept to compare with
+        // what the (cold) clock filter learns, as the SDK offers no way to seed it.
+        var persistedClock = _clockState.GetServerState(GetClockStateServerKey(request.ServerUrl));
+        var persistedLatency = _clockState.GetDeviceLatency(request.Device);
+        if (persistedLatency.HasValue && player is PulseAudioPlayer paPlayer)
+        {
+            paPlayer.SeedLatency(persistedLatency.Value);
+        }
+
+        if (persistedClock != null)
+        {
+            _logger.LogInformation(
+                "Warm start for '{Name}': latency seed {Latency}, last drift {Drift:F2} ppm (clock filter starts cold)",
+                request.Name, persistedLatency.HasValue ? $"{persistedLatency}ms" : "none",
+                persistedClock.DriftPpm);
+        }
+
         // Create audio pipeline with proper factories (player-prefixed loggers for debugging)
         var decoderFactory = new AudioDecoderFactory();
         var pipeline = new AudioPipeline(
@@ -949,12 +1004,39 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             clockSync,
             bufferFactory: (format, sync) =>
             {
+                var capacityMs = _bufferBudget.AllocateCapacityMs(request.Name, format);
                 var buffer = new TimedAudioBuffer(
                     format,
                     sync,
-                    bufferCapacityMs: LocalBufferCapacityMs,
+                    bufferCapacityMs: capacityMs,
                     syncOptions: PulseAudioSyncOptions);
-                buffer.TargetBufferMilliseconds = PlaybackStartThresholdMs;
+
+                // Hold the start while the zone's amplifier is still warming up. The relay is
+                // switched on as the pipeline starts, so this is the unexpired part of the warm-up.
+                // Triggers are keyed on the player's current device, which a device switch changes.
+                var deviceId = _players.TryGetValue(request.Name, out var current)
+                    ? current.Config.DeviceId
+                    : request.Device;
+                // The hold is limited by how far ahead the server sends, not just local capacity:
+                // the buffer never fills past the server's lead, so a longer hold would never start
+                var warmupMs = _triggerService.GetRemainingWarmupMs(deviceId);
+                var maxTargetMs = Math.Max(PlaybackStartThresholdMs, Math.Min(
+                    capacityMs - PlaybackStartThresholdMs,
+                    _bufferBudget.GetObservedLeadMs(request.Name) ?? int.MaxValue));
+                var targetMs = PlaybackStartThresholdMs + warmupMs;
+                buffer.TargetBufferMilliseconds = Math.Min(targetMs, maxTargetMs);
+                if (targetMs > maxTargetMs)
+                {
+                    _logger.LogInformation(
+                        "Player '{Name}': amplifier warm-up {Warmup}ms exceeds the {Lead}ms the stream buffers ahead; holding start {Hold}ms",
+                        request.Name, warmupMs, maxTargetMs, maxTargetMs - PlaybackStartThresholdMs);
+                }
+                else if (warmupMs > 0)
+                {
+                    _logger.LogDebug("Player '{Name}': holding start {Warmup}ms for amplifier warm-up",
+                        request.Name, warmupMs);
+                }
+
                 return buffer;
             },
             playerFactory: () => player,
@@ -966,7 +1048,7 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
                     _loggerFactory.CreatePlayerLogger<BufferedAudioSampleSource>(request.Name));
             },
             waitForConvergence: true,
-            convergenceTimeoutMs: 1000);
+            convergenceTimeoutMs: ConvergenceTimeoutMs);
 
         // Create WebSocket connection with player-prefixed logger.
         // AutoReconnect disabled: the app's own reconnection logic handles recovery
@@ -990,7 +1072,64 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             pipeline,
             connection,
             client,
-            deviceCapabilities);
+            deviceCapabilities,
+            persistedClock,
+            persistedLatency,
+            formatSelection);
+    }
+
+    /// <summary>
+    /// Selects the formats to advertise for a player.
+    /// With no preference (or "auto"), negotiates the format the output device plays natively.
+    /// Otherwise honours the user's manual choice.
+    /// </summary>
+    private FormatSelection SelectAdvertisedFormats(PlayerCreateRequest request)
+    {
+        var allFormats = GetDefaultFormats();
+
+        if (!FormatNegotiator.IsAuto(request.AdvertisedFormat))
+        {
+            var filtered = FilterFormatsByPreference(allFormats, request.AdvertisedFormat);
+            return filtered.Count == 1
+                ? new FormatSelection(filtered, "manual", $"preference '{request.AdvertisedFormat}'")
+                : new FormatSelection(filtered, "all", "all supported formats");
+        }
+
+        var device = string.IsNullOrEmpty(request.Device)
+            ? _backendFactory.GetDefaultDevice()
+            : _backendFactory.GetDevice(request.Device);
+
+        // Hardware rate list from ALSA. The PulseAudio fallback only repeats the sink rate,
+        // which the negotiator already uses, so only real ALSA data narrows the choice.
+        DeviceCapabilities? hardware = null;
+        if (device?.CardIndex is int cardIndex)
+        {
+            var capsWithSource = _alsaCapabilities.GetCapabilities(
+                cardIndex, device.DefaultSampleRate, device.BitDepth, device.MaxChannels);
+            if (capsWithSource?.Source == CapabilitySource.Alsa)
+                hardware = capsWithSource.Capabilities;
+        }
+
+        var selection = FormatNegotiator.SelectNative(allFormats, device, hardware);
+        var chosen = selection.Formats[0];
+        _logger.LogInformation(
+            "Player '{Name}': advertising {Codec} {SampleRate}Hz ({Reason})",
+            request.Name, chosen.Codec.ToUpperInvariant(), chosen.SampleRate, selection.Reason);
+
+        return selection;
+    }
+
+    /// <summary>
+    /// Gets the key used to store clock state for a server (host:port).
+    /// Returns null when the server is not known yet, meaning "most recently seen server".
+    /// </summary>
+    private string? GetClockStateServerKey(string? serverUrl)
+    {
+        if (!string.IsNullOrEmpty(serverUrl) && Uri.TryCreate(serverUrl, UriKind.Absolute, out var uri))
+            return $"{uri.Host}:{uri.Port}";
+
+        var cached = _cachedServerUri;
+        return cached != null ? $"{cached.Host}:{cached.Port}" : null;
     }
 
     /// <summary>
@@ -1353,6 +1492,15 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             throw new ArgumentException(error);
         }
 
+        // Routed zones share their card's stream, so moving onto or off one recreates the player
+        if (context.Player is RoutedZonePlayer or CombinedZonePlayer || IsRoutedZone(newDeviceId))
+        {
+            _logger.LogInformation("Restarting player '{Name}' to move to device '{Device}' (routed zone)",
+                name, newDeviceId ?? "default");
+            context.Config.DeviceId = newDeviceId;
+            return await RestartPlayerAsync(name, ct) != null;
+        }
+
         _logger.LogInformation("Hot-switching player '{Name}' to device '{Device}'",
             name, newDeviceId ?? "default");
 
@@ -1369,11 +1517,25 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         }
     }
 
+    /// <summary>
+    /// Whether a device is an in-process remap or combine sink (played through a
+    /// <see cref="RoutedZonePlayer"/> or <see cref="CombinedZonePlayer"/>).
+    /// </summary>
+    private bool IsRoutedZone(string? deviceId)
+    {
+        return !string.IsNullOrEmpty(deviceId) &&
+               _serviceProvider.GetService<CustomSinksService>()?.GetSink(deviceId)?.InProcess == true;
+    }
+
     /// <summary>
     /// Sets the volume for a player (0-100).
     /// Updates local config and notifies server. Hardware volume is fixed at 80% on startup.
     /// </summary>
-    public Task<bool> SetVolumeAsync(string name, int volume, CancellationToken ct = default)
+    /// <param name="persist">
+    /// Save the configuration now. Callers applying a burst of changes (HID volume knobs) pass
+    /// false and call <see cref="PersistVolume"/> once the burst is over.
+    /// </param>
+    public Task<bool> SetVolumeAsync(string name, int volume, CancellationToken ct = default, bool persist = true)
     {
         if (!_players.TryGetValue(name, out var context))
             return Task.FromResult(false);
@@ -1418,11 +1580,27 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         _ = BroadcastStatusAsync();
 
         // 5. Persist volume to config so it survives restarts
-        _config.UpdatePlayerField(name, cfg => cfg.Volume = volume, save: true);
+        if (persist)
+        {
+            _config.UpdatePlayerField(name, cfg => cfg.Volume = volume, save: true);
+        }
 
         return Task.FromResult(true);
     }
 
+    /// <summary>
+    /// Saves a player's current volume to the configuration.
+    /// Used after a burst of <see cref="SetVolumeAsync"/> calls made with persist: false.
+    /// </summary>
+    public void PersistVolume(string name)
+    {
+        if (!_players.TryGetValue(name, out var context))
+            return;
+
+        var volume = context.Config.Volume;
+        _config.UpdatePlayerField(name, cfg => cfg.Volume = volume, save: true);
+    }
+
 
     /// <summary>
     /// Sets the mute state for a player.
@@ -1739,6 +1917,7 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             await context.Client.DisconnectAsync("user_request").WaitAsync(DisposalTimeout);
             await context.Pipeline.StopAsync().WaitAsync(DisposalTimeout);
             await DisposePlayerContextAsync(context);
+            _bufferBudget.Release(name);
 
             _logger.LogInformation("Player '{Name}' removed and disposed", name);
 
@@ -2052,6 +2231,16 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
 
             // Push our configured volume to the server (overrides SDK's default volume:100)
             await PushVolumeToServerAsync(name, context);
+
+            // Record learned drift/latency for the next restart
+            FireAndForget(
+                TrackWarmStartStateAsync(name, context, ct),
+                $"Warm start tracking for player '{name}'", _logger);
+
+            // Feed buffer level observations into the memory budget
+            FireAndForget(
+                MonitorBufferLevelAsync(name, context, ct),
+                $"Buffer level monitor for player '{name}'", _logger);
         }
         catch (OperationCanceledException)
         {
@@ -2103,6 +2292,102 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         }
     }
 
+    /// <summary>
+    /// Watches a connected player and persists what it learns for the next restart:
+    /// the server drift once the Kalman filter reports it reliable, the sink's latency lock,
+    /// and the time from playback request to first in-sync audio (cold vs warm).
+    /// </summary>
+    /// <remarks>
+    /// Runs until all three are recorded or the player is stopped. Polls the same
+    /// lock-free status snapshots as Stats for Nerds, so it never touches the audio path.
+    /// </remarks>
+    private async Task TrackWarmStartStateAsync(string name, PlayerContext context, CancellationToken ct)
+    {
+        var serverKey = context.ConnectedAddress;
+        if (serverKey == null)
+            return;
+
+        var pulsePlayer = context.Player as PulseAudioPlayer;
+        context.LatencyStateRecorded = pulsePlayer == null || string.IsNullOrEmpty(context.Config.DeviceId);
+
+        using var timer = new PeriodicTimer(WarmStartTrackingInterval);
+        try
+        {
+            while (await timer.WaitForNextTickAsync(ct))
+            {
+                var clockStatus = context.ClockSync.GetStatus();
+
+                if (!context.ClockStateRecorded && clockStatus.IsConverged && clockStatus.IsDriftReliable)
+                {
+                    _clockState.RecordServerClock(
+                        serverKey,
+                        clockStatus.DriftMicrosecondsPerSecond,
+                        clockStatus.OffsetUncertaintyMicroseconds / 1000.0,
+                        clockStatus.MeasurementCount);
+                    context.ClockStateRecorded = true;
+                    _logger.LogDebug("Player '{Name}': recorded drift {Drift:F2} ppm for {Server} (last run {Persisted})",
+                        name, clockStatus.DriftMicrosecondsPerSecond, serverKey,
+                        context.PersistedClockState != null ? $"{context.PersistedClockState.DriftPpm:F2} ppm" : "none");
+                }
+
+                if (!context.LatencyStateRecorded && pulsePlayer!.IsLatencyLocked)
+                {
+                    _clockState.RecordDeviceLatency(context.Config.DeviceId!, pulsePlayer.OutputLatencyMs);
+                    context.LatencyStateRecorded = true;
+                }
+
+                if (context.TimeToFirstSyncMs == null && context.PlaybackRequestedAt.HasValue &&
+                    context.Pipeline.State == AudioPipelineState.Playing && clockStatus.IsConverged)
+                {
+                    var bufferStats = context.Pipeline.BufferStats;
+                    if (bufferStats is { IsPlaybackActive: true } stats &&
+                        Math.Abs(stats.SyncErrorMs) < WarmStartSyncToleranceMs)
+                    {
+                        var elapsedMs = (int)(DateTime.UtcNow - context.PlaybackRequestedAt.Value).TotalMilliseconds;
+                        var isWarm = context.PersistedClockState != null;
+                        context.TimeToFirstSyncMs = elapsedMs;
+                        _clockState.RecordTimeToSync(serverKey, isWarm, elapsedMs);
+                        _logger.LogInformation("Player '{Name}' in sync {Elapsed}ms after playback request ({Mode} start)",
+                            name, elapsedMs, isWarm ? "warm" : "cold");
+                    }
+                }
+
+                if (context.ClockStateRecorded && context.LatencyStateRecorded && context.TimeToFirstSyncMs.HasValue)
+                    break;
+            }
+        }
+        catch (OperationCanceledException)
+        {
+            // Player stopped before everything was learned - nothing to persist
+        }
+    }
+
+    /// <summary>
+    /// Samples the local buffer level while playing so BufferBudgetService can size the
+    /// next stream's buffer from the lead and jitter actually observed.
+    /// </summary>
+    private async Task MonitorBufferLevelAsync(string name, PlayerContext context, CancellationToken ct)
+    {
+        using var timer = new PeriodicTimer(BufferLevelSampleInterval);
+        try
+        {
+            while (await timer.WaitForNextTickAsync(ct))
+            {
+                if (context.State != Models.PlayerState.Playing)
+                    continue;
+
+                if (context.Pipeline.BufferStats is { IsPlaybackActive: true } stats)
+                {
+                    _bufferBudget.RecordBufferLevel(name, (int)stats.BufferedMs);
+                }
+            }
+        }
+        catch (OperationCanceledException)
+        {
+            // Player stopped
+        }
+    }
+
     /// <summary>
     /// Wires all event handlers for a player context.
     /// </summary>
@@ -2248,22 +2533,43 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             }
 
             // Notify trigger service of playback state changes
-            // Activate when transitioning TO an active state (Playing/Buffering) from inactive
-            // Deactivate when transitioning TO a stopped state (Idle/Stopping) from active
-            var isActiveState = state == AudioPipelineState.Playing || state == AudioPipelineState.Buffering;
-            var wasInactiveState = previousState != Models.PlayerState.Playing && previousState != Models.PlayerState.Buffering;
+            // Activate on the first active pipeline state (Starting/Buffering/Playing), so the
+            // amplifier powers up while the pipeline is still buffering
+            // Deactivate on a stopped state (Idle/Stopping) if this player had activated it
+            // (PlayerState.Starting is also used while connecting, so track it explicitly)
+            var isActiveState = state == AudioPipelineState.Playing || state == AudioPipelineState.Buffering ||
+                                stateStr is "Starting";
             var isStoppedState = state == AudioPipelineState.Idle || stateStr is "Stopping";
-            var wasActiveState = previousState == Models.PlayerState.Playing || previousState == Models.PlayerState.Buffering;
 
-            if (isActiveState && wasInactiveState)
+            // Idle-cork only while stopped: a stall while playing brings no new state to wake it.
+            // New audio is on its way: uncork an idle stream now so it is running
+            // (pre-rolled with silence) before the scheduled start
+            if (context.Player is PulseAudioPlayer pulsePlayer)
             {
+                pulsePlayer.IdleCorkAllowed = isStoppedState;
+                if (isActiveState)
+                    pulsePlayer.Wake();
+            }
+
+            if (isActiveState && !context.HoldsTrigger)
+            {
+                context.HoldsTrigger = true;
+                context.PlaybackRequestedAt = DateTime.UtcNow;
                 _triggerService.OnPlayerStarted(name, context.Config.DeviceId);
             }
-            else if (isStoppedState && wasActiveState)
+            else if (isStoppedState && context.HoldsTrigger)
             {
+                context.HoldsTrigger = false;
+                // A stop before sync was reached must not count towards the next start's time
+                context.PlaybackRequestedAt = null;
                 _triggerService.OnPlayerStopped(name, context.Config.DeviceId);
             }
 
+            if (state == AudioPipelineState.Playing && previousState != Models.PlayerState.Playing)
+            {
+                _triggerService.OnPlayerAudible(name, context.Config.DeviceId);
+            }
+
             // Broadcast status update on pipeline state change
             _ = BroadcastStatusAsync();
         };
@@ -2833,6 +3139,12 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             _logger.LogDebug(
                 "GROUPSTATE Player '{Name}': GroupId={GroupId} vol={GroupVol}% muted={GroupMuted} (local vol={LocalVol}%)",
                 name, group.GroupId, group.Volume, group.Muted, context.Config.Volume);
+
+            if (context.GroupId != group.GroupId)
+            {
+                context.GroupId = group.GroupId;
+                _logger.LogDebug("Player '{Name}' joined group {GroupId}", name, group.GroupId);
+            }
         };
     }
 
@@ -3096,7 +3408,134 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
             context.Pipeline,
             context.ClockSync,
             context.Player,
-            context.CachedDevice);
+            context.CachedDevice,
+            BuildWarmStartStats(context),
+            BuildFormatNegotiationStats(context));
+    }
+
+    /// <summary>
+    /// Finds local players that Music Assistant has grouped onto the same stream.
+    /// </summary>
+    /// <remarks>
+    /// Members of a group receive identical audio (same codec, rate and server timestamps)
+    /// over separate connections, and each SDK pipeline decodes and buffers its own copy.
+    /// This reports that duplicated work per group. Only players currently streaming are
+    /// counted, since an idle member holds no decoded audio.
+    /// <para>
+    /// Detection only: the audio is not shared. Decoding and the timed buffer live in each
+    /// player's SDK <c>AudioPipeline</c>, which has no hook for a shared decoder or PCM
+    /// store, so decode-once fan-out needs an SDK change first.
+    /// </para>
+    /// </remarks>
+    public LocalStreamGroupsResponse GetLocalStreamGroups()
+    {
+        var groups = new List<LocalStreamGroup>();
+
+        var streaming = _players
+            .Where(p => p.Value.GroupId != null && p.Value.Pipeline.CurrentFormat != null &&
+                        (p.Value.State == Models.PlayerState.Playing || p.Value.State == Models.PlayerState.Buffering))
+            .GroupBy(p => (p.Value.GroupId!, FormatKey(p.Value.Pipeline.CurrentFormat!)));
+
+        foreach (var group in streaming)
+        {
+            var members = group.OrderBy(p => p.Key).ToList();
+            if (members.Count < 2)
+                continue;
+
+            // Every buffer beyond the largest holds a duplicate of the same audio
+            var bufferBytes = members.Select(p => _bufferBudget.GetAllocatedBytes(p.Key)).ToList();
+
+            groups.Add(new LocalStreamGroup(
+                GroupId: group.Key.Item1,
+                Format: group.Key.Item2,
+                Players: members.Select(p => p.Key).ToList(),
+                RedundantDecodes: members.Count - 1,
+                RedundantBufferBytes: bufferBytes.Sum() - bufferBytes.Max()));
+        }
+
+        return new LocalStreamGroupsResponse(
+            groups,
+            groups.Sum(g => g.RedundantDecodes),
+            groups.Sum(g => g.RedundantBufferBytes));
+
+        static string FormatKey(AudioFormat f) => $"{f.Codec.ToUpperInvariant()} {f.SampleRate}Hz {f.Channels}ch";
+    }
+
+    /// <summary>
+    /// Reads the audio clock and clock sync state of every playing player, for
+    /// <see cref="ZoneSyncMonitor"/>.
+    /// </summary>
+    /// <remarks>
+    /// Players whose audio clock is unavailable (not yet uncorked, no PA timing) or whose clock
+    /// sync has not converged are left out: their position on the server timeline is not known.
+    /// </remarks>
+    public IReadOnlyList<ZoneClockReading> ReadZoneClocks()
+    {
+        var readings = new List<ZoneClockReading>();
+
+        foreach (var (name, context) in _players)
+        {
+            if (context.State != Models.PlayerState.Playing)
+                continue;
+
+            var clockStatus = context.ClockSync.GetStatus();
+            if (!clockStatus.IsConverged || context.Pipeline.BufferStats is not { IsPlaybackActive: true } stats)
+                continue;
+
+            var audioClockUs = context.Player.GetAudioClockMicroseconds();
+            var localTimeUs = (DateTimeOffset.UtcNow.UtcTicks - DateTimeOffset.UnixEpoch.UtcTicks) / 10;
+            if (audioClockUs == null)
+                continue;
+
+            readings.Add(new ZoneClockReading(
+                Name: name,
+                GroupId: context.GroupId,
+                AudioClockUs: audioClockUs.Value,
+                LocalTimeUs: localTimeUs,
+                ServerOffsetMs: clockStatus.OffsetMilliseconds,
+                OffsetUncertaintyMs: clockStatus.OffsetUncertaintyMicroseconds / 1000.0,
+                SyncErrorMs: stats.SyncErrorMs));
+        }
+
+        return readings;
+    }
+
+    private WarmStartStats BuildWarmStartStats(PlayerContext context)
+    {
+        var pulsePlayer = context.Player as PulseAudioPlayer;
+        var serverState = context.ConnectedAddress != null
+            ? _clockState.GetServerState(context.ConnectedAddress, includeStale: true)
+            : null;
+
+        return new WarmStartStats(
+            IsWarmStart: context.PersistedClockState != null,
+            PersistedDriftPpm: context.PersistedClockState?.DriftPpm,
+            PersistedLatencyMs: context.PersistedLatencyMs,
+            LatencyWarmStarted: pulsePlayer?.IsLatencyWarmStarted ?? false,
+            LatencyLockTimeMs: pulsePlayer?.LatencyLockTimeMs,
+            TimeToFirstSyncMs: context.TimeToFirstSyncMs,
+            LastColdStartSyncMs: serverState?.LastColdStartSyncMs,
+            LastWarmStartSyncMs: serverState?.LastWarmStartSyncMs);
+    }
+
+    private static FormatNegotiationStats? BuildFormatNegotiationStats(PlayerContext context)
+    {
+        var selection = context.FormatSelection;
+        if (selection == null)
+            return null;
+
+        var advertised = selection.Formats.Count == 1
+            ? $"{selection.Formats[0].Codec.ToUpperInvariant()} {selection.Formats[0].SampleRate}Hz {selection.Formats[0].Channels}ch"
+            : $"{selection.Formats.Count} formats";
+
+        var inputRate = context.Pipeline.CurrentFormat?.SampleRate;
+        var sinkRate = context.CachedDevice?.DefaultSampleRate;
+
+        return new FormatNegotiationStats(
+            Mode: selection.Mode,
+            AdvertisedFormat: advertised,
+            Reason: selection.Reason,
+            MatchesSinkRate: inputRate.HasValue && sinkRate.HasValue ? inputRate == sinkRate : null);
     }
 
     private static string GenerateClientId(string name)
@@ -3132,7 +3571,7 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
 
     /// <summary>
     /// Filters advertised audio formats based on user preference.
-    /// Defaults to flac-48000 for maximum MA compatibility when no format specified.
+    /// Falls back to flac-48000 for maximum MA compatibility when no format specified.
     /// </summary>
     /// <param name="allFormats">List of all supported formats.</param>
     /// <param name="advertisedFormat">Format preference string (e.g., "flac-192000", "pcm-96000-24"). If null/empty, defaults to "flac-48000".</param>
@@ -3220,6 +3659,7 @@ public class PlayerManagerService : IAsyncDisposable, IDisposable
         _logger.LogInformation("Internal stop for player '{Name}': {Reason}", name, reason);
 
         // Notify trigger service that player stopped
+        context.HoldsTrigger = false;
         _triggerService.OnPlayerStopped(name, context.Config.DeviceId);
 
         try
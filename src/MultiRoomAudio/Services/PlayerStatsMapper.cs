@@ -1,4 +1,5 @@
 using System.Reflection;
+using MultiRoomAudio.Audio.PulseAudio;
 using MultiRoomAudio.Models;
 using Sendspin.SDK.Audio;
 using Sendspin.SDK.Models;
@@ -30,13 +31,17 @@ internal static class PlayerStatsMapper
     /// <param name="clockSync">The clock synchronizer providing timing stats.</param>
     /// <param name="player">The audio player providing output latency.</param>
     /// <param name="device">The audio device for hardware format info (optional).</param>
+    /// <param name="warmStart">Warm start state tracked by the player manager (optional).</param>
+    /// <param name="formatNegotiation">Advertised format negotiation result (optional).</param>
     /// <returns>Complete stats response for the UI.</returns>
     public static PlayerStatsResponse BuildStats(
         string playerName,
         IAudioPipeline pipeline,
         IClockSynchronizer clockSync,
         IAudioPlayer player,
-        AudioDevice? device = null)
+        AudioDevice? device = null,
+        WarmStartStats? warmStart = null,
+        FormatNegotiationStats? formatNegotiation = null)
     {
         // Single snapshot of buffer stats — one lock acquisition instead of five.
         // This matches the Windows version's pattern of snapshotting the struct once
@@ -57,7 +62,17 @@ internal static class PlayerStatsMapper
             Correction: BuildSyncCorrectionStats(bufferStats),
             Diagnostics: BuildBufferDiagnostics(bufferStats, pipelineState),
             SdkVersion: GetSdkVersion(),
-            ServerTime: DateTime.Now.ToString("HH:mm:ss")
+            ServerTime: DateTime.Now.ToString("HH:mm:ss"),
+            WarmStart: warmStart,
+            FormatNegotiation: formatNegotiation,
+            CombineOutputs: (player as CombinedZonePlayer)?.GetOutputStats().ToList(),
+            IdleCork: player is PulseAudioPlayer pulsePlayer
+                ? new IdleCorkStats(
+                    pulsePlayer.IsIdleCorked,
+                    pulsePlayer.IdleCorkCount,
+                    pulsePlayer.IdleWakeupsSaved,
+                    pulsePlayer.LastWakeToAudioMs)
+                : null
         );
     }
 
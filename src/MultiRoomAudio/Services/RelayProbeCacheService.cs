@@ -0,0 +1,106 @@
+using MultiRoomAudio.Relay;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Cached result of probing one CH340 serial device for a relay protocol.
+/// </summary>
+public class RelayProbeCacheEntry
+{
+    /// <summary>
+    /// Serial port the device was probed on (informational; ports can be renumbered).
+    /// </summary>
+    public string Port { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Detected protocol, or <see cref="Ch340Protocol.Unknown"/> if the device did not respond.
+    /// </summary>
+    public Ch340Protocol Protocol { get; set; }
+
+    /// <summary>
+    /// Detected channel count (0 if not a relay board).
+    /// </summary>
+    public int ChannelCount { get; set; }
+
+    /// <summary>
+    /// Sysfs identity of the USB device when it was probed (VID, PID, serial, bus and device number).
+    /// </summary>
+    public string Fingerprint { get; set; } = string.Empty;
+
+    /// <summary>
+    /// When the device was probed.
+    /// </summary>
+    public DateTime ProbedAt { get; set; }
+}
+
+/// <summary>
+/// Persists CH340 relay probe results to relay-probe-cache.yaml, keyed by USB port path hash
+/// and USB serial number, so enumeration does not open and probe every serial port on each
+/// start or device listing.
+/// </summary>
+/// <remarks>
+/// An entry is only trusted while the device's sysfs identity is unchanged. The kernel assigns
+/// a new device number whenever a device is re-enumerated, so unplugging, swapping or
+/// re-plugging a device always forces a fresh probe. Negative results are additionally
+/// limited to <see cref="NegativeResultMaxAge"/>, so a board that was unpowered or busy during
+/// a probe is picked up again without a re-plug.
+/// </remarks>
+public class RelayProbeCacheService : YamlDictionaryService<string, RelayProbeCacheEntry>
+{
+    /// <summary>
+    /// How long a "not a relay board" result is trusted.
+    /// </summary>
+    private static readonly TimeSpan NegativeResultMaxAge = TimeSpan.FromHours(24);
+
+    public RelayProbeCacheService(
+        ILogger<RelayProbeCacheService> logger,
+        EnvironmentService environment)
+        : base(environment.RelayProbeCachePath, logger)
+    {
+        Load();
+    }
+
+    /// <summary>
+    /// Gets the cached probe result for a device if its identity still matches.
+    /// </summary>
+    public bool TryGetValid(UsbSerialIdentity identity, out RelayProbeCacheEntry entry)
+    {
+        entry = null!;
+
+        if (!TryGet(identity.CacheKey, out var cached) || cached == null)
+            return false;
+
+        if (!string.Equals(cached.Fingerprint, identity.Fingerprint, StringComparison.Ordinal))
+            return false;
+
+        if (cached.Protocol == Ch340Protocol.Unknown && DateTime.UtcNow - cached.ProbedAt > NegativeResultMaxAge)
+            return false;
+
+        entry = cached;
+        return true;
+    }
+
+    /// <summary>
+    /// Records a probe result. Call <see cref="YamlDictionaryService{TKey,TValue}.Save"/> once
+    /// after a batch of probes.
+    /// </summary>
+    public void Record(UsbSerialIdentity identity, string portName, Ch340Protocol protocol, int channelCount)
+    {
+        Set(identity.CacheKey, new RelayProbeCacheEntry
+        {
+            Port = portName,
+            Protocol = protocol,
+            ChannelCount = channelCount,
+            Fingerprint = identity.Fingerprint,
+            ProbedAt = DateTime.UtcNow
+        }, save: false);
+    }
+
+    /// <summary>
+    /// Drops the cached result for a device, e.g. after it failed to open as the cached protocol.
+    /// </summary>
+    public void Invalidate(UsbSerialIdentity identity)
+    {
+        Remove(identity.CacheKey);
+    }
+}
@@ -61,7 +61,10 @@ public class StartupOrchestrator : BackgroundService
             await RunPhaseAsync("profiles", () => _cardProfiles.InitializeAsync(stoppingToken), stoppingToken);
 
             // Phase 2: Load custom audio sinks (must be before players)
-            await RunPhaseAsync("sinks", () => _customSinks.InitializeAsync(stoppingToken), stoppingToken);
+            await RunPhaseAsync("sinks", () => _customSinks.InitializeAsync(
+                stoppingToken,
+                result => _progress.SetStep("sinks", result.Name, result.Success, result.DurationMs, result.Error)),
+                stoppingToken);
 
             // Phase 3: Detect audio devices and set hardware volumes
             await RunPhaseAsync("devices", () => _playerManager.InitializeHardwareAsync(stoppingToken), stoppingToken);
@@ -102,6 +102,41 @@ public class StartupProgressService
         _ = BroadcastAsync(snapshot);
     }
 
+    /// <summary>
+    /// Records a timed step within a phase (e.g. one custom sink) and broadcasts the change.
+    /// The phase detail shows the step count and the most recent step.
+    /// </summary>
+    /// <param name="phaseId">The phase identifier.</param>
+    /// <param name="stepName">Step name, unique within the phase.</param>
+    /// <param name="success">Whether the step succeeded.</param>
+    /// <param name="durationMs">Time the step took.</param>
+    /// <param name="error">Failure reason, if any.</param>
+    public void SetStep(string phaseId, string stepName, bool success, long durationMs, string? error = null)
+    {
+        StartupProgressResponse snapshot;
+
+        lock (_lock)
+        {
+            var phase = _phases.FirstOrDefault(p => p.Id == phaseId);
+            if (phase == null)
+            {
+                _logger.LogWarning("Unknown startup phase: {PhaseId}", phaseId);
+                return;
+            }
+
+            phase.Steps.RemoveAll(s => s.Name == stepName);
+            phase.Steps.Add(new StartupStepResponse(stepName, success, durationMs, error));
+            phase.Detail = $"{phase.Steps.Count} done, {stepName} {(success ? $"{durationMs}ms" : "failed")}";
+
+            snapshot = BuildSnapshot();
+        }
+
+        _logger.LogDebug("Startup step {PhaseId}/{Step}: {Result} in {Duration}ms",
+            phaseId, stepName, success ? "ok" : "failed", durationMs);
+
+        _ = BroadcastAsync(snapshot);
+    }
+
     /// <summary>
     /// Returns the current startup progress snapshot for the HTTP endpoint.
     /// </summary>
@@ -117,7 +152,9 @@ public class StartupProgressService
     {
         return new StartupProgressResponse(
             IsStartupComplete,
-            _phases.Select(p => new StartupPhaseResponse(p.Id, p.Name, p.Status, p.Detail)).ToList()
+            _phases.Select(p => new StartupPhaseResponse(
+                p.Id, p.Name, p.Status, p.Detail,
+                p.Steps.Count > 0 ? p.Steps.ToList() : null)).ToList()
         );
     }
 
@@ -142,6 +179,7 @@ public class StartupProgressService
         public string Name { get; }
         public StartupPhaseStatus Status { get; set; } = StartupPhaseStatus.Pending;
         public string? Detail { get; set; }
+        public List<StartupStepResponse> Steps { get; } = new();
 
         public StartupPhase(string id, string name)
         {
@@ -170,7 +208,18 @@ public record StartupPhaseResponse(
     string Id,
     string Name,
     [property: JsonConverter(typeof(JsonStringEnumConverter))] StartupPhaseStatus Status,
-    string? Detail
+    string? Detail,
+    List<StartupStepResponse>? Steps = null
+);
+
+/// <summary>
+/// Timing for one step within a startup phase (e.g. loading one custom sink).
+/// </summary>
+public record StartupStepResponse(
+    string Name,
+    bool Success,
+    long DurationMs,
+    string? Error
 );
 
 /// <summary>
@@ -1,4 +1,6 @@
-using System.Diagnostics;
+using System.Collections.Concurrent;
+using MultiRoomAudio.Audio;
+using MultiRoomAudio.Audio.PulseAudio;
 using MultiRoomAudio.Exceptions;
 
 namespace MultiRoomAudio.Services;
@@ -8,6 +10,11 @@ namespace MultiRoomAudio.Services;
 /// Used for device identification during onboarding.
 /// In mock hardware mode, simulates playback without actual audio output.
 /// </summary>
+/// <remarks>
+/// Signals are generated in-process and streamed to PulseAudio through
+/// <see cref="PulseAudioSignalPlayer"/>; there is no temp file or paplay process. One signal
+/// plays per sink at a time, but different sinks can play at once.
+/// </remarks>
 public class ToneGeneratorService
 {
     private readonly ILogger<ToneGeneratorService> _logger;
@@ -16,12 +23,19 @@ public class ToneGeneratorService
     // Default tone parameters
     private const int DefaultFrequency = 1000;  // 1kHz sine wave
     private const int DefaultDuration = 1500;   // 1.5 seconds
-    private const int SampleRate = 44100;
-    private const int Channels = 2;
-    private const int BitsPerSample = 16;
 
-    // Track active playback to prevent overlapping tones
-    private readonly SemaphoreSlim _playbackLock = new(1, 1);
+    /// <summary>
+    /// Rate signals are generated and played at.
+    /// </summary>
+    internal const int SampleRate = 48000;
+
+    /// <summary>
+    /// Time allowed beyond the signal's own length for connecting and draining.
+    /// </summary>
+    private static readonly TimeSpan PlaybackGrace = TimeSpan.FromSeconds(10);
+
+    // Sinks with a signal playing, to prevent overlapping tones on one sink
+    private readonly ConcurrentDictionary<string, byte> _activeSinks = new(StringComparer.Ordinal);
 
     public ToneGeneratorService(ILogger<ToneGeneratorService> logger, EnvironmentService environment)
     {
@@ -38,87 +52,27 @@ public class ToneGeneratorService
     /// <param name="durationMs">Duration in milliseconds (default: 1500)</param>
     /// <param name="channelName">Optional channel name for single-channel playback (e.g., "front-left", "front-right")</param>
     /// <param name="ct">Cancellation token</param>
-    public async Task PlayTestToneAsync(
+    public Task PlayTestToneAsync(
         string sinkName,
         int frequencyHz = DefaultFrequency,
         int durationMs = DefaultDuration,
         string? channelName = null,
         CancellationToken ct = default)
     {
-        // Prevent overlapping playback
-        if (!await _playbackLock.WaitAsync(0, ct))
-        {
-            _logger.LogDebug("Test tone already playing, skipping request");
-            throw new OperationInProgressException("Test tone playback");
-        }
-
-        try
-        {
-            _logger.LogInformation("Playing test tone: {Frequency}Hz for {Duration}ms on sink {Sink}{Channel}",
-                frequencyHz, durationMs, sinkName, channelName != null ? $" (channel: {channelName})" : "");
-
-            // In mock mode, simulate playback without actual audio
-            if (_environment.IsMockHardware)
-            {
-                _logger.LogDebug("Mock mode: simulating test tone playback{Channel}",
-                    channelName != null ? $" on channel {channelName}" : "");
-                // Simulate a brief playback delay (100ms instead of full duration)
-                await Task.Delay(Math.Min(durationMs, 100), ct);
-                _logger.LogDebug("Mock test tone playback completed");
-                return;
-            }
-
-            // Real hardware mode - generate and play via paplay
-            string? tempFile = null;
-            try
-            {
-                // Generate WAV file (with optional channel selection)
-                var wavData = GenerateWavFile(frequencyHz, durationMs, channelName);
-
-                // Write to temp file
-                tempFile = Path.Combine(Path.GetTempPath(), $"testtone_{Guid.NewGuid():N}.wav");
-                await File.WriteAllBytesAsync(tempFile, wavData, ct);
-                _logger.LogDebug("Generated test tone WAV file: {TempFile} ({Size} bytes)", tempFile, wavData.Length);
-
-                // Play via paplay
-                await PlayWithPaplayAsync(sinkName, tempFile, channelMap: null, ct);
-
-                _logger.LogDebug("Test tone playback completed");
-            }
-            finally
-            {
-                // Clean up temp file
-                if (tempFile != null && File.Exists(tempFile))
-                {
-                    try
-                    {
-                        File.Delete(tempFile);
-                        _logger.LogDebug("Cleaned up temp file: {TempFile}", tempFile);
-                    }
-                    catch (Exception ex)
-                    {
-                        _logger.LogWarning(ex, "Failed to clean up temp file: {TempFile}", tempFile);
-                    }
-                }
-            }
-        }
-        finally
-        {
-            _playbackLock.Release();
-        }
+        return PlaySignalAsync(sinkName, TestSignal.Sine, durationMs, frequencyHz, channelName, ct);
     }
 
     /// <summary>
-    /// Play a test tone to a specific channel using paplay's --channel-map flag.
-    /// This is the preferred method for multi-channel devices as it lets PulseAudio
-    /// handle the channel routing directly.
+    /// Play a test tone to a specific channel of a sink.
+    /// This is the preferred method for multi-channel devices: the tone is a mono stream
+    /// mapped to that channel with remixing disabled, so PulseAudio routes it there directly.
     /// </summary>
     /// <param name="sinkName">PulseAudio sink name (device ID)</param>
     /// <param name="channelName">Channel name to route audio to (e.g., "side-left", "front-right")</param>
     /// <param name="frequencyHz">Tone frequency in Hz (default: 1000)</param>
     /// <param name="durationMs">Duration in milliseconds (default: 1500)</param>
     /// <param name="ct">Cancellation token</param>
-    public async Task PlayChannelToneAsync(
+    public Task PlayChannelToneAsync(
         string sinkName,
         string channelName,
         int frequencyHz = DefaultFrequency,
@@ -128,210 +82,113 @@ public class ToneGeneratorService
         if (string.IsNullOrEmpty(channelName))
             throw new ArgumentException("Channel name is required", nameof(channelName));
 
-        // Prevent overlapping playback
-        if (!await _playbackLock.WaitAsync(0, ct))
-        {
-            _logger.LogDebug("Test tone already playing, skipping request");
-            throw new OperationInProgressException("Test tone playback");
-        }
-
-        try
-        {
-            _logger.LogInformation("Playing test tone: {Frequency}Hz for {Duration}ms on sink {Sink} channel {Channel}",
-                frequencyHz, durationMs, sinkName, channelName);
-
-            // In mock mode, simulate playback without actual audio
-            if (_environment.IsMockHardware)
-            {
-                _logger.LogDebug("Mock mode: simulating channel test tone on {Channel}", channelName);
-                await Task.Delay(Math.Min(durationMs, 100), ct);
-                _logger.LogDebug("Mock test tone playback completed");
-                return;
-            }
-
-            // Real hardware mode - generate mono WAV and use --channel-map for routing
-            string? tempFile = null;
-            try
-            {
-                // Generate mono WAV file
-                var wavData = GenerateMonoWavFile(frequencyHz, durationMs);
-
-                // Write to temp file
-                tempFile = Path.Combine(Path.GetTempPath(), $"testtone_{Guid.NewGuid():N}.wav");
-                await File.WriteAllBytesAsync(tempFile, wavData, ct);
-                _logger.LogDebug("Generated mono test tone WAV: {TempFile} ({Size} bytes)", tempFile, wavData.Length);
-
-                // Play via paplay with --channel-map to route to specific channel
-                await PlayWithPaplayAsync(sinkName, tempFile, channelName, ct);
-
-                _logger.LogDebug("Test tone playback completed on channel {Channel}", channelName);
-            }
-            finally
-            {
-                // Clean up temp file
-                if (tempFile != null && File.Exists(tempFile))
-                {
-                    try
-                    {
-                        File.Delete(tempFile);
-                        _logger.LogDebug("Cleaned up temp file: {TempFile}", tempFile);
-                    }
-                    catch (Exception ex)
-                    {
-                        _logger.LogWarning(ex, "Failed to clean up temp file: {TempFile}", tempFile);
-                    }
-                }
-            }
-        }
-        finally
-        {
-            _playbackLock.Release();
-        }
+        return PlayAsync(sinkName, TestSignal.Sine, durationMs, frequencyHz,
+            [channelName], [true], noRemix: true, channelName, ct);
     }
 
     /// <summary>
-    /// Generate a mono WAV file containing a sine wave tone.
-    /// Used with paplay's --channel-map flag to route to specific channels.
+    /// Play a test or measurement signal through a specific PulseAudio sink.
     /// </summary>
-    /// <param name="frequencyHz">Frequency of the tone in Hz</param>
-    /// <param name="durationMs">Duration of the tone in milliseconds</param>
-    private byte[] GenerateMonoWavFile(int frequencyHz, int durationMs)
+    /// <param name="sinkName">PulseAudio sink name (device ID)</param>
+    /// <param name="signal">Signal to play</param>
+    /// <param name="durationMs">Duration in milliseconds (an MLS is rounded up to whole periods)</param>
+    /// <param name="frequencyHz">Tone frequency for <see cref="TestSignal.Sine"/></param>
+    /// <param name="channelName">Optional channel name for single-channel playback (e.g., "front-left", "front-right")</param>
+    /// <param name="ct">Cancellation token</param>
+    public Task PlaySignalAsync(
+        string sinkName,
+        TestSignal signal,
+        int durationMs = DefaultDuration,
+        int frequencyHz = DefaultFrequency,
+        string? channelName = null,
+        CancellationToken ct = default)
     {
-        const int monoChannels = 1;
-        var numSamples = (int)(SampleRate * durationMs / 1000.0);
-        var dataSize = numSamples * monoChannels * (BitsPerSample / 8);
-
-        using var ms = new MemoryStream();
-        using var writer = new BinaryWriter(ms);
+        // A stereo stream, optionally with one side silent
+        var playLeft = string.IsNullOrEmpty(channelName) || IsLeftChannel(channelName);
+        var playRight = string.IsNullOrEmpty(channelName) || IsRightChannel(channelName);
 
-        // WAV header
-        writer.Write("RIFF"u8);
-        writer.Write(36 + dataSize);  // File size - 8
-        writer.Write("WAVE"u8);
-
-        // Format chunk
-        writer.Write("fmt "u8);
-        writer.Write(16);  // Chunk size
-        writer.Write((short)1);  // PCM format
-        writer.Write((short)monoChannels);
-        writer.Write(SampleRate);
-        writer.Write(SampleRate * monoChannels * BitsPerSample / 8);  // Byte rate
-        writer.Write((short)(monoChannels * BitsPerSample / 8));  // Block align
-        writer.Write((short)BitsPerSample);
-
-        // Data chunk
-        writer.Write("data"u8);
-        writer.Write(dataSize);
-
-        // Generate sine wave samples with fade in/out to avoid clicks
-        var fadeLength = Math.Min(numSamples / 10, SampleRate / 20);  // 50ms fade or 10% of duration
-
-        for (int i = 0; i < numSamples; i++)
-        {
-            // Calculate sine wave sample
-            double t = (double)i / SampleRate;
-            double sample = Math.Sin(2 * Math.PI * frequencyHz * t);
-
-            // Apply fade envelope
-            double envelope = 1.0;
-            if (i < fadeLength)
-            {
-                envelope = (double)i / fadeLength;  // Fade in
-            }
-            else if (i > numSamples - fadeLength)
-            {
-                envelope = (double)(numSamples - i) / fadeLength;  // Fade out
-            }
-
-            sample *= envelope;
-
-            // Convert to 16-bit signed integer
-            short sampleInt = (short)(sample * short.MaxValue * 0.4);  // 40% volume
-
-            // Write mono sample
-            writer.Write(sampleInt);
-        }
-
-        return ms.ToArray();
+        return PlayAsync(sinkName, signal, durationMs, frequencyHz,
+            ["front-left", "front-right"], [playLeft, playRight], noRemix: false, channelName, ct);
     }
 
     /// <summary>
-    /// Generate a WAV file containing a sine wave tone.
+    /// Play a measurement signal on both front channels of a sink, for latency calibration.
     /// </summary>
-    /// <param name="frequencyHz">Frequency of the tone in Hz</param>
-    /// <param name="durationMs">Duration of the tone in milliseconds</param>
-    /// <param name="channelName">Optional channel name for single-channel playback (e.g., "front-left", "front-right")</param>
-    private byte[] GenerateWavFile(int frequencyHz, int durationMs, string? channelName = null)
+    /// <param name="sinkName">PulseAudio sink name (device ID)</param>
+    /// <param name="generator">Signal to play, created at <see cref="SampleRate"/></param>
+    /// <param name="ct">Cancellation token</param>
+    /// <returns>
+    /// When PulseAudio played the first sample, in <see cref="System.Diagnostics.Stopwatch"/>
+    /// microseconds, or null if the stream reported no timing.
+    /// </returns>
+    internal async Task<double?> PlayMeasurementAsync(string sinkName, SignalGenerator generator, CancellationToken ct)
     {
-        var numSamples = (int)(SampleRate * durationMs / 1000.0);
-        var dataSize = numSamples * Channels * (BitsPerSample / 8);
-
-        // Determine which channel(s) to play on
-        bool playLeft = true;
-        bool playRight = true;
-
-        if (!string.IsNullOrEmpty(channelName))
+        if (!_activeSinks.TryAdd(sinkName, 0))
         {
-            // Map channel names to left/right playback
-            playLeft = IsLeftChannel(channelName);
-            playRight = IsRightChannel(channelName);
+            _logger.LogDebug("Test tone already playing on {Sink}, skipping measurement", sinkName);
+            throw new OperationInProgressException("Test tone playback");
         }
 
-        using var ms = new MemoryStream();
-        using var writer = new BinaryWriter(ms);
-
-        // WAV header
-        writer.Write("RIFF"u8);
-        writer.Write(36 + dataSize);  // File size - 8
-        writer.Write("WAVE"u8);
-
-        // Format chunk
-        writer.Write("fmt "u8);
-        writer.Write(16);  // Chunk size
-        writer.Write((short)1);  // PCM format
-        writer.Write((short)Channels);
-        writer.Write(SampleRate);
-        writer.Write(SampleRate * Channels * BitsPerSample / 8);  // Byte rate
-        writer.Write((short)(Channels * BitsPerSample / 8));  // Block align
-        writer.Write((short)BitsPerSample);
-
-        // Data chunk
-        writer.Write("data"u8);
-        writer.Write(dataSize);
+        try
+        {
+            var timeout = TimeSpan.FromSeconds((double)generator.TotalFrames / SampleRate) + PlaybackGrace;
+            return await PulseAudioSignalPlayer.PlayAsync(
+                _logger, sinkName, ["front-left", "front-right"], [true, true], generator, SampleRate,
+                noRemix: false, timeout, ct);
+        }
+        finally
+        {
+            _activeSinks.TryRemove(sinkName, out _);
+        }
+    }
 
-        // Generate sine wave samples with fade in/out to avoid clicks
-        var fadeLength = Math.Min(numSamples / 10, SampleRate / 20);  // 50ms fade or 10% of duration
+    private async Task PlayAsync(
+        string sinkName,
+        TestSignal signal,
+        int durationMs,
+        int frequencyHz,
+        string[] channelMap,
+        bool[] activeChannels,
+        bool noRemix,
+        string? channelName,
+        CancellationToken ct)
+    {
+        // Prevent overlapping playback on the same sink
+        if (!_activeSinks.TryAdd(sinkName, 0))
+        {
+            _logger.LogDebug("Test tone already playing on {Sink}, skipping request", sinkName);
+            throw new OperationInProgressException("Test tone playback");
+        }
 
-        for (int i = 0; i < numSamples; i++)
+        try
         {
-            // Calculate sine wave sample
-            double t = (double)i / SampleRate;
-            double sample = Math.Sin(2 * Math.PI * frequencyHz * t);
+            _logger.LogInformation("Playing test {Signal}: {Frequency}Hz for {Duration}ms on sink {Sink}{Channel}",
+                signal, frequencyHz, durationMs, sinkName, channelName != null ? $" (channel: {channelName})" : "");
 
-            // Apply fade envelope
-            double envelope = 1.0;
-            if (i < fadeLength)
-            {
-                envelope = (double)i / fadeLength;  // Fade in
-            }
-            else if (i > numSamples - fadeLength)
+            // In mock mode, simulate playback without actual audio
+            if (_environment.IsMockHardware)
             {
-                envelope = (double)(numSamples - i) / fadeLength;  // Fade out
+                _logger.LogDebug("Mock mode: simulating test tone playback{Channel}",
+                    channelName != null ? $" on channel {channelName}" : "");
+                // Simulate a brief playback delay (100ms instead of full duration)
+                await Task.Delay(Math.Min(durationMs, 100), ct);
+                _logger.LogDebug("Mock test tone playback completed");
+                return;
             }
 
-            sample *= envelope;
-
-            // Convert to 16-bit signed integer
-            short sampleInt = (short)(sample * short.MaxValue * 0.4);  // 40% volume to avoid clipping and reduce loudness
+            var generator = new SignalGenerator(signal, SampleRate, durationMs, frequencyHz);
+            var timeout = TimeSpan.FromSeconds((double)generator.TotalFrames / SampleRate) + PlaybackGrace;
 
-            // Write sample for left channel
-            writer.Write(playLeft ? sampleInt : (short)0);
+            await PulseAudioSignalPlayer.PlayAsync(
+                _logger, sinkName, channelMap, activeChannels, generator, SampleRate, noRemix, timeout, ct);
 
-            // Write sample for right channel
-            writer.Write(playRight ? sampleInt : (short)0);
+            _logger.LogDebug("Test tone playback completed on {Sink}{Channel}",
+                sinkName, channelName != null ? $" channel {channelName}" : "");
+        }
+        finally
+        {
+            _activeSinks.TryRemove(sinkName, out _);
         }
-
-        return ms.ToArray();
     }
 
     /// <summary>
@@ -359,92 +216,4 @@ public class ToneGeneratorService
         "lfe" => true,  // LFE plays on both
         _ => false
     };
-
-    /// <summary>
-    /// Play a WAV file through paplay to a specific sink.
-    /// </summary>
-    /// <param name="sinkName">PulseAudio sink name</param>
-    /// <param name="wavFile">Path to WAV file</param>
-    /// <param name="channelMap">Optional channel map for routing (e.g., "side-left")</param>
-    /// <param name="ct">Cancellation token</param>
-    private async Task PlayWithPaplayAsync(string sinkName, string wavFile, string? channelMap, CancellationToken ct)
-    {
-        var psi = new ProcessStartInfo
-        {
-            FileName = "paplay",
-            RedirectStandardOutput = true,
-            RedirectStandardError = true,
-            UseShellExecute = false,
-            CreateNoWindow = true
-        };
-
-        psi.ArgumentList.Add($"--device={sinkName}");
-        if (!string.IsNullOrEmpty(channelMap))
-        {
-            psi.ArgumentList.Add("--no-remix");
-            psi.ArgumentList.Add($"--channel-map={channelMap}");
-        }
-        psi.ArgumentList.Add(wavFile);
-
-        _logger.LogDebug("Running: paplay --device={Sink}{NoRemix}{ChannelMap} {File}",
-            sinkName,
-            !string.IsNullOrEmpty(channelMap) ? " --no-remix" : "",
-            !string.IsNullOrEmpty(channelMap) ? $" --channel-map={channelMap}" : "",
-            wavFile);
-
-        using var process = new Process { StartInfo = psi };
-        process.Start();
-
-        // Wait for completion with timeout
-        var timeoutMs = 10000;  // 10 second timeout
-        using var timeoutCts = new CancellationTokenSource(timeoutMs);
-        using var linkedCts = CancellationTokenSource.CreateLinkedTokenSource(ct, timeoutCts.Token);
-
-        try
-        {
-            await process.WaitForExitAsync(linkedCts.Token);
-        }
-        catch (OperationCanceledException) when (timeoutCts.IsCancellationRequested)
-        {
-            _logger.LogWarning("paplay timed out after {Timeout}ms, killing process", timeoutMs);
-            process.Kill();
-            throw new TimeoutException($"Test tone playback timed out after {timeoutMs}ms");
-        }
-
-        if (process.ExitCode != 0)
-        {
-            var error = await process.StandardError.ReadToEndAsync(ct);
-            _logger.LogWarning("paplay exited with code {ExitCode}: {Error}", process.ExitCode, error);
-            throw new InvalidOperationException($"paplay failed: {error}");
-        }
-    }
-
-    /// <summary>
-    /// Check if paplay is available on the system.
-    /// </summary>
-    public async Task<bool> IsPaplayAvailableAsync()
-    {
-        try
-        {
-            var psi = new ProcessStartInfo
-            {
-                FileName = "which",
-                Arguments = "paplay",
-                RedirectStandardOutput = true,
-                UseShellExecute = false,
-                CreateNoWindow = true
-            };
-
-            using var process = Process.Start(psi);
-            if (process == null)
-                return false;
-
-            await process.WaitForExitAsync();
-            return process.ExitCode == 0;
-        }
-        catch
-        {
-            return false;
-        }
-    }
 }
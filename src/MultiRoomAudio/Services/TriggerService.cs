@@ -1,12 +1,11 @@
 using System.Collections.Concurrent;
-using System.Timers;
 using Microsoft.AspNetCore.SignalR;
 using MultiRoomAudio.Hubs;
 using MultiRoomAudio.Models;
 using MultiRoomAudio.Relay;
+using MultiRoomAudio.Utilities;
 using YamlDotNet.Serialization;
 using YamlDotNet.Serialization.NamingConventions;
-using Timer = System.Timers.Timer;
 
 namespace MultiRoomAudio.Services;
 
@@ -23,6 +22,7 @@ public class TriggerService : IAsyncDisposable
     private readonly IRelayDeviceEnumerator _deviceEnumerator;
     private readonly IRelayBoardFactory _boardFactory;
     private readonly IHubContext<PlayerStatusHub>? _hubContext;
+    private readonly HotplugMonitor? _hotplug;
     private readonly string _configPath;
     private readonly IDeserializer _deserializer;
     private readonly ISerializer _serializer;
@@ -34,12 +34,33 @@ public class TriggerService : IAsyncDisposable
     private readonly Dictionary<string, TriggerFeatureState> _boardStates = new();
     private readonly Dictionary<string, string?> _boardErrors = new();
 
+    // Per-board command queues: relay changes from player events are written asynchronously.
+    // Kept per board ID across reconnects; the queue resolves the current board when it writes.
+    private readonly Dictionary<string, RelayCommandQueue> _commandQueues = new();
+
     private TriggerFeatureConfiguration _config = new();
     private bool _disposed;
 
-    // Track active triggers and their off timers using composite key (boardId, channel)
+    // Track active triggers using composite key (boardId, channel)
     private readonly ConcurrentDictionary<(string BoardId, int Channel), TriggerChannelState> _channelStates = new();
 
+    // Off-delay timers for all channels of all boards, keyed by (boardId, channel)
+    private readonly TimerWheel<(string BoardId, int Channel)> _offTimers;
+
+    // Fires once USB/serial hotplug events have settled, to reconnect disconnected boards
+    private readonly Timer _hotplugTimer;
+
+    /// <summary>
+    /// Quiet time after a USB, serial or hidraw hotplug event before reconnecting boards.
+    /// A board's interfaces appear one at a time and udev needs a moment to set permissions.
+    /// </summary>
+    private const int HotplugSettleMs = 1000;
+
+    // Sink name -> triggers assigned to it (in configuration order), rebuilt whenever the
+    // trigger configuration changes. Replaced as a whole, so player events read it without locking.
+    private volatile Dictionary<string, (string BoardId, TriggerConfiguration Trigger)[]> _triggerIndex =
+        new(StringComparer.OrdinalIgnoreCase);
+
     /// <summary>
     /// Internal state for a trigger channel.
     /// </summary>
@@ -47,8 +68,13 @@ public class TriggerService : IAsyncDisposable
     {
         public bool IsActive { get; set; }
         public DateTime? LastActivated { get; set; }
-        public Timer? OffDelayTimer { get; set; }
         public int ActivePlayerCount { get; set; }
+
+        // When the relay write for the current power-on completed (null while off or queued)
+        public DateTime? PoweredOnAt { get; set; }
+        public bool AudibleRecorded { get; set; }
+        public int? LastTriggerToAudibleMs { get; set; }
+        public int ClippedStarts { get; set; }
     }
 
     public TriggerService(
@@ -58,7 +84,8 @@ public class TriggerService : IAsyncDisposable
         EnvironmentService environment,
         IRelayDeviceEnumerator deviceEnumerator,
         IRelayBoardFactory boardFactory,
-        IHubContext<PlayerStatusHub>? hubContext = null)
+        IHubContext<PlayerStatusHub>? hubContext = null,
+        HotplugMonitor? hotplug = null)
     {
         _logger = logger;
         _loggerFactory = loggerFactory;
@@ -66,7 +93,9 @@ public class TriggerService : IAsyncDisposable
         _deviceEnumerator = deviceEnumerator;
         _boardFactory = boardFactory;
         _hubContext = hubContext;
+        _hotplug = hotplug;
         _configPath = Path.Combine(environment.ConfigPath, "triggers.yaml");
+        _offTimers = new TimerWheel<(string BoardId, int Channel)>(TimeSpan.FromSeconds(1), logger);
 
         _deserializer = new DeserializerBuilder()
             .WithNamingConvention(UnderscoredNamingConvention.Instance)
@@ -77,6 +106,12 @@ public class TriggerService : IAsyncDisposable
             .WithNamingConvention(UnderscoredNamingConvention.Instance)
             .ConfigureDefaultValuesHandling(DefaultValuesHandling.OmitNull | DefaultValuesHandling.OmitDefaults)
             .Build();
+
+        _hotplugTimer = new Timer(_ => ReconnectAfterHotplug(), null, Timeout.Infinite, Timeout.Infinite);
+        if (_hotplug != null)
+        {
+            _hotplug.DeviceChanged += OnHotplug;
+        }
     }
 
     #region Lifecycle
@@ -91,6 +126,7 @@ public class TriggerService : IAsyncDisposable
 
         // Load configuration (with migration if needed)
         _config = LoadConfiguration();
+        RebuildTriggerIndex();
 
         if (_config.Enabled)
         {
@@ -122,20 +158,13 @@ public class TriggerService : IAsyncDisposable
         _logger.LogInformation("Trigger service shutting down ({Count} boards)...", _relayBoards.Count);
 
         // Cancel all pending off timers
-        var cancelledTimers = 0;
-        foreach (var kvp in _channelStates)
-        {
-            if (kvp.Value.OffDelayTimer != null)
-            {
-                kvp.Value.OffDelayTimer.Stop();
-                kvp.Value.OffDelayTimer.Dispose();
-                kvp.Value.OffDelayTimer = null;
-                cancelledTimers++;
-            }
-        }
+        var cancelledTimers = _offTimers.CancelAll();
         if (cancelledTimers > 0)
             _logger.LogDebug("Cancelled {Count} pending relay off timers", cancelledTimers);
 
+        // Stop the command queues so nothing is written after the shutdown behavior
+        DisposeCommandQueues();
+
         // Apply shutdown behavior for each board and dispose
         foreach (var boardConfig in _config.Boards)
         {
@@ -160,17 +189,21 @@ public class TriggerService : IAsyncDisposable
 
     /// <summary>
     /// Get the current status of the trigger feature (all boards).
-    /// Also attempts to reconnect any disconnected boards.
+    /// Also attempts to reconnect any disconnected boards, unless the hotplug monitor is
+    /// running and will reconnect them when they are plugged back in.
     /// </summary>
     public TriggerFeatureResponse GetStatus()
     {
         // Attempt to reconnect any disconnected boards
-        foreach (var boardConfig in _config.Boards)
+        if (_hotplug?.IsRunning != true)
         {
-            if (_boardStates.TryGetValue(boardConfig.BoardId, out var state)
-                && state == TriggerFeatureState.Disconnected)
+            foreach (var boardConfig in _config.Boards)
             {
-                TryGetOrReconnectBoard(boardConfig.BoardId);
+                if (_boardStates.TryGetValue(boardConfig.BoardId, out var state)
+                    && state == TriggerFeatureState.Disconnected)
+                {
+                    TryGetOrReconnectBoard(boardConfig.BoardId);
+                }
             }
         }
 
@@ -237,9 +270,10 @@ public class TriggerService : IAsyncDisposable
                 RelayState: relayState,
                 IsActive: channelState.IsActive,
                 LastActivated: channelState.LastActivated,
-                ScheduledOffTime: channelState.OffDelayTimer?.Enabled == true
-                    ? channelState.LastActivated?.AddSeconds(config.OffDelaySeconds)
-                    : null
+                ScheduledOffTime: _offTimers.GetDueTime((boardId, channel)),
+                AmpWarmupMs: config.AmpWarmupMs,
+                LastTriggerToAudibleMs: channelState.LastTriggerToAudibleMs,
+                ClippedStarts: channelState.ClippedStarts
             ));
         }
 
@@ -256,7 +290,8 @@ public class TriggerService : IAsyncDisposable
             Triggers: triggers,
             CurrentRelayStates: relayBoard?.CurrentState ?? 0,
             StartupBehavior: boardConfig.StartupBehavior,
-            ShutdownBehavior: boardConfig.ShutdownBehavior
+            ShutdownBehavior: boardConfig.ShutdownBehavior,
+            CommandQueue: GetCommandQueueStats(boardId)
         );
     }
 
@@ -374,6 +409,9 @@ public class TriggerService : IAsyncDisposable
     /// </summary>
     public bool RemoveBoard(string boardId)
     {
+        // Outside the config lock: the queue's worker may be saving configuration
+        DisposeCommandQueues(new[] { boardId });
+
         lock (_configLock)
         {
             var boardConfig = _config.Boards.FirstOrDefault(b => b.BoardId == boardId);
@@ -437,15 +475,16 @@ public class TriggerService : IAsyncDisposable
                 boardConfig.ChannelCount = newCount;
 
                 // If reducing channels, turn off relays beyond new count
-                if (newCount < oldCount && _relayBoards.TryGetValue(boardId, out var board))
+                if (newCount < oldCount && _relayBoards.ContainsKey(boardId))
                 {
                     for (int ch = newCount + 1; ch <= oldCount; ch++)
                     {
                         CancelOffTimer(boardId, ch);
-                        board.SetRelay(ch, false);
+                        QueueRelay(boardId, ch, false);
                         if (_channelStates.TryGetValue((boardId, ch), out var state))
                         {
                             state.IsActive = false;
+                            state.PoweredOnAt = null;
                             state.ActivePlayerCount = 0;
                         }
                     }
@@ -494,7 +533,7 @@ public class TriggerService : IAsyncDisposable
     /// <summary>
     /// Configure a trigger channel on a specific board.
     /// </summary>
-    public bool ConfigureTrigger(string boardId, int channel, string? customSinkName, int offDelaySeconds, string? zoneName)
+    public bool ConfigureTrigger(string boardId, int channel, string? customSinkName, int offDelaySeconds, string? zoneName, int? ampWarmupMs = null)
     {
         var boardConfig = _config.Boards.FirstOrDefault(b => b.BoardId == boardId);
         if (boardConfig == null)
@@ -527,25 +566,30 @@ public class TriggerService : IAsyncDisposable
             trigger.CustomSinkName = customSinkName;
             trigger.OffDelaySeconds = offDelaySeconds;
             trigger.ZoneName = zoneName;
+            if (ampWarmupMs.HasValue)
+            {
+                trigger.AmpWarmupMs = Math.Clamp(ampWarmupMs.Value, 0, 5000);
+            }
 
             // If unassigning, turn off the relay and cancel timer
             if (string.IsNullOrEmpty(customSinkName))
             {
                 CancelOffTimer(boardId, channel);
-                if (_relayBoards.TryGetValue(boardId, out var board))
+                if (_relayBoards.ContainsKey(boardId))
                 {
-                    board.SetRelay(channel, false);
+                    QueueRelay(boardId, channel, false);
                 }
                 if (_channelStates.TryGetValue((boardId, channel), out var state))
                 {
                     state.IsActive = false;
+                    state.PoweredOnAt = null;
                     state.ActivePlayerCount = 0;
                 }
             }
 
             SaveConfiguration();
-            _logger.LogInformation("Trigger {BoardId}/{Channel} configured: sink={Sink}, delay={Delay}s, zone={Zone}",
-                boardId, channel, customSinkName ?? "(none)", offDelaySeconds, zoneName ?? "(none)");
+            _logger.LogInformation("Trigger {BoardId}/{Channel} configured: sink={Sink}, delay={Delay}s, warm-up={Warmup}ms, zone={Zone}",
+                boardId, channel, customSinkName ?? "(none)", offDelaySeconds, trigger.AmpWarmupMs, zoneName ?? "(none)");
 
             return true;
         }
@@ -575,7 +619,8 @@ public class TriggerService : IAsyncDisposable
             CancelOffTimer(boardId, channel);
         }
 
-        var result = board.SetRelay(channel, on);
+        // Through the queue so the test is ordered with trigger changes; the caller wants the result
+        var result = GetCommandQueue(boardId).Enqueue(channel, on).GetAwaiter().GetResult();
         if (result)
         {
             _logger.LogInformation("Manual relay test: Board '{BoardId}' channel {Channel} → {State}",
@@ -626,18 +671,9 @@ public class TriggerService : IAsyncDisposable
         if (!_config.Enabled || string.IsNullOrEmpty(deviceId))
             return;
 
-        // Find the trigger for this device across all boards
-        foreach (var boardConfig in _config.Boards)
+        if (TryFindTrigger(deviceId, out var trigger))
         {
-            var trigger = boardConfig.Triggers.FirstOrDefault(t =>
-                !string.IsNullOrEmpty(t.CustomSinkName) &&
-                string.Equals(t.CustomSinkName, deviceId, StringComparison.OrdinalIgnoreCase));
-
-            if (trigger != null && _boardStates.ContainsKey(boardConfig.BoardId))
-            {
-                ActivateTrigger(boardConfig.BoardId, trigger.Channel, playerName);
-                return;
-            }
+            ActivateTrigger(trigger.BoardId, trigger.Trigger.Channel, playerName);
         }
     }
 
@@ -649,18 +685,94 @@ public class TriggerService : IAsyncDisposable
         if (!_config.Enabled || string.IsNullOrEmpty(deviceId))
             return;
 
-        foreach (var boardConfig in _config.Boards)
+        if (TryFindTrigger(deviceId, out var trigger))
         {
-            var trigger = boardConfig.Triggers.FirstOrDefault(t =>
-                !string.IsNullOrEmpty(t.CustomSinkName) &&
-                string.Equals(t.CustomSinkName, deviceId, StringComparison.OrdinalIgnoreCase));
+            DeactivateTrigger(trigger.BoardId, trigger.Trigger.Channel, trigger.Trigger.OffDelaySeconds, playerName);
+        }
+    }
 
-            if (trigger != null && _boardStates.ContainsKey(boardConfig.BoardId))
-            {
-                DeactivateTrigger(boardConfig.BoardId, trigger.Channel, trigger.OffDelaySeconds, playerName);
+    /// <summary>
+    /// Called when a player's audio starts (pipeline reached Playing). Records how long after
+    /// the relay switched on that happened, and whether it beat the amplifier warm-up.
+    /// </summary>
+    public void OnPlayerAudible(string playerName, string? deviceId)
+    {
+        if (!_config.Enabled || string.IsNullOrEmpty(deviceId))
+            return;
+
+        if (!TryFindTrigger(deviceId, out var trigger) ||
+            !_channelStates.TryGetValue((trigger.BoardId, trigger.Trigger.Channel), out var state))
+            return;
+
+        lock (_stateLock)
+        {
+            if (state.AudibleRecorded || state.PoweredOnAt == null)
                 return;
+
+            state.AudibleRecorded = true;
+            var elapsedMs = (int)(DateTime.UtcNow - state.PoweredOnAt.Value).TotalMilliseconds;
+            state.LastTriggerToAudibleMs = elapsedMs;
+
+            if (elapsedMs < trigger.Trigger.AmpWarmupMs)
+            {
+                state.ClippedStarts++;
+                _logger.LogWarning(
+                    "Player '{Player}' audible {Elapsed}ms after relay {BoardId}/{Channel} switched on - before the {Warmup}ms amplifier warm-up",
+                    playerName, elapsedMs, trigger.BoardId, trigger.Trigger.Channel, trigger.Trigger.AmpWarmupMs);
+            }
+            else
+            {
+                _logger.LogInformation(
+                    "Player '{Player}' audible {Elapsed}ms after relay {BoardId}/{Channel} switched on",
+                    playerName, elapsedMs, trigger.BoardId, trigger.Trigger.Channel);
+            }
+        }
+    }
+
+    /// <summary>
+    /// How much longer playback to <paramref name="deviceId"/> should be held for its
+    /// amplifier to warm up: the full warm-up if the relay is off or still switching,
+    /// the unexpired part if it was switched on recently, 0 if warm or no trigger.
+    /// </summary>
+    public int GetRemainingWarmupMs(string? deviceId)
+    {
+        if (!_config.Enabled || string.IsNullOrEmpty(deviceId) || !TryFindTrigger(deviceId, out var trigger))
+            return 0;
+
+        var warmupMs = trigger.Trigger.AmpWarmupMs;
+        if (warmupMs <= 0)
+            return 0;
+
+        if (_channelStates.TryGetValue((trigger.BoardId, trigger.Trigger.Channel), out var state) &&
+            state.PoweredOnAt is { } poweredOnAt)
+        {
+            var elapsedMs = (int)(DateTime.UtcNow - poweredOnAt).TotalMilliseconds;
+            return Math.Max(0, warmupMs - elapsedMs);
+        }
+
+        return warmupMs;
+    }
+
+    /// <summary>
+    /// Finds the trigger driving <paramref name="deviceId"/>: the first channel assigned to
+    /// it on a connected board.
+    /// </summary>
+    private bool TryFindTrigger(string deviceId, out (string BoardId, TriggerConfiguration Trigger) trigger)
+    {
+        if (_triggerIndex.TryGetValue(deviceId, out var triggers))
+        {
+            foreach (var candidate in triggers)
+            {
+                if (_boardStates.ContainsKey(candidate.BoardId))
+                {
+                    trigger = candidate;
+                    return true;
+                }
             }
         }
+
+        trigger = default;
+        return false;
     }
 
     /// <summary>
@@ -670,40 +782,31 @@ public class TriggerService : IAsyncDisposable
     {
         lock (_configLock)
         {
-            var affected = false;
+            if (!_triggerIndex.TryGetValue(sinkName, out var affectedTriggers))
+                return;
 
-            foreach (var boardConfig in _config.Boards)
+            foreach (var (boardId, trigger) in affectedTriggers)
             {
-                var affectedTriggers = boardConfig.Triggers
-                    .Where(t => string.Equals(t.CustomSinkName, sinkName, StringComparison.OrdinalIgnoreCase))
-                    .ToList();
-
-                foreach (var trigger in affectedTriggers)
-                {
-                    _logger.LogInformation("Unassigning trigger {BoardId}/{Channel} - sink '{SinkName}' was deleted",
-                        boardConfig.BoardId, trigger.Channel, sinkName);
+                _logger.LogInformation("Unassigning trigger {BoardId}/{Channel} - sink '{SinkName}' was deleted",
+                    boardId, trigger.Channel, sinkName);
 
-                    trigger.CustomSinkName = null;
+                trigger.CustomSinkName = null;
 
-                    // Turn off relay and cancel timer
-                    CancelOffTimer(boardConfig.BoardId, trigger.Channel);
-                    if (_relayBoards.TryGetValue(boardConfig.BoardId, out var board))
-                    {
-                        board.SetRelay(trigger.Channel, false);
-                    }
-                    if (_channelStates.TryGetValue((boardConfig.BoardId, trigger.Channel), out var state))
-                    {
-                        state.IsActive = false;
-                        state.ActivePlayerCount = 0;
-                    }
-                    affected = true;
+                // Turn off relay and cancel timer
+                CancelOffTimer(boardId, trigger.Channel);
+                if (_relayBoards.ContainsKey(boardId))
+                {
+                    QueueRelay(boardId, trigger.Channel, false);
+                }
+                if (_channelStates.TryGetValue((boardId, trigger.Channel), out var state))
+                {
+                    state.IsActive = false;
+                    state.PoweredOnAt = null;
+                    state.ActivePlayerCount = 0;
                 }
             }
 
-            if (affected)
-            {
-                SaveConfiguration();
-            }
+            SaveConfiguration();
         }
     }
 
@@ -914,11 +1017,7 @@ public class TriggerService : IAsyncDisposable
     /// </summary>
     private void RestorePreviousState(IRelayBoard board, TriggerBoardConfiguration config, int previousState)
     {
-        for (int i = 1; i <= config.ChannelCount; i++)
-        {
-            bool wasOn = (previousState & (1 << (i - 1))) != 0;
-            board.SetRelay(i, wasOn);
-        }
+        board.SetRelays((1 << config.ChannelCount) - 1, previousState);
         _logger.LogInformation("Board '{BoardId}': Restored previous relay state 0x{State:X2} (manual reconnect)", config.BoardId, previousState);
     }
 
@@ -939,10 +1038,8 @@ public class TriggerService : IAsyncDisposable
                 break;
 
             case RelayStartupBehavior.AllOn:
-                for (int i = 1; i <= config.ChannelCount; i++)
-                {
-                    board.SetRelay(i, true);
-                }
+                var allChannels = (1 << config.ChannelCount) - 1;
+                board.SetRelays(allChannels, allChannels);
                 _logger.LogInformation("Startup behavior: Board '{BoardId}' all {Count} relays → ON",
                     config.BoardId, config.ChannelCount);
                 break;
@@ -974,10 +1071,8 @@ public class TriggerService : IAsyncDisposable
                 break;
 
             case RelayStartupBehavior.AllOn:
-                for (int i = 1; i <= config.ChannelCount; i++)
-                {
-                    board.SetRelay(i, true);
-                }
+                var allChannels = (1 << config.ChannelCount) - 1;
+                board.SetRelays(allChannels, allChannels);
                 _logger.LogInformation("Shutdown behavior: Board '{BoardId}' all {Count} relays → ON",
                     config.BoardId, config.ChannelCount);
                 break;
@@ -1065,6 +1160,48 @@ public class TriggerService : IAsyncDisposable
         return null;
     }
 
+    private void OnHotplug(object? sender, HotplugEventArgs e)
+    {
+        if (_disposed || e.Device.Subsystem is not ("tty" or "hidraw" or "usb"))
+            return;
+
+        // Restart the settle window on every event of a burst
+        _hotplugTimer.Change(HotplugSettleMs, Timeout.Infinite);
+    }
+
+    /// <summary>
+    /// Reconnect boards after a USB device was plugged in or removed.
+    /// Boards that lost their connection are marked disconnected first.
+    /// </summary>
+    private void ReconnectAfterHotplug()
+    {
+        if (_disposed || !_config.Enabled)
+            return;
+
+        try
+        {
+            lock (_stateLock)
+            {
+                foreach (var boardConfig in _config.Boards.ToList())
+                {
+                    var boardId = boardConfig.BoardId;
+                    if (_relayBoards.TryGetValue(boardId, out var board) && !board.IsConnected
+                        && _boardStates.TryGetValue(boardId, out var state) && state == TriggerFeatureState.Connected)
+                    {
+                        _logger.LogInformation("Board '{BoardId}' lost its connection", boardId);
+                        _boardStates[boardId] = TriggerFeatureState.Disconnected;
+                    }
+
+                    TryGetOrReconnectBoard(boardId);
+                }
+            }
+        }
+        catch (Exception ex)
+        {
+            _logger.LogError(ex, "Error reconnecting relay boards after hotplug event");
+        }
+    }
+
     private void ActivateTrigger(string boardId, int channel, string playerName)
     {
         if (!_channelStates.TryGetValue((boardId, channel), out var state))
@@ -1083,14 +1220,24 @@ public class TriggerService : IAsyncDisposable
             if (!state.IsActive)
             {
                 state.IsActive = true;
-                var board = TryGetOrReconnectBoard(boardId);
-                if (board != null)
+                state.PoweredOnAt = null;
+                state.AudibleRecorded = false;
+                QueueRelay(boardId, channel, true, success =>
                 {
-                    var success = board.SetRelay(channel, true);
+                    if (success)
+                    {
+                        lock (_stateLock)
+                        {
+                            // Warm-up counts from the board acknowledging, not from the request
+                            if (state.IsActive)
+                                state.PoweredOnAt ??= DateTime.UtcNow;
+                        }
+                    }
+
                     _logger.LogInformation(
                         "Relay activated: Board '{BoardId}' channel {Channel} → ON (player '{Player}' started){Result}",
                         boardId, channel, playerName, success ? "" : " [FAILED]");
-                }
+                });
             }
             else
             {
@@ -1122,14 +1269,10 @@ public class TriggerService : IAsyncDisposable
                 {
                     // Immediate off
                     state.IsActive = false;
-                    var board = TryGetOrReconnectBoard(boardId);
-                    if (board != null)
-                    {
-                        var success = board.SetRelay(channel, false);
-                        _logger.LogInformation(
-                            "Relay deactivated: Board '{BoardId}' channel {Channel} → OFF (no active players){Result}",
-                            boardId, channel, success ? "" : " [FAILED]");
-                    }
+                    state.PoweredOnAt = null;
+                    QueueRelay(boardId, channel, false, success => _logger.LogInformation(
+                        "Relay deactivated: Board '{BoardId}' channel {Channel} → OFF (no active players){Result}",
+                        boardId, channel, success ? "" : " [FAILED]"));
                 }
                 else
                 {
@@ -1143,28 +1286,81 @@ public class TriggerService : IAsyncDisposable
         }
     }
 
-    private void StartOffTimer(string boardId, int channel, int delaySeconds)
+    /// <summary>
+    /// Queues a relay change without waiting for the board.
+    /// <paramref name="onWritten"/> runs on a thread-pool thread once the frame is written.
+    /// </summary>
+    private void QueueRelay(string boardId, int channel, bool on, Action<bool>? onWritten = null)
     {
-        if (!_channelStates.TryGetValue((boardId, channel), out var state))
-            return;
+        var task = GetCommandQueue(boardId).Enqueue(channel, on);
+        if (onWritten != null)
+        {
+            task.ContinueWith(t => onWritten(t.Result), TaskScheduler.Default);
+        }
+    }
 
-        CancelOffTimer(boardId, channel);
+    private RelayCommandQueue GetCommandQueue(string boardId)
+    {
+        lock (_commandQueues)
+        {
+            if (!_commandQueues.TryGetValue(boardId, out var queue))
+            {
+                queue = new RelayCommandQueue(
+                    boardId,
+                    () =>
+                    {
+                        lock (_stateLock)
+                        {
+                            return TryGetOrReconnectBoard(boardId);
+                        }
+                    },
+                    _loggerFactory.CreateLogger<RelayCommandQueue>());
+                _commandQueues[boardId] = queue;
+            }
 
-        var timer = new Timer(delaySeconds * 1000);
-        timer.AutoReset = false;
-        timer.Elapsed += (_, _) => OnOffTimerElapsed(boardId, channel);
-        state.OffDelayTimer = timer;
-        timer.Start();
+            return queue;
+        }
     }
 
-    private void CancelOffTimer(string boardId, int channel)
+    private RelayCommandQueueStats? GetCommandQueueStats(string boardId)
+    {
+        lock (_commandQueues)
+        {
+            return _commandQueues.TryGetValue(boardId, out var queue) ? queue.GetStats() : null;
+        }
+    }
+
+    /// <summary>
+    /// Stops the given boards' queues (all if null). Pending changes are dropped.
+    /// Must not be called while holding the state lock (the worker may be waiting for it).
+    /// </summary>
+    private void DisposeCommandQueues(IEnumerable<string>? boardIds = null)
     {
-        if (_channelStates.TryGetValue((boardId, channel), out var state) && state.OffDelayTimer != null)
+        var queues = new List<RelayCommandQueue>();
+        lock (_commandQueues)
         {
-            state.OffDelayTimer.Stop();
-            state.OffDelayTimer.Dispose();
-            state.OffDelayTimer = null;
+            foreach (var boardId in boardIds ?? _commandQueues.Keys.ToList())
+            {
+                if (_commandQueues.Remove(boardId, out var queue))
+                    queues.Add(queue);
+            }
         }
+
+        foreach (var queue in queues)
+        {
+            queue.Dispose();
+        }
+    }
+
+    private void StartOffTimer(string boardId, int channel, int delaySeconds)
+    {
+        _offTimers.Schedule((boardId, channel), TimeSpan.FromSeconds(delaySeconds),
+            () => OnOffTimerElapsed(boardId, channel));
+    }
+
+    private void CancelOffTimer(string boardId, int channel)
+    {
+        _offTimers.Cancel((boardId, channel));
     }
 
     private void OnOffTimerElapsed(string boardId, int channel)
@@ -1178,15 +1374,10 @@ public class TriggerService : IAsyncDisposable
             if (state.ActivePlayerCount == 0 && state.IsActive)
             {
                 state.IsActive = false;
-                state.OffDelayTimer = null;
-                var board = TryGetOrReconnectBoard(boardId);
-                if (board != null)
-                {
-                    var success = board.SetRelay(channel, false);
-                    _logger.LogInformation(
-                        "Relay deactivated: Board '{BoardId}' channel {Channel} → OFF (delay timer expired){Result}",
-                        boardId, channel, success ? "" : " [FAILED]");
-                }
+                state.PoweredOnAt = null;
+                QueueRelay(boardId, channel, false, success => _logger.LogInformation(
+                    "Relay deactivated: Board '{BoardId}' channel {Channel} → OFF (delay timer expired){Result}",
+                    boardId, channel, success ? "" : " [FAILED]"));
             }
             else if (state.ActivePlayerCount > 0)
             {
@@ -1248,6 +1439,37 @@ public class TriggerService : IAsyncDisposable
     private void SaveConfiguration()
     {
         SaveConfigurationInternal(_config);
+        RebuildTriggerIndex();
+    }
+
+    /// <summary>
+    /// Rebuilds the sink name lookup used by player events and sink deletion.
+    /// Called whenever the trigger configuration is loaded or saved.
+    /// </summary>
+    private void RebuildTriggerIndex()
+    {
+        var lists = new Dictionary<string, List<(string BoardId, TriggerConfiguration Trigger)>>(StringComparer.OrdinalIgnoreCase);
+
+        lock (_configLock)
+        {
+            foreach (var boardConfig in _config.Boards)
+            {
+                foreach (var trigger in boardConfig.Triggers)
+                {
+                    if (string.IsNullOrEmpty(trigger.CustomSinkName))
+                        continue;
+
+                    if (!lists.TryGetValue(trigger.CustomSinkName, out var list))
+                    {
+                        list = new List<(string BoardId, TriggerConfiguration Trigger)>();
+                        lists[trigger.CustomSinkName] = list;
+                    }
+                    list.Add((boardConfig.BoardId, trigger));
+                }
+            }
+        }
+
+        _triggerIndex = lists.ToDictionary(kv => kv.Key, kv => kv.Value.ToArray(), StringComparer.OrdinalIgnoreCase);
     }
 
     private void SaveConfigurationInternal(TriggerFeatureConfiguration config)
@@ -1262,7 +1484,8 @@ public class TriggerService : IAsyncDisposable
                     board.Triggers = board.Triggers
                         .Where(t => !string.IsNullOrEmpty(t.CustomSinkName) ||
                                     !string.IsNullOrEmpty(t.ZoneName) ||
-                                    t.OffDelaySeconds != 60)
+                                    t.OffDelaySeconds != 60 ||
+                                    t.AmpWarmupMs != 0)
                         .ToList();
                 }
 
@@ -1285,7 +1508,13 @@ public class TriggerService : IAsyncDisposable
             return;
 
         _disposed = true;
+        if (_hotplug != null)
+        {
+            _hotplug.DeviceChanged -= OnHotplug;
+        }
+        await _hotplugTimer.DisposeAsync();
         await ShutdownAsync(CancellationToken.None);
+        _offTimers.Dispose();
         GC.SuppressFinalize(this);
     }
 }
@@ -0,0 +1,322 @@
+using Microsoft.AspNetCore.SignalR;
+using MultiRoomAudio.Hubs;
+using MultiRoomAudio.Models;
+
+namespace MultiRoomAudio.Services;
+
+/// <summary>
+/// Background service that samples every playing zone's audio clock against the server
+/// timeline and tracks how far each pair of zones is apart.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Each player syncs on its own: it estimates the server clock, schedules samples against its
+/// sound card's audio clock and corrects its own sync error. Nothing checks that two zones agree
+/// with each other. Every <see cref="SampleIntervalMs"/> this service reads each zone's position
+/// on the server timeline, relative to the system clock:
+/// </para>
+/// <code>
+/// position = (audio clock - system clock) + server offset - sync error
+/// </code>
+/// <para>
+/// The first term is how far the sound card clock has moved from the system clock since
+/// playback started, the second is the player's own estimate of the server clock, and the
+/// third is how far behind its schedule it is. Zones in sync have equal positions; the pairwise
+/// difference is their offset (positive when the first zone plays ahead). Static delay offsets
+/// are deliberate and are not counted.
+/// </para>
+/// <para>
+/// Each pair keeps a window of <see cref="WindowSamples"/> offsets for its mean and jitter. A pair
+/// in the same Music Assistant group whose offset stays past <see cref="DivergenceThresholdMs"/>
+/// for <see cref="AlertAfterSamples"/> samples raises an alert, which clears once the offset has
+/// stayed below half the threshold as long. The matrix is pushed to web clients over SignalR
+/// (<c>SyncMatrixUpdate</c>, <c>SyncAlert</c>) and served at <c>GET /api/players/sync</c>.
+/// </para>
+/// </remarks>
+public sealed class ZoneSyncMonitor : BackgroundService
+{
+    private readonly ILogger<ZoneSyncMonitor> _logger;
+    private readonly PlayerManagerService _players;
+    private readonly IHubContext<PlayerStatusHub>? _hubContext;
+    private readonly object _lock = new();
+    private readonly Dictionary<(string A, string B), PairState> _pairs = new();
+
+    /// <summary>
+    /// Offset at which two zones of a group are reported as out of sync. Around 20 ms, two
+    /// rooms heard at once start to sound like an echo.
+    /// </summary>
+    public const double DivergenceThresholdMs = 20.0;
+
+    /// <summary>
+    /// How often zones are sampled.
+    /// </summary>
+    private const int SampleIntervalMs = 500;
+
+    /// <summary>
+    /// Offsets kept per pair for the mean and jitter (20 s).
+    /// </summary>
+    private const int WindowSamples = 40;
+
+    /// <summary>
+    /// Consecutive samples past the threshold before an alert is raised (or below half of it before
+    /// it clears), so a single glitch does not alert.
+    /// </summary>
+    private const int AlertAfterSamples = 4;
+
+    /// <summary>
+    /// Pairs not sampled for this long (a zone stopped) are dropped.
+    /// </summary>
+    private static readonly TimeSpan StaleAfter = TimeSpan.FromSeconds(5);
+
+    private SyncMatrixResponse _latest = new(DateTime.UtcNow, DivergenceThresholdMs, [], [], [], []);
+
+    public ZoneSyncMonitor(
+        ILogger<ZoneSyncMonitor> logger,
+        PlayerManagerService players,
+        IHubContext<PlayerStatusHub>? hubContext = null)
+    {
+        _logger = logger;
+        _players = players;
+        _hubContext = hubContext;
+    }
+
+    /// <summary>
+    /// The latest sync matrix.
+    /// </summary>
+    public SyncMatrixResponse GetMatrix()
+    {
+        lock (_lock)
+        {
+            return _latest;
+        }
+    }
+
+    protected override async Task ExecuteAsync(CancellationToken stoppingToken)
+    {
+        using var timer = new PeriodicTimer(TimeSpan.FromMilliseconds(SampleIntervalMs));
+        var wasActive = false;
+
+        try
+        {
+            while (await timer.WaitForNextTickAsync(stoppingToken))
+            {
+                try
+                {
+                    var (matrix, raised) = Sample();
+
+                    // Push while two or more zones play, plus one empty update so clients can hide the matrix
+                    var active = matrix.Zones.Count >= 2;
+                    if (_hubContext != null && (active || wasActive))
+                    {
+                        await _hubContext.Clients.All.SendAsync("SyncMatrixUpdate", matrix, stoppingToken);
+                        foreach (var alert in raised)
+                        {
+                            await _hubContext.Clients.All.SendAsync("SyncAlert", alert, stoppingToken);
+                        }
+                    }
+                    wasActive = active;
+                }
+                catch (Exception ex) when (ex is not OperationCanceledException)
+                {
+                    _logger.LogWarning(ex, "Zone sync sample failed");
+                }
+            }
+        }
+        catch (OperationCanceledException) when (stoppingToken.IsCancellationRequested)
+        {
+            // Shutting down
+        }
+    }
+
+    /// <summary>
+    /// Reads every zone, updates the pairs and rebuilds the matrix.
+    /// </summary>
+    /// <returns>The new matrix and any alerts raised by this sample.</returns>
+    private (SyncMatrixResponse Matrix, List<SyncAlert> Raised) Sample()
+    {
+        var readings = _players.ReadZoneClocks().OrderBy(r => r.Name, StringComparer.Ordinal).ToList();
+        var now = DateTime.UtcNow;
+        var raised = new List<SyncAlert>();
+
+        var positions = readings.Select(r =>
+            (r.AudioClockUs - r.LocalTimeUs) / 1000.0 + r.ServerOffsetMs - r.SyncErrorMs).ToList();
+
+        lock (_lock)
+        {
+            for (var i = 0; i < readings.Count; i++)
+            {
+                for (var j = i + 1; j < readings.Count; j++)
+                {
+                    var a = readings[i];
+                    var b = readings[j];
+                    if (!_pairs.TryGetValue((a.Name, b.Name), out var pair))
+                    {
+                        pair = new PairState();
+                        _pairs[(a.Name, b.Name)] = pair;
+                    }
+
+                    var groupId = a.GroupId != null && a.GroupId == b.GroupId ? a.GroupId : null;
+                    pair.Add(positions[i] - positions[j], groupId, now);
+
+                    var alert = UpdateAlert(a.Name, b.Name, pair, now);
+                    if (alert != null)
+                        raised.Add(alert);
+                }
+            }
+
+            foreach (var (key, pair) in _pairs.Where(p => now - p.Value.LastSampled > StaleAfter).ToList())
+            {
+                if (pair.Alert != null)
+                {
+                    _logger.LogInformation("Sync alert cleared for '{ZoneA}' / '{ZoneB}': zone no longer playing",
+                        key.A, key.B);
+                }
+                _pairs.Remove(key);
+            }
+
+            _latest = BuildMatrix(readings, now);
+            return (_latest, raised);
+        }
+    }
+
+    /// <summary>
+    /// Raises or clears a pair's alert.
+    /// </summary>
+    /// <returns>The alert if this sample raised it.</returns>
+    private SyncAlert? UpdateAlert(string zoneA, string zoneB, PairState pair, DateTime now)
+    {
+        var magnitude = Math.Abs(pair.Latest);
+
+        if (pair.Alert == null)
+        {
+            pair.Streak = pair.GroupId != null && magnitude > DivergenceThresholdMs ? pair.Streak + 1 : 0;
+            if (pair.Streak < AlertAfterSamples)
+                return null;
+
+            pair.Streak = 0;
+            pair.Alert = new SyncAlert(pair.GroupId!, zoneA, zoneB, Math.Round(pair.Mean, 2), now);
+            _logger.LogWarning(
+                "Zones '{ZoneA}' and '{ZoneB}' in group {GroupId} are {Offset:F1}ms apart (jitter {Jitter:F1}ms, threshold {Threshold}ms)",
+                zoneA, zoneB, pair.GroupId, pair.Mean, pair.Jitter, DivergenceThresholdMs);
+            return pair.Alert;
+        }
+
+        if (pair.GroupId != pair.Alert.GroupId)
+        {
+            _logger.LogInformation("Sync alert cleared for '{ZoneA}' / '{ZoneB}': no longer grouped", zoneA, zoneB);
+            pair.Alert = null;
+            pair.Streak = 0;
+            return null;
+        }
+
+        pair.Streak = magnitude < DivergenceThresholdMs / 2 ? pair.Streak + 1 : 0;
+        if (pair.Streak >= AlertAfterSamples)
+        {
+            _logger.LogInformation("Zones '{ZoneA}' and '{ZoneB}' back in sync ({Offset:F1}ms apart)",
+                zoneA, zoneB, pair.Latest);
+            pair.Alert = null;
+            pair.Streak = 0;
+        }
+
+        return null;
+    }
+
+    private SyncMatrixResponse BuildMatrix(List<ZoneClockReading> readings, DateTime now)
+    {
+        var zones = readings.Select(r => new ZoneSyncState(
+            Name: r.Name,
+            GroupId: r.GroupId,
+            AudioClockSkewMs: Math.Round((r.AudioClockUs - r.LocalTimeUs) / 1000.0, 2),
+            ClockUncertaintyMs: Math.Round(r.OffsetUncertaintyMs, 2),
+            SyncErrorMs: Math.Round(r.SyncErrorMs, 2))).ToList();
+
+        var pairs = new List<ZoneSyncPair>();
+        var matrix = readings.Select(_ => Enumerable.Repeat<double?>(null, readings.Count).ToList()).ToList();
+
+        for (var i = 0; i < readings.Count; i++)
+        {
+            for (var j = i + 1; j < readings.Count; j++)
+            {
+                if (!_pairs.TryGetValue((readings[i].Name, readings[j].Name), out var pair))
+                    continue;
+
+                var mean = Math.Round(pair.Mean, 2);
+                matrix[i][j] = mean;
+                matrix[j][i] = -mean;
+
+                pairs.Add(new ZoneSyncPair(
+                    ZoneA: readings[i].Name,
+                    ZoneB: readings[j].Name,
+                    SameGroup: pair.GroupId != null,
+                    OffsetMs: Math.Round(pair.Latest, 2),
+                    MeanOffsetMs: mean,
+                    JitterMs: Math.Round(pair.Jitter, 2),
+                    Samples: pair.Count,
+                    Diverged: pair.Alert != null));
+            }
+        }
+
+        var alerts = _pairs.Values
+            .Where(p => p.Alert != null)
+            .Select(p => p.Alert!)
+            .ToList();
+
+        return new SyncMatrixResponse(now, DivergenceThresholdMs, zones, matrix, pairs, alerts);
+    }
+
+    /// <summary>
+    /// Offset history of one pair of zones. Guarded by <see cref="_lock"/>.
+    /// </summary>
+    private sealed class PairState
+    {
+        private readonly double[] _window = new double[WindowSamples];
+        private int _next;
+
+        public int Count { get; private set; }
+        public double Latest { get; private set; }
+        public string? GroupId { get; private set; }
+        public DateTime LastSampled { get; private set; }
+        public SyncAlert? Alert { get; set; }
+
+        /// <summary>
+        /// Consecutive samples towards raising (or, while alerting, clearing) the alert.
+        /// </summary>
+        public int Streak { get; set; }
+
+        public double Mean
+        {
+            get
+            {
+                var sum = 0.0;
+                for (var i = 0; i < Count; i++)
+                    sum += _window[i];
+                return Count > 0 ? sum / Count : 0;
+            }
+        }
+
+        public double Jitter
+        {
+            get
+            {
+                if (Count < 2)
+                    return 0;
+
+                var mean = Mean;
+                var sumSquares = 0.0;
+                for (var i = 0; i < Count; i++)
+                    sumSquares += (_window[i] - mean) * (_window[i] - mean);
+                return Math.Sqrt(sumSquares / (Count - 1));
+            }
+        }
+
+        public void Add(double offsetMs, string? groupId, DateTime now)
+        {
+            _window[_next] = offsetMs;
+            _next = (_next + 1) % _window.Length;
+            Count = Math.Min(Count + 1, _window.Length);
+            Latest = offsetMs;
+            GroupId = groupId;
+            LastSampled = now;
+        }
+    }
+}
@@ -0,0 +1,147 @@
+using System.Runtime.InteropServices;
+
+namespace MultiRoomAudio.Utilities;
+
+/// <summary>
+/// P/Invoke bindings for the libc calls used to read Linux device nodes without a thread per device
+/// and to receive kernel hotplug events.
+/// </summary>
+/// <remarks>
+/// All functions set errno; read it with <see cref="Marshal.GetLastPInvokeError"/>.
+///
+/// References:
+/// - epoll(7): https://man7.org/linux/man-pages/man7/epoll.7.html
+/// - eventfd(2): https://man7.org/linux/man-pages/man2/eventfd.2.html
+/// - netlink(7): https://man7.org/linux/man-pages/man7/netlink.7.html
+/// </remarks>
+internal static unsafe class LinuxNative
+{
+    private const string LibC = "libc";
+
+    // open(2) flags
+    public const int O_RDONLY = 0x0;
+    public const int O_NONBLOCK = 0x800;
+    public const int O_CLOEXEC = 0x80000;
+
+    // errno values
+    public const int ENOENT = 2;
+    public const int EINTR = 4;
+    public const int EAGAIN = 11;
+    public const int EACCES = 13;
+    public const int ENODEV = 19;
+
+    // epoll
+    public const int EPOLL_CLOEXEC = O_CLOEXEC;
+    public const int EPOLL_CTL_ADD = 1;
+    public const int EPOLL_CTL_DEL = 2;
+    public const uint EPOLLIN = 0x001;
+    public const uint EPOLLERR = 0x008;
+    public const uint EPOLLHUP = 0x010;
+
+    // eventfd
+    public const int EFD_NONBLOCK = O_NONBLOCK;
+    public const int EFD_CLOEXEC = O_CLOEXEC;
+
+    // netlink
+    public const int AF_NETLINK = 16;
+    public const int SOCK_DGRAM = 2;
+    public const int SOCK_CLOEXEC = O_CLOEXEC;
+    public const int NETLINK_KOBJECT_UEVENT = 15;
+
+    /// <summary>Multicast group the kernel sends uevents to (group 2 is udev's rebroadcast).</summary>
+    public const uint UEVENT_KERNEL_GROUP = 1;
+
+    // poll
+    public const short POLLIN = 0x001;
+
+    /// <summary>
+    /// struct sockaddr_nl.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SockAddrNetlink
+    {
+        public ushort Family;
+        public ushort Pad;
+        public uint Pid;
+        public uint Groups;
+    }
+
+    /// <summary>
+    /// struct pollfd.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PollFd
+    {
+        public int Fd;
+        public short Events;
+        public short Revents;
+    }
+
+    /// <summary>
+    /// Size of struct epoll_event. The kernel declares it packed on x86-64 (12 bytes); other
+    /// 64-bit ABIs align the 64-bit data field (16 bytes).
+    /// </summary>
+    public static readonly int EpollEventSize =
+        RuntimeInformation.ProcessArchitecture == Architecture.X64 ? 12 : 16;
+
+    /// <summary>
+    /// Offset of the data field within struct epoll_event.
+    /// </summary>
+    public static int EpollDataOffset => EpollEventSize - sizeof(ulong);
+
+    [DllImport(LibC, EntryPoint = "open", SetLastError = true)]
+    public static extern int Open([MarshalAs(UnmanagedType.LPUTF8Str)] string path, int flags);
+
+    [DllImport(LibC, EntryPoint = "close", SetLastError = true)]
+    public static extern int Close(int fd);
+
+    [DllImport(LibC, EntryPoint = "read", SetLastError = true)]
+    public static extern nint Read(int fd, byte* buffer, nuint count);
+
+    [DllImport(LibC, EntryPoint = "write", SetLastError = true)]
+    public static extern nint Write(int fd, byte* buffer, nuint count);
+
+    [DllImport(LibC, EntryPoint = "epoll_create1", SetLastError = true)]
+    public static extern int EpollCreate1(int flags);
+
+    /// <param name="ev">Pointer to a struct epoll_event (see <see cref="WriteEpollEvent"/>), or null for DEL.</param>
+    [DllImport(LibC, EntryPoint = "epoll_ctl", SetLastError = true)]
+    public static extern int EpollCtl(int epfd, int op, int fd, byte* ev);
+
+    /// <param name="events">Buffer of <paramref name="maxEvents"/> × <see cref="EpollEventSize"/> bytes.</param>
+    [DllImport(LibC, EntryPoint = "epoll_wait", SetLastError = true)]
+    public static extern int EpollWait(int epfd, byte* events, int maxEvents, int timeoutMs);
+
+    [DllImport(LibC, EntryPoint = "eventfd", SetLastError = true)]
+    public static extern int EventFd(uint initval, int flags);
+
+    [DllImport(LibC, EntryPoint = "socket", SetLastError = true)]
+    public static extern int Socket(int domain, int type, int protocol);
+
+    [DllImport(LibC, EntryPoint = "bind", SetLastError = true)]
+    public static extern int Bind(int fd, ref SockAddrNetlink addr, int addrLen);
+
+    [DllImport(LibC, EntryPoint = "recv", SetLastError = true)]
+    public static extern nint Recv(int fd, byte* buffer, nuint length, int flags);
+
+    [DllImport(LibC, EntryPoint = "poll", SetLastError = true)]
+    public static extern int Poll(ref PollFd fds, nuint count, int timeoutMs);
+
+    /// <summary>
+    /// Fill a struct epoll_event at <paramref name="ev"/>.
+    /// </summary>
+    public static void WriteEpollEvent(byte* ev, uint events, ulong data)
+    {
+        *(uint*)ev = events;
+        *(ulong*)(ev + EpollDataOffset) = data;
+    }
+
+    /// <summary>
+    /// Read the <paramref name="index"/>th struct epoll_event from an epoll_wait buffer.
+    /// </summary>
+    public static (uint Events, ulong Data) ReadEpollEvent(byte* events, int index)
+    {
+        var ev = events + index * EpollEventSize;
+        return (*(uint*)ev, *(ulong*)(ev + EpollDataOffset));
+    }
+}
@@ -6,21 +6,29 @@ namespace MultiRoomAudio.Utilities;
 /// A logger wrapper that adds a prefix to all log messages.
 /// Used to add player context to SDK log messages.
 /// </summary>
+/// <remarks>
+/// The prefix is applied through <see cref="PrefixedState{TState}"/> and a cached static
+/// formatter, so wrapping a call allocates no closure. Disabled levels return before
+/// anything is wrapped.
+/// </remarks>
 /// <typeparam name="T">The category type (typically the SDK class being wrapped).</typeparam>
 public sealed class PrefixedLogger<T> : ILogger<T>
 {
     private readonly ILogger<T> _inner;
     private readonly string _prefix;
+    private readonly string? _playerName;
 
     /// <summary>
     /// Creates a new prefixed logger.
     /// </summary>
     /// <param name="inner">The underlying logger to wrap.</param>
     /// <param name="prefix">The prefix to add to all messages (e.g., "[Study] ").</param>
-    public PrefixedLogger(ILogger<T> inner, string prefix)
+    /// <param name="playerName">Player name added as a structured "PlayerName" property, if set.</param>
+    public PrefixedLogger(ILogger<T> inner, string prefix, string? playerName = null)
     {
         _inner = inner ?? throw new ArgumentNullException(nameof(inner));
         _prefix = prefix ?? throw new ArgumentNullException(nameof(prefix));
+        _playerName = playerName;
     }
 
     public IDisposable? BeginScope<TState>(TState state) where TState : notnull
@@ -40,16 +48,78 @@ public sealed class PrefixedLogger<T> : ILogger<T>
         if (!IsEnabled(logLevel))
             return;
 
-        // Wrap the formatter to add the prefix
         _inner.Log(
             logLevel,
             eventId,
-            state,
+            new PrefixedState<TState>(_prefix, _playerName, state, formatter),
             exception,
-            (s, ex) => _prefix + formatter(s, ex));
+            PrefixedState<TState>.Formatter);
     }
 }
 
+/// <summary>
+/// Log state that carries the prefix alongside the original state and formatter.
+/// </summary>
+/// <remarks>
+/// Enumerates as the original state's properties (when it has any) plus "PlayerName",
+/// so structured sinks keep the message template and its arguments.
+/// </remarks>
+public readonly struct PrefixedState<TState> : IReadOnlyList<KeyValuePair<string, object?>>
+{
+    /// <summary>
+    /// Formats the message with the prefix. Static so no delegate is allocated per call.
+    /// </summary>
+    public static readonly Func<PrefixedState<TState>, Exception?, string> Formatter =
+        static (state, exception) => state.Prefix + state.InnerFormatter(state.State, exception);
+
+    public PrefixedState(
+        string prefix,
+        string? playerName,
+        TState state,
+        Func<TState, Exception?, string> innerFormatter)
+    {
+        Prefix = prefix;
+        PlayerName = playerName;
+        State = state;
+        InnerFormatter = innerFormatter;
+    }
+
+    public string Prefix { get; }
+    public string? PlayerName { get; }
+    public TState State { get; }
+    public Func<TState, Exception?, string> InnerFormatter { get; }
+
+    private IReadOnlyList<KeyValuePair<string, object?>>? InnerProperties =>
+        State as IReadOnlyList<KeyValuePair<string, object?>>;
+
+    private int ExtraCount => PlayerName != null ? 1 : 0;
+
+    public int Count => (InnerProperties?.Count ?? 0) + ExtraCount;
+
+    public KeyValuePair<string, object?> this[int index]
+    {
+        get
+        {
+            var innerCount = InnerProperties?.Count ?? 0;
+            if (index < innerCount)
+                return InnerProperties![index];
+            if (index == innerCount && PlayerName != null)
+                return new KeyValuePair<string, object?>("PlayerName", PlayerName);
+            throw new ArgumentOutOfRangeException(nameof(index));
+        }
+    }
+
+    public IEnumerator<KeyValuePair<string, object?>> GetEnumerator()
+    {
+        for (var i = 0; i < Count; i++)
+            yield return this[i];
+    }
+
+    System.Collections.IEnumerator System.Collections.IEnumerable.GetEnumerator() => GetEnumerator();
+
+    public override string ToString() => Formatter(this, null);
+}
+
 /// <summary>
 /// Extension methods for creating prefixed loggers.
 /// </summary>
@@ -67,6 +137,6 @@ public static class PrefixedLoggerExtensions
         string playerName)
     {
         var inner = loggerFactory.CreateLogger<T>();
-        return new PrefixedLogger<T>(inner, $"[{playerName}] ");
+        return new PrefixedLogger<T>(inner, $"[{playerName}] ", playerName);
     }
 }
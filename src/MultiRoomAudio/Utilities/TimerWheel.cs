@@ -0,0 +1,276 @@
+namespace MultiRoomAudio.Utilities;
+
+/// <summary>
+/// Hierarchical timer wheel: many keyed one-shot timers driven by a single
+/// <see cref="System.Threading.Timer"/>.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Two levels of 64 slots: the first holds timers due within 64 ticks, one slot per tick;
+/// the second holds later timers, one slot per 64 ticks, and each of its slots is moved down
+/// into the first level when the wheel reaches it. Scheduling, cancelling and firing are O(1)
+/// per timer regardless of how many are pending. Timers further out than the second level
+/// covers are parked in its last slot and re-placed each time it comes round.
+/// </para>
+/// <para>
+/// Timers fire no earlier than requested and at most one tick late. The underlying timer
+/// only runs while something is scheduled. Callbacks run on a thread-pool thread outside
+/// the wheel's lock, so they may schedule or cancel timers.
+/// </para>
+/// </remarks>
+public sealed class TimerWheel<TKey> : IDisposable where TKey : notnull
+{
+    private const int SlotsPerLevel = 64;
+
+    private readonly ILogger? _logger;
+    private readonly TimeSpan _tick;
+    private readonly object _lock = new();
+    private readonly Dictionary<TKey, Entry> _entries = new();
+    private readonly HashSet<Entry>[] _level0 = CreateLevel();
+    private readonly HashSet<Entry>[] _level1 = CreateLevel();
+    private readonly Timer _timer;
+
+    private long _currentTick;
+    private bool _running;
+    private bool _disposed;
+
+    private sealed class Entry
+    {
+        public required TKey Key { get; init; }
+        public required long DueTick { get; init; }
+        public required DateTime DueTime { get; init; }
+        public required Action Callback { get; init; }
+        public HashSet<Entry>? Slot { get; set; }
+    }
+
+    /// <param name="tick">Resolution of the wheel.</param>
+    /// <param name="logger">Optional logger for callback failures.</param>
+    public TimerWheel(TimeSpan tick, ILogger? logger = null)
+    {
+        if (tick <= TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(tick), "Tick must be positive");
+
+        _tick = tick;
+        _logger = logger;
+        _timer = new Timer(_ => OnTick(), null, Timeout.Infinite, Timeout.Infinite);
+    }
+
+    /// <summary>
+    /// Number of pending timers.
+    /// </summary>
+    public int Count
+    {
+        get
+        {
+            lock (_lock)
+            {
+                return _entries.Count;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Schedules <paramref name="callback"/> to run after <paramref name="delay"/>,
+    /// replacing any pending timer with the same key.
+    /// </summary>
+    public void Schedule(TKey key, TimeSpan delay, Action callback)
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            RemoveEntry(key);
+
+            // +1: the current tick is already partly elapsed, so never fire early
+            var ticks = (long)Math.Ceiling(Math.Max(0, delay.Ticks) / (double)_tick.Ticks);
+            var entry = new Entry
+            {
+                Key = key,
+                DueTick = _currentTick + ticks + 1,
+                DueTime = DateTime.UtcNow + delay,
+                Callback = callback
+            };
+
+            _entries[key] = entry;
+            Place(entry);
+
+            if (!_running)
+            {
+                _running = true;
+                _timer.Change(_tick, _tick);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Cancels the pending timer for <paramref name="key"/>, if any.
+    /// </summary>
+    /// <returns>True if a timer was cancelled.</returns>
+    public bool Cancel(TKey key)
+    {
+        lock (_lock)
+        {
+            return RemoveEntry(key);
+        }
+    }
+
+    /// <summary>
+    /// Cancels every pending timer.
+    /// </summary>
+    /// <returns>Number of timers cancelled.</returns>
+    public int CancelAll()
+    {
+        lock (_lock)
+        {
+            var count = _entries.Count;
+            foreach (var entry in _entries.Values)
+            {
+                entry.Slot?.Remove(entry);
+                entry.Slot = null;
+            }
+            _entries.Clear();
+            return count;
+        }
+    }
+
+    /// <summary>
+    /// When the pending timer for <paramref name="key"/> is due (UTC), or null if none is pending.
+    /// </summary>
+    public DateTime? GetDueTime(TKey key)
+    {
+        lock (_lock)
+        {
+            return _entries.TryGetValue(key, out var entry) ? entry.DueTime : null;
+        }
+    }
+
+    private void OnTick()
+    {
+        List<Entry>? due = null;
+
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _currentTick++;
+
+            // Entering a new block of the first level: move the matching second-level slot down
+            if (_currentTick % SlotsPerLevel == 0)
+            {
+                var slot = _level1[(_currentTick / SlotsPerLevel) % SlotsPerLevel];
+                if (slot.Count > 0)
+                {
+                    var cascading = slot.ToList();
+                    slot.Clear();
+                    foreach (var entry in cascading)
+                    {
+                        Place(entry);
+                    }
+                }
+            }
+
+            var current = _level0[_currentTick % SlotsPerLevel];
+            if (current.Count > 0)
+            {
+                foreach (var entry in current)
+                {
+                    if (entry.DueTick <= _currentTick)
+                    {
+                        (due ??= new List<Entry>()).Add(entry);
+                    }
+                }
+
+                if (due != null)
+                {
+                    foreach (var entry in due)
+                    {
+                        current.Remove(entry);
+                        entry.Slot = null;
+                        _entries.Remove(entry.Key);
+                    }
+                }
+            }
+
+            if (_entries.Count == 0 && _running)
+            {
+                _running = false;
+                _timer.Change(Timeout.Infinite, Timeout.Infinite);
+            }
+        }
+
+        if (due == null)
+            return;
+
+        foreach (var entry in due)
+        {
+            try
+            {
+                entry.Callback();
+            }
+            catch (Exception ex)
+            {
+                _logger?.LogError(ex, "Timer callback for {Key} failed", entry.Key);
+            }
+        }
+    }
+
+    private void Place(Entry entry)
+    {
+        var delta = entry.DueTick - _currentTick;
+
+        HashSet<Entry> slot;
+        if (delta < SlotsPerLevel)
+        {
+            // Cascaded entries due this tick go in the current slot, which is fired next
+            slot = _level0[Math.Max(entry.DueTick, _currentTick) % SlotsPerLevel];
+        }
+        else if (delta < SlotsPerLevel * (SlotsPerLevel - 1))
+        {
+            slot = _level1[(entry.DueTick / SlotsPerLevel) % SlotsPerLevel];
+        }
+        else
+        {
+            // Beyond the wheel: park in the furthest slot and re-place when it comes round
+            slot = _level1[(_currentTick / SlotsPerLevel + SlotsPerLevel - 1) % SlotsPerLevel];
+        }
+
+        slot.Add(entry);
+        entry.Slot = slot;
+    }
+
+    private bool RemoveEntry(TKey key)
+    {
+        if (!_entries.Remove(key, out var entry))
+            return false;
+
+        entry.Slot?.Remove(entry);
+        entry.Slot = null;
+        return true;
+    }
+
+    private static HashSet<Entry>[] CreateLevel()
+    {
+        var level = new HashSet<Entry>[SlotsPerLevel];
+        for (int i = 0; i < SlotsPerLevel; i++)
+        {
+            level[i] = new HashSet<Entry>();
+        }
+        return level;
+    }
+
+    public void Dispose()
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            _entries.Clear();
+        }
+
+        _timer.Dispose();
+    }
+}
@@ -239,7 +239,7 @@ function setStartupOverlayVisible(visible) {
 /**
  * Renders the startup progress overlay.
  * Shows phase list with status icons. Hides overlay when startup completes.
- * @param {object} progress - { complete: bool, phases: [{ id, name, status, detail }] }
+ * @param {object} progress - { complete: bool, phases: [{ id, name, status, detail, steps }] }
  */
 function renderStartupProgress(progress) {
     const overlay = document.getElementById('startup-overlay');
@@ -289,6 +289,13 @@ function renderStartupProgress(progress) {
             row.appendChild(detail);
         }
 
+        // Per-step timings (e.g. each custom sink) as a hover list
+        if (phase.steps && phase.steps.length > 0) {
+            row.title = phase.steps
+                .map(step => `${step.name}: ${step.success ? `${step.durationMs}ms` : `failed (${step.error})`}`)
+                .join('\n');
+        }
+
         phasesEl.appendChild(row);
     }
 }
@@ -703,6 +710,14 @@ function setupSignalR() {
         }
     });
 
+    connection.on('SyncMatrixUpdate', (matrix) => {
+        renderSyncMatrix(matrix);
+    });
+
+    connection.on('SyncAlert', (alert) => {
+        showAlert(`${alert.zoneA} and ${alert.zoneB} are ${Math.abs(alert.offsetMs).toFixed(0)}ms out of sync`, 'warning', 8000);
+    });
+
     connection.on('DeviceListChanged', async () => {
         console.log('Device list changed, refreshing devices...');
         await refreshDevices();
@@ -1121,8 +1136,8 @@ async function openEditPlayerModal(playerName) {
             // Refresh formats first to populate options
             await refreshFormats();
 
-            // Store original format for change detection (default to flac-48000 for compatibility)
-            const originalFormat = player.advertisedFormat || 'flac-48000';
+            // Store original format for change detection (default to auto negotiation)
+            const originalFormat = player.advertisedFormat || 'auto';
             document.getElementById('playerForm').dataset.originalFormat = originalFormat;
 
             // Set dropdown value AFTER options are populated
@@ -1190,8 +1205,8 @@ async function savePlayer() {
             // Include advertised format if advanced formats enabled
             if (advancedFormatsEnabled) {
                 const form = document.getElementById('playerForm');
-                const originalFormat = form.dataset.originalFormat || 'flac-48000';
-                const currentFormat = document.getElementById('advertisedFormat').value || 'flac-48000';
+                const originalFormat = form.dataset.originalFormat || 'auto';
+                const currentFormat = document.getElementById('advertisedFormat').value || 'auto';
 
                 // Only include if changed from original
                 if (currentFormat !== originalFormat) {
@@ -1600,9 +1615,9 @@ async function showPlayerStats(name) {
     const discoveryMethod = player.serverUrl ? 'Manual' : 'Auto-discovered';
 
     // Advertised format display
-    const advertised = player.advertisedFormat || 'flac-48000';
+    const advertised = player.advertisedFormat || 'auto';
     const isAllFormats = advertised === 'all';
-    const advertisedDisplay = isAllFormats ? 'All Formats' : advertised;
+    const advertisedDisplay = isAllFormats ? 'All Formats' : advertised === 'auto' ? 'Auto (device native)' : advertised;
     const advertisedSubtitle = isAllFormats ? '<br><small class="text-muted">flac • pcm • opus, up to 192kHz</small>' : '';
 
     // Output format - use device already looked up above
@@ -1705,6 +1720,58 @@ async function showPlayerStats(name) {
     }
 }
 
+// Cross-zone sync matrix: mean offset of each row zone against each column zone.
+// Grouped pairs are coloured against the alert threshold; ungrouped pairs are not expected to match.
+function renderSyncMatrix(matrix) {
+    const card = document.getElementById('sync-matrix-card');
+    if (!card) return;
+
+    const zones = matrix?.zones || [];
+    if (zones.length < 2) {
+        card.classList.add('d-none');
+        return;
+    }
+
+    const pairs = {};
+    (matrix.pairs || []).forEach(p => {
+        pairs[`${p.zoneA}\n${p.zoneB}`] = p;
+        pairs[`${p.zoneB}\n${p.zoneA}`] = p;
+    });
+
+    const threshold = matrix.thresholdMs;
+    const header = zones.map(z => `<th class="text-end">${escapeHtml(z.name)}</th>`).join('');
+    const rows = zones.map((row, i) => {
+        const cells = zones.map((col, j) => {
+            const offset = matrix.offsetMatrixMs?.[i]?.[j];
+            if (i === j || offset == null) {
+                return '<td class="text-end text-muted">&ndash;</td>';
+            }
+
+            const pair = pairs[`${row.name}\n${col.name}`];
+            let cls = 'text-muted';
+            if (pair?.sameGroup) {
+                cls = pair.diverged ? 'text-danger fw-bold'
+                    : Math.abs(offset) > threshold / 2 ? 'text-warning' : 'text-success';
+            }
+            const title = pair ? `jitter ${pair.jitterMs.toFixed(1)}ms over ${pair.samples} samples` : '';
+            return `<td class="text-end ${cls}" title="${title}">${offset > 0 ? '+' : ''}${offset.toFixed(1)}</td>`;
+        }).join('');
+        return `<tr><th>${escapeHtml(row.name)}</th>${cells}</tr>`;
+    }).join('');
+
+    document.getElementById('sync-matrix').innerHTML = `
+        <table class="table table-sm mb-0">
+            <thead><tr><th></th>${header}</tr></thead>
+            <tbody>${rows}</tbody>
+        </table>
+    `;
+
+    const alerts = matrix.alerts?.length || 0;
+    document.getElementById('sync-matrix-summary').textContent =
+        `ms, row ahead of column · alert at ${threshold}ms` + (alerts > 0 ? ` · ${alerts} alert${alerts > 1 ? 's' : ''}` : '');
+    card.classList.remove('d-none');
+}
+
 // Render players
 function renderPlayers() {
 
@@ -2138,6 +2205,10 @@ function renderStatsPanel(stats) {
                     <span class="stats-label">Output</span>
                     <span id="stats-output-format" class="stats-value info"></span>
                 </div>
+                <div class="stats-row" id="stats-advertised-row" style="display: none;">
+                    <span class="stats-label">Advertised</span>
+                    <span id="stats-advertised-format" class="stats-value"></span>
+                </div>
                 <div class="stats-row" id="stats-hardware-row" style="display: none;">
                     <span class="stats-label">Hardware</span>
                     <span id="stats-hardware-format" class="stats-value info"></span>
@@ -2243,6 +2314,20 @@ function renderStatsPanel(stats) {
                     <span class="stats-label">Timing Source</span>
                     <span id="stats-timing-source" class="stats-value"></span>
                 </div>
+                <div class="stats-row">
+                    <span class="stats-label">Warm Start</span>
+                    <span id="stats-warm-start" class="stats-value"></span>
+                </div>
+                <div class="stats-row">
+                    <span class="stats-label">Time to Sync</span>
+                    <span id="stats-time-to-sync" class="stats-value"></span>
+                </div>
+            </div>
+
+            <!-- Combined Outputs Section (in-process combine sinks only) -->
+            <div id="stats-combine-section" class="stats-section" style="display: none;">
+                <div class="stats-section-header">Combined Outputs</div>
+                <div id="stats-combine-outputs"></div>
             </div>
 
             <!-- Throughput Section -->
@@ -2256,6 +2341,10 @@ function renderStatsPanel(stats) {
                     <span class="stats-label">Samples Read</span>
                     <span id="stats-samples-read" class="stats-value"></span>
                 </div>
+                <div class="stats-row">
+                    <span class="stats-label">Idle Cork</span>
+                    <span id="stats-idle-cork" class="stats-value"></span>
+                </div>
             </div>
 
             <!-- Buffer Diagnostics Section -->
@@ -2323,6 +2412,19 @@ function renderStatsPanel(stats) {
 
     updateStatsValue('stats-output-format', stats.audioFormat.outputFormat);
 
+    // Advertised format row - negotiated (auto) or user-selected
+    const advertisedRow = document.getElementById('stats-advertised-row');
+    if (stats.formatNegotiation) {
+        const fn = stats.formatNegotiation;
+        advertisedRow.style.display = '';
+        advertisedRow.title = fn.reason;
+        updateStatsValueWithClass('stats-advertised-format',
+            `${fn.advertisedFormat} (${fn.mode})`,
+            fn.matchesSinkRate === false ? 'warning' : fn.matchesSinkRate ? 'good' : '');
+    } else {
+        advertisedRow.style.display = 'none';
+    }
+
     // Hardware row - show/hide and update
     const hardwareRow = document.getElementById('stats-hardware-row');
     if (stats.audioFormat.hardwareFormat) {
@@ -2381,10 +2483,45 @@ function renderStatsPanel(stats) {
     updateStatsValueWithClass('stats-timing-source',
         getTimingSourceLabel(stats.clockSync.timingSource),
         getTimingSourceClass(stats.clockSync.timingSource));
+    if (stats.warmStart) {
+        const ws = stats.warmStart;
+        updateStatsValueWithClass('stats-warm-start',
+            ws.isWarmStart ? `Yes (${ws.persistedDriftPpm.toFixed(1)} ppm${ws.latencyWarmStarted ? ', latency' : ''})` : 'No',
+            ws.isWarmStart ? 'good' : 'muted');
+        const coldRef = ws.lastColdStartSyncMs != null ? ` / cold ${ws.lastColdStartSyncMs}ms` : '';
+        updateStatsValue('stats-time-to-sync',
+            ws.timeToFirstSyncMs != null ? `${ws.timeToFirstSyncMs}ms${coldRef}` : '—');
+    }
+
+    // Combined outputs: latency and offset from the lead per device
+    const combineSection = document.getElementById('stats-combine-section');
+    if (combineSection) {
+        const outputs = stats.combineOutputs || [];
+        combineSection.style.display = outputs.length > 0 ? '' : 'none';
+        document.getElementById('stats-combine-outputs').innerHTML = outputs.map(o => {
+            const latency = o.outputLatencyMs != null ? `${o.outputLatencyMs}ms${o.isLatencyLocked ? '' : '*'}` : '—';
+            const offset = o.isLead ? 'lead' : formatMs(o.offsetMs);
+            const offsetClass = o.isLead || Math.abs(o.offsetMs) < 1 ? 'good' : 'warning';
+            return `
+                <div class="stats-row">
+                    <span class="stats-label">${escapeHtml(o.sink)}</span>
+                    <span class="stats-value ${offsetClass}">${latency} / ${offset} (-${formatCount(o.framesDropped)} +${formatCount(o.framesInserted)})</span>
+                </div>`;
+        }).join('');
+    }
 
     // Throughput
     updateStatsValue('stats-samples-written', formatSampleCount(stats.throughput.samplesWritten));
     updateStatsValue('stats-samples-read', formatSampleCount(stats.throughput.samplesRead));
+    if (stats.idleCork) {
+        const ic = stats.idleCork;
+        const wake = ic.lastWakeToAudioMs != null ? `, wake +${ic.lastWakeToAudioMs}ms` : '';
+        updateStatsValueWithClass('stats-idle-cork',
+            `${ic.isCorked ? 'Corked' : 'Running'} (${formatCount(ic.corkCount)}×, ${formatSampleCount(ic.wakeupsSaved)} wakeups saved${wake})`,
+            ic.isCorked ? 'info' : '');
+    } else {
+        updateStatsValue('stats-idle-cork', '—');
+    }
 
     // Buffer Diagnostics
     updateStatsValueWithClass('stats-diag-state', stats.diagnostics.state, getBufferStateClass(stats.diagnostics.state));
@@ -2752,6 +2889,7 @@ function openCombineSinkModal(editData = null) {
     nameInput.value = editData ? editData.name : '';
     nameInput.disabled = !!editData; // Disable name field when editing, enable for create
     document.getElementById('combineSinkDesc').value = editData?.description || '';
+    document.getElementById('combineInProcess').checked = !!editData?.inProcess;
 
     // Populate device list (exclude hidden devices, but include current slaves even if hidden)
     const deviceList = document.getElementById('combineDeviceList');
@@ -2816,6 +2954,7 @@ function openRemapSinkModal(editData = null) {
     nameInput.value = editData ? editData.name : '';
     nameInput.disabled = !!editData; // Disable name field when editing, enable for create
     document.getElementById('remapSinkDesc').value = editData?.description || '';
+    document.getElementById('remapInProcess').checked = !!editData?.inProcess;
 
     // Populate master device dropdown:
     // - Exclude remap sinks (they can't be masters of other remap sinks)
@@ -2985,6 +3124,7 @@ async function createCombineSink() {
     const description = document.getElementById('combineSinkDesc').value.trim();
     const checkboxes = document.querySelectorAll('#combineDeviceList input:checked');
     const slaves = Array.from(checkboxes).map(cb => cb.value);
+    const inProcess = document.getElementById('combineInProcess').checked;
     const isEditing = !!editingCombineSink;
 
     if (!name) {
@@ -3013,7 +3153,7 @@ async function createCombineSink() {
         const response = await fetch('./api/sinks/combine', {
             method: 'POST',
             headers: { 'Content-Type': 'application/json' },
-            body: JSON.stringify({ name, description: description || null, slaves })
+            body: JSON.stringify({ name, description: description || null, slaves, inProcess })
         });
 
         if (!response.ok) {
@@ -3038,6 +3178,7 @@ async function createRemapSink() {
     const description = document.getElementById('remapSinkDesc').value.trim();
     const masterSink = document.getElementById('remapMasterDevice').value;
     const isMono = document.getElementById('outputModeMono').checked;
+    const inProcess = document.getElementById('remapInProcess').checked;
     const isEditing = !!editingRemapSink;
 
     if (!name) {
@@ -3092,7 +3233,8 @@ async function createRemapSink() {
                 masterSink,
                 channels,
                 channelMappings,
-                remix: isMono
+                remix: isMono,
+                inProcess
             })
         });
 
@@ -4195,7 +4337,7 @@ async function setSoundCardProfile(cardName, profileName, cardIndex) {
 // ============================================
 
 let logsData = [];
-let logsSkip = 0;
+let logsCursor = null; // Server cursor for the next (older) page; null = first page
 const logsPageSize = 100;
 let logsConnection = null;
 let logsAutoScroll = true;
@@ -4209,7 +4351,7 @@ function showLogsView() {
 
     // Initialize logs
     logsData = [];
-    logsSkip = 0;
+    logsCursor = null;
     refreshLogs();
     setupLogsSignalR();
 }
@@ -4235,7 +4377,8 @@ function setupLogsSignalR() {
         .withAutomaticReconnect()
         .build();
 
-    logsConnection.on('LogEntry', (entry) => {
+    // Entries arrive in batches (oldest first) from the server's log consumer
+    logsConnection.on('LogBatch', (entries) => {
         if (!logsLiveStream) return;
 
         // Check filters
@@ -4243,17 +4386,22 @@ function setupLogsSignalR() {
         const categoryFilter = document.getElementById('logCategoryFilter').value;
         const searchFilter = document.getElementById('logSearchInput').value.toLowerCase();
 
-        if (levelFilter && entry.level.toLowerCase() !== levelFilter) return;
-        if (categoryFilter && entry.category !== categoryFilter) return;
-        if (searchFilter && !entry.message.toLowerCase().includes(searchFilter)) return;
-
-        // Add to top of list (newest first)
-        logsData.unshift(entry);
-        // Limit array size to prevent memory leak (matches DOM limit of 500)
-        if (logsData.length > 500) {
-            logsData.pop();
+        let added = 0;
+        for (const entry of entries) {
+            if (levelFilter && entry.level.toLowerCase() !== levelFilter) continue;
+            if (categoryFilter && entry.category !== categoryFilter) continue;
+            if (searchFilter && !entry.message.toLowerCase().includes(searchFilter)) continue;
+
+            // Add to top of list (newest first)
+            logsData.unshift(entry);
+            // Limit array size to prevent memory leak (matches DOM limit of 500)
+            if (logsData.length > 500) {
+                logsData.pop();
+            }
+            prependLogEntry(entry);
+            added++;
         }
-        prependLogEntry(entry);
+        if (added === 0) return;
         updateLogsCount();
 
         // Auto-scroll to top if enabled
@@ -4282,7 +4430,7 @@ function debouncedLogSearch() {
 
 // Refresh logs (reset and reload)
 async function refreshLogs() {
-    logsSkip = 0;
+    logsCursor = null;
     logsData = [];
 
     const container = document.getElementById('logsContainer');
@@ -4302,11 +4450,13 @@ async function loadLogs() {
     const category = document.getElementById('logCategoryFilter').value;
     const search = document.getElementById('logSearchInput').value;
 
+    // Cursor paging: live entries arriving between pages don't shift the next page
+    const isFirstPage = logsCursor === null;
     const params = new URLSearchParams({
-        skip: logsSkip,
         take: logsPageSize,
         newestFirst: true
     });
+    if (!isFirstPage) params.append('cursor', logsCursor);
 
     if (level) params.append('level', level);
     if (category) params.append('category', category);
@@ -4318,7 +4468,9 @@ async function loadLogs() {
 
         const data = await response.json();
 
-        if (logsSkip === 0) {
+        logsCursor = data.nextCursor ?? null;
+
+        if (isFirstPage) {
             logsData = data.entries;
             renderLogs();
         } else {
@@ -4328,7 +4480,7 @@ async function loadLogs() {
 
         // Show/hide load more button
         const loadMore = document.getElementById('logsLoadMore');
-        if (logsData.length < data.totalCount) {
+        if (logsCursor !== null) {
             loadMore.classList.remove('d-none');
         } else {
             loadMore.classList.add('d-none');
@@ -4350,7 +4502,7 @@ async function loadLogs() {
 
 // Load more logs (pagination)
 function loadMoreLogs() {
-    logsSkip += logsPageSize;
+    if (logsCursor === null) return;
     loadLogs();
 }
 
@@ -4436,7 +4588,7 @@ async function clearLogs() {
         if (!response.ok) throw new Error('Failed to clear logs');
 
         logsData = [];
-        logsSkip = 0;
+        logsCursor = null;
         renderLogs();
         updateLogsCount(0);
         showAlert('Logs cleared', 'success');
@@ -4501,26 +4653,14 @@ function downloadDiagnostics() {
         eventSource.close();
         activeDiagnosticsEventSource = null;
 
-        // Decode base64 content to bytes (preserves UTF-8 encoding)
-        const base64Content = event.data;
-        const binaryString = atob(base64Content);
-        const bytes = new Uint8Array(binaryString.length);
-        for (let i = 0; i < binaryString.length; i++) {
-            bytes[i] = binaryString.charCodeAt(i);
-        }
-
-        // Create blob and trigger download
-        const blob = new Blob([bytes], { type: 'text/plain; charset=utf-8' });
-        const url = URL.createObjectURL(blob);
-        const filename = `multiroom-diagnostics-${new Date().toISOString().slice(0, 19).replace(/[T:]/g, '-')}.txt`;
-
+        // Server streamed the bundle to disk; fetch it from the one-shot download URL
+        const bundle = JSON.parse(event.data);
         const a = document.createElement('a');
-        a.href = url;
-        a.download = filename;
+        a.href = bundle.url;
+        a.download = bundle.filename;
         document.body.appendChild(a);
         a.click();
         document.body.removeChild(a);
-        URL.revokeObjectURL(url);
 
         // Hide the banner
         banner.classList.add('d-none');
@@ -4909,6 +5049,22 @@ function renderTriggers() {
                             <span class="input-group-text">s</span>
                         </div>
                     </td>
+                    <td>
+                        <div class="input-group input-group-sm">
+                            <input type="number" class="form-control"
+                                   id="trigger-warmup-${boardIdSafe}-${trigger.channel}"
+                                   value="${trigger.ampWarmupMs || 0}"
+                                   min="0" max="5000" step="100"
+                                   title="Hold playback start until the amplifier has been powered this long"
+                                   onchange="updateTriggerWarmup('${boardId}', ${trigger.channel}, this.value)"
+                                   ${controlsDisabled ? 'disabled' : ''}>
+                            <span class="input-group-text">ms</span>
+                        </div>
+                        ${trigger.lastTriggerToAudibleMs != null ? `
+                        <div class="small text-muted" title="Time from relay on to audio start (last power-on)">
+                            audible +${trigger.lastTriggerToAudibleMs}ms${trigger.clippedStarts > 0 ? ` · <span class="text-warning">${trigger.clippedStarts} clipped</span>` : ''}
+                        </div>` : ''}
+                    </td>
                     <td class="text-end" style="white-space: nowrap;">
                         <button class="${onBtnClass}"
                                 onclick="testTrigger('${boardId}', ${trigger.channel}, true)"
@@ -5000,6 +5156,7 @@ function renderTriggers() {
                                     <th>Channel</th>
                                     <th>Sink</th>
                                     <th>Off Delay</th>
+                                    <th>Amp Warm-up</th>
                                     <th class="text-end trigger-action-header"><span class="trigger-action-col">On</span><span class="trigger-action-col">Off</span></th>
                                 </tr>
                             </thead>
@@ -5533,6 +5690,42 @@ async function updateTriggerDelay(boardId, channel, delay) {
     }
 }
 
+// Update trigger amplifier warm-up (multi-board)
+async function updateTriggerWarmup(boardId, channel, warmupMs) {
+    const boardIdSafe = boardId.replace(/[^a-zA-Z0-9]/g, '_');
+    const sinkSelect = document.getElementById(`trigger-sink-${boardIdSafe}-${channel}`);
+    const sinkName = sinkSelect ? sinkSelect.value : null;
+    const delayInput = document.getElementById(`trigger-delay-${boardIdSafe}-${channel}`);
+    const delay = delayInput ? parseInt(delayInput.value, 10) : 60;
+
+    try {
+        // Use query params for board IDs that contain slashes (e.g., LCUS:/dev/ttyUSB0)
+        const url = boardId.includes('/')
+            ? `./api/triggers/boards/channel?boardId=${encodeURIComponent(boardId)}&channel=${channel}`
+            : `./api/triggers/boards/${encodeURIComponent(boardId)}/${channel}`;
+        const response = await fetch(url, {
+            method: 'PUT',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                channel,
+                customSinkName: sinkName || null,
+                offDelaySeconds: delay,
+                ampWarmupMs: parseInt(warmupMs, 10) || 0
+            })
+        });
+
+        if (!response.ok) {
+            const error = await response.json();
+            throw new Error(error.message || 'Failed to update trigger');
+        }
+
+        showAlert(`Warm-up updated`, 'success', 2000);
+    } catch (error) {
+        console.error('Error updating trigger warm-up:', error);
+        showAlert(`Failed to update trigger: ${error.message}`, 'danger');
+    }
+}
+
 // Update a specific channel's UI state without reloading everything
 function updateChannelState(boardId, channel, isOn) {
     const boardIdSafe = boardId.replace(/[^a-zA-Z0-9]/g, '_');